@@ -261,6 +261,17 @@ set(USE_ANTLR OFF)
 # Whether use Relay debug mode
 set(USE_RELAY_DEBUG OFF)
 
+# Whether to build the relay VM interpreter with computed-goto dispatch
+# (requires a GNU-compatible compiler; falls back to switch dispatch elsewhere)
+set(USE_VM_COMPUTED_GOTO OFF)
+
+# Whether to compile runtime-internal ICHECKs to unreachable hints, trading
+# all internal-error diagnostics for branch-predictor and icache budget on
+# hot call paths. Only enable for deployments whose artifacts were validated
+# once under a regular checked build; a failing condition is undefined
+# behavior in this mode.
+set(TVM_RUNTIME_UNCHECKED OFF)
+
 # Whether to build fast VTA simulator driver
 set(USE_VTA_FSIM OFF)
 
@@ -278,6 +278,13 @@ class RewriteSimplifier {
   class Impl;
   /*! \brief Internal impl */
   Impl* impl_;
+  /*!
+   * \brief Memoized top-level results, so identical subtrees handed to the
+   * simplifier hundreds of times across a pass pipeline simplify once. The
+   * table is invalidated whenever a binding or constraint changes, since
+   * results depend on that context.
+   */
+  std::unordered_map<PrimExpr, PrimExpr, ObjectPtrHash, ObjectPtrEqual> memo_;
 };
 
 /*!
@@ -81,6 +81,16 @@ class RecordReaderNode : public Object {
    * \return Whether the read is successful. */
   bool ReadNext(MeasureInputNode* inp, MeasureResultNode* res);
 
+  /*!
+   * \brief Compact the record file into \p out_filename: failed and
+   * duplicate measurements of one schedule config are dropped (keeping the
+   * best), and only the top_k best configs per (workload, target) survive.
+   * The output remains an ordinary record file.
+   * \param out_filename The file to write the compacted records to.
+   * \param top_k Number of configs kept per workload; 0 keeps all.
+   */
+  void CompactTo(const String& out_filename, int top_k);
+
   /*!
    * \brief Read multiple lines from the log file.
    * \param max_size The maximum number of lines. -1 means read all lines.
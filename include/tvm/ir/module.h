@@ -147,6 +147,17 @@ class IRModuleNode : public Object {
    */
   TVM_DLL void AddUnchecked(const GlobalVar& var, const BaseFunc& func);
 
+  /*!
+   * \brief Add a batch of functions to the global environment.
+   *
+   *  Bulk variant for frontend import of large modules: one pass fills the
+   *  function and symbol maps, and the per-function well-formedness
+   *  warnings of Add are skipped the way AddUnchecked skips them; the
+   *  global-name uniqueness invariant is still enforced per entry.
+   * \param funcs The functions, keyed by their global vars.
+   */
+  TVM_DLL void AddBulkUnchecked(const Map<GlobalVar, BaseFunc>& funcs);
+
   /*!
    * \brief Add a type-level definition to the global environment.
    * \param var The var of the global type definition.
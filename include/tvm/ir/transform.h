@@ -291,12 +291,21 @@ class PassInfoNode : public Object {
   /*! \brief The passes that are required to perform the current pass. */
   Array<String> required;
 
+  /*!
+   * \brief Whether a function pass may be mapped over module functions in
+   * parallel. Only set for passes whose pass function is thread-safe, free of
+   * cross-function side effects, and does not inspect the module's other
+   * functions (their slots mutate concurrently during the map).
+   */
+  bool parallel{false};
+
   PassInfoNode() = default;
 
   void VisitAttrs(AttrVisitor* v) {
     v->Visit("opt_level", &opt_level);
     v->Visit("name", &name);
     v->Visit("required", &required);
+    v->Visit("parallel", &parallel);
   }
 
   static constexpr const char* _type_key = "transform.PassInfo";
@@ -315,8 +324,10 @@ class PassInfo : public ObjectRef {
    * \param opt_level The optimization level
    * \param name Name of the pass.
    * \param required  The passes that are required to perform the current pass.
+   * \param parallel Whether a function pass may run over functions in parallel.
    */
-  TVM_DLL PassInfo(int opt_level, String name, Array<runtime::String> required);
+  TVM_DLL PassInfo(int opt_level, String name, Array<runtime::String> required,
+                   bool parallel = false);
 
   TVM_DEFINE_OBJECT_REF_METHODS(PassInfo, ObjectRef, PassInfoNode);
 };
@@ -179,6 +179,18 @@ class DatabaseNode : public runtime::Object {
    * \return An array of top K tuning records for the given workload.
    */
   virtual Array<TuningRecord> GetTopK(const Workload& workload, int top_k) = 0;
+  /*!
+   * \brief Get the best records of workloads other than the given one, for
+   * cross-task warm starting. Whether a foreign trace fits the queried
+   * workload is decided by the caller replaying it; backends without an
+   * efficient way to enumerate may return empty (the default).
+   * \param workload The workload whose own records should be excluded.
+   * \param top_k The maximum number of records to return.
+   * \return An array of collected records.
+   */
+  virtual Array<TuningRecord> GetTopKOtherWorkloads(const Workload& workload, int top_k) {
+    return {};
+  }
   /*!
    * \brief Get the size of the database.
    * \return The size of the database.
@@ -259,6 +259,29 @@ class TaskScheduler : public runtime::ObjectRef {
                                           Database database,               //
                                           Optional<CostModel> cost_model,  //
                                           Optional<Array<MeasureCallback>> measure_callbacks);
+  /*!
+   * \brief Create a task scheduler that allocates trials by predicted
+   * end-to-end latency improvement per task.
+   * \param tasks The tasks to be tuned.
+   * \param task_weights The weight of each task (e.g. occurrence count).
+   * \param alpha Multiplier of the exploration term.
+   * \param window_size Trailing window of the improvement-rate estimate.
+   * \param builder The builder of the scheduler.
+   * \param runner The runner of the scheduler.
+   * \param database The database of the scheduler.
+   * \param cost_model The cost model of the scheduler.
+   * \param measure_callbacks The measure callbacks of the scheduler.
+   * \return The task scheduler created.
+   */
+  TVM_DLL static TaskScheduler GradientBased(Array<TuneContext> tasks,        //
+                                             Array<FloatImm> task_weights,    //
+                                             double alpha,                    //
+                                             int window_size,                 //
+                                             Builder builder,                 //
+                                             Runner runner,                   //
+                                             Database database,               //
+                                             Optional<CostModel> cost_model,  //
+                                             Optional<Array<MeasureCallback>> measure_callbacks);
   /*!
    * \brief Create a task scheduler with customized methods on the python-side.
    * \param tasks The tasks to be tuned.
@@ -47,5 +47,23 @@ TVM_DLL std::string SaveJSON(const runtime::ObjectRef& node);
  */
 TVM_DLL runtime::ObjectRef LoadJSON(std::string json_str);
 
+/*!
+ * \brief Save the node in a compact binary format.
+ *
+ *  Same reflection-driven graph as SaveJSON, but varint-encoded with an
+ *  interned string table and raw (not base64) tensor payloads; intended for
+ *  high-volume round-trips such as tuning databases and cached IRModules.
+ * \param node The node to be saved.
+ * \return The binary blob.
+ */
+TVM_DLL std::string SaveBinary(const runtime::ObjectRef& node);
+
+/*!
+ * \brief Load a node from a blob produced by SaveBinary.
+ * \param data The binary blob.
+ * \return The loaded node.
+ */
+TVM_DLL runtime::ObjectRef LoadBinary(const std::string& data);
+
 }  // namespace tvm
 #endif  // TVM_NODE_SERIALIZATION_H_
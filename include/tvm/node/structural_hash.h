@@ -83,6 +83,30 @@ class StructuralHash : public BaseValueHash {
   TVM_DLL size_t operator()(const ObjectRef& key) const;
 };
 
+/*!
+ * \brief RAII scope that memoizes whole-object StructuralHash results.
+ *
+ *  While a scope is alive on the current thread, StructuralHash::operator()
+ *  caches its result per root object, so repeated hashing of unchanged
+ *  subtrees (as done by passes like EliminateCommonSubexpr) costs one lookup.
+ *  Soundness follows from IR nodes being immutable: a given object always
+ *  hashes to the same value. The table holds strong references, keeping the
+ *  cached objects alive for the duration of the scope; scopes may nest, with
+ *  the outermost owning the table.
+ */
+class TVM_DLL StructuralHashMemoScope {
+ public:
+  StructuralHashMemoScope();
+  ~StructuralHashMemoScope();
+
+  StructuralHashMemoScope(const StructuralHashMemoScope&) = delete;
+  StructuralHashMemoScope& operator=(const StructuralHashMemoScope&) = delete;
+
+ private:
+  /*! \brief Whether this scope owns (and will clear) the thread's table. */
+  bool owns_table_{false};
+};
+
 /*!
  * \brief A Reducer class to reduce the structural hash value.
  *
@@ -55,12 +55,14 @@ using Sequential = tvm::transform::Sequential;
  * \param opt_level The optimization level of the function pass.
  * \param name The name of the function pass.
  * \param required The list of the passes that the function pass is dependent on.
+ * \param parallel Whether the pass function is thread-safe and may be mapped
+ * over the module's functions in parallel.
  *
  * \return The created function pass.
  */
 TVM_DLL Pass CreateFunctionPass(
     const runtime::TypedPackedFunc<Function(Function, IRModule, PassContext)>& pass_func,
-    int opt_level, String name, tvm::Array<String> required);
+    int opt_level, String name, tvm::Array<String> required, bool parallel = false);
 
 /*! \brief Remove let-bound expressions which do not effect the program result.
  *
@@ -88,6 +90,29 @@ TVM_DLL Pass CreateFunctionPass(
  */
 TVM_DLL Pass DeadCodeElimination(bool inline_once = false, bool ignore_purity = false);
 
+/*!
+ * \brief Prune function parameters that are never read, rewriting every
+ * direct call site; functions escaping as values or carrying an external
+ * compiler attribute keep their signature. Run DeadCodeElimination after to
+ * reclaim the bindings the dropped arguments referenced.
+ *
+ * \return the pass.
+ */
+TVM_DLL Pass PruneDeadParameters();
+
+/*!
+ * \brief Deduplicate identical small constants into canonical shared nodes.
+ *
+ * Frontend imports materialize many identical small constants (zero biases,
+ * scale scalars); interning them by content shrinks the module and lets
+ * pointer-keyed memoization fire across former duplicates. The size
+ * threshold comes from the "relay.InternConstants.max_bytes" config
+ * (default 1024).
+ *
+ * \return The pass.
+ */
+TVM_DLL Pass InternConstants();
+
 /*!
  * \brief Convert all expressions of TensorType into GradCell,
  * an algebraic data type defined in gradient.rly.
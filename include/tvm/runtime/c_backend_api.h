@@ -153,6 +153,37 @@ TVM_DLL int TVMBackendParallelLaunch(FTVMParallelLambda flambda, void* cdata, in
  */
 TVM_DLL int TVMBackendParallelBarrier(int task_id, TVMParallelGroupEnv* penv);
 
+/*!
+ * \brief Combiner for TVMBackendParallelTreeReduce.
+ *
+ *  Folds the partial result at \p src into the one at \p dst.
+ * \param dst The accumulating partial result.
+ * \param src The partial result to fold in.
+ * \param cdata The closure data passed through from the reduction call.
+ */
+typedef void (*FTVMParallelReduceCombiner)(void* dst, const void* src, void* cdata);
+
+/*!
+ * \brief Log-depth tree combine of per-task partial results.
+ *
+ *  Each task of a parallel group first writes its partial result into
+ *  partials + task_id * elem_bytes, then calls this function; on return the
+ *  combined result of all tasks is in slot 0. The combine runs in log2(n)
+ *  barrier-separated rounds instead of funneling every partial through
+ *  worker 0 or an atomic, so large reductions scale across cores. Kernels
+ *  can invoke it from TIR through call_extern.
+ * \param task_id the task id of the function.
+ * \param penv The parallel environment backs the execution.
+ * \param partials The per-task partial result slots, num_task entries.
+ * \param elem_bytes The size in bytes of one partial result slot.
+ * \param combiner The combiner folding one slot into another.
+ * \param cdata The closure data handed to the combiner.
+ * \return 0 when no error is thrown, -1 when failure happens.
+ */
+TVM_DLL int TVMBackendParallelTreeReduce(int task_id, TVMParallelGroupEnv* penv, void* partials,
+                                         int64_t elem_bytes, FTVMParallelReduceCombiner combiner,
+                                         void* cdata);
+
 /*!
  * \brief Simple static initialization function.
  *  Run f once and set handle to be not null.
@@ -433,6 +433,18 @@ TVM_DLL int TVMArrayCopyFromTo(TVMArrayHandle from, TVMArrayHandle to, TVMStream
  */
 TVM_DLL int TVMArrayFromDLPack(DLManagedTensor* from, TVMArrayHandle* out);
 
+/*!
+ * \brief Produce a borrowed NDArray view over an external DLTensor.
+ *
+ *  No ownership transfer: the caller must keep the tensor alive for the
+ *  view's lifetime, and TVM never invokes a deleter for it. Intended for
+ *  call-scoped interop where the managed-tensor round trip is overhead.
+ * \param from The source DLTensor, borrowed.
+ * \param out The output array handle.
+ * \return 0 when success, nonzero when failure happens.
+ */
+TVM_DLL int TVMArrayFromDLPackBorrowed(DLTensor* from, TVMArrayHandle* out);
+
 /*!
  * \brief Produce a DLMangedTensor from the array that shares data memory with
  * the array.
@@ -564,6 +576,17 @@ TVM_DLL int TVMByteArrayFree(TVMByteArray* arr);
  * \param out_data The allocated device pointer.
  * \return 0 when success, nonzero when failure happens
  */
+/*!
+ * \brief Release memory the runtime caches for reuse (e.g. workspace pool
+ *  free pages) on the given device, so long-running services can give memory
+ *  back between traffic peaks. Outstanding allocations are unaffected. For
+ *  backends with thread-local caches this releases the calling thread's
+ *  cache, so invoke it from the threads that ran inference.
+ * \param dev The device to release cached memory for.
+ * \return 0 when success, nonzero when failure happens.
+ */
+TVM_DLL int TVMDeviceReleaseUnusedMemory(DLDevice dev);
+
 TVM_DLL int TVMDeviceAllocDataSpace(DLDevice dev, size_t nbytes, size_t alignment,
                                     DLDataType type_hint, void** out_data);
 
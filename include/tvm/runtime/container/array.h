@@ -639,8 +639,12 @@ class Array : public ObjectRef {
       // do not have to make new space
       p->clear();
     } else {
-      // create new space
-      data_ = ArrayNode::Empty(cap);
+      // Round tiny arrays up to the growth base: 1-3 element arrays
+      // (shapes, call args) dominate creation counts, are routinely
+      // appended to right after construction, and the padding is a few
+      // pointers - this removes the 1->2->4 reallocation ladder without
+      // touching the container representation.
+      data_ = ArrayNode::Empty(std::max(cap, ArrayNode::kInitSize));
       p = GetArrayNode();
     }
     // To ensure exception safety, size is only incremented after the initialization succeeds
@@ -87,6 +87,36 @@ tvm_crt_error_t TVMPlatformMemoryFree(void* ptr, DLDevice dev);
  */
 tvm_crt_error_t TVMPlatformTimerStart();
 
+/*!
+ * \brief Provide the executable RAM region backing the resident kernel slot.
+ *
+ * Flashless iterative measurement copies candidate kernel blobs here. The
+ * weak default hands out a static buffer, which suffices on hosts and
+ * flat-memory devices; platforms with protected or non-unified memory
+ * override it with a region mapped for execution.
+ *
+ * \param num_bytes Number of bytes the blob needs.
+ * \param out_ptr A pointer to the region, set on success.
+ * \return kTvmErrorNoError on success, kTvmErrorPlatformNoMemory when the
+ *         region is too small.
+ */
+tvm_crt_error_t TVMPlatformExecutableMemory(size_t num_bytes, void** out_ptr);
+
+/*!
+ * \brief Make freshly written code visible to the instruction fetch path.
+ *
+ * Weak no-op default for coherent hosts; cores with split caches override
+ * it with the architectural clean/invalidate sequence.
+ *
+ * \param addr Start of the written region.
+ * \param num_bytes Size of the written region.
+ * \return kTvmErrorNoError on success.
+ */
+tvm_crt_error_t TVMPlatformFlushICache(void* addr, size_t num_bytes);
+
+/*! \brief Register the kernel-slot installer; called by TVMInitializeRuntime. */
+tvm_crt_error_t TVMKernelSlotInit(void);
+
 /*! \brief Stop the running device timer and get the elapsed time (in microseconds).
  *
  * The device timer used must be running.
@@ -195,6 +195,13 @@ class TVM_DLL DeviceAPI {
    * \param ptr The pointer to be freed.
    */
   virtual void FreeWorkspace(Device dev, void* ptr);
+  /*!
+   * \brief Release memory cached for reuse (e.g. workspace pool free pages)
+   * back to the device. Outstanding allocations are unaffected; backends
+   * without a cache treat this as a no-op.
+   * \param dev The device to release cached memory for.
+   */
+  virtual void ReleaseUnusedMemory(Device dev) {}
 
   /*!
    * \brief Get device API based on device.
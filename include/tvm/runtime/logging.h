@@ -671,6 +671,37 @@ TVM_CHECK_FUNC(_NE, !=)
 
 #define TVM_ICHECK_INDENT "  "
 
+#if defined(TVM_RUNTIME_UNCHECKED)
+
+/*
+ * Unchecked runtime mode: ICHECK conditions become unreachability hints
+ * instead of branches to the logging path, returning their branch-predictor
+ * and icache budget to the hot loops that contain them. Only build with this
+ * after the deployed artifacts have been validated once under a checked
+ * build: a condition that would have failed is undefined behavior here.
+ * CHECK and its variants are unaffected - they guard user input, not
+ * internal invariants.
+ */
+#if defined(_MSC_VER)
+#define TVM_ICHECK_UNREACHABLE() __assume(0)
+#else
+#define TVM_ICHECK_UNREACHABLE() __builtin_unreachable()
+#endif
+
+#define ICHECK(x)                \
+  ((x) ? (void)0 : TVM_ICHECK_UNREACHABLE()), \
+      true ? (void)0 : ::tvm::runtime::detail::LogMessageVoidify() & LOG_FATAL
+
+#define ICHECK_LT(x, y) ICHECK((x) < (y))
+#define ICHECK_GT(x, y) ICHECK((x) > (y))
+#define ICHECK_LE(x, y) ICHECK((x) <= (y))
+#define ICHECK_GE(x, y) ICHECK((x) >= (y))
+#define ICHECK_EQ(x, y) ICHECK((x) == (y))
+#define ICHECK_NE(x, y) ICHECK((x) != (y))
+#define ICHECK_NOTNULL(x) ((x) == nullptr ? (TVM_ICHECK_UNREACHABLE(), (x)) : (x))  // NOLINT(*)
+
+#else
+
 #define ICHECK_BINARY_OP(name, op, x, y)                                   \
   if (auto __tvm__log__err = ::tvm::runtime::detail::LogCheck##name(x, y)) \
   ::tvm::runtime::detail::LogFatal(__FILE__, __LINE__).stream()            \
@@ -695,6 +726,8 @@ TVM_CHECK_FUNC(_NE, !=)
                         << TVM_ICHECK_INDENT << "Check not null: " #x << ' ',     \
    (x) : (x))  // NOLINT(*)
 
+#endif  // TVM_RUNTIME_UNCHECKED
+
 }  // namespace runtime
 // Re-export error types
 using runtime::Error;
@@ -206,6 +206,22 @@ class TVM_DLL ModuleNode : public Object {
  private:
   /*! \brief Cache used by GetImport */
   std::unordered_map<std::string, std::shared_ptr<PackedFunc> > import_cache_;
+  /*!
+   * \brief The import DAG flattened into visit order, built lazily on the
+   * first environment lookup. Lookup misses then scan each module exactly
+   * once instead of re-walking shared subtrees recursively per level.
+   * Kept alive transitively by imports_; invalidated when imports change.
+   */
+  std::vector<ModuleNode*> flattened_imports_;
+  /*!
+   * \brief The import that resolved the most recent query. Executor setup
+   * resolves thousands of consecutive names that overwhelmingly live in one
+   * device module, so probing it first makes those lookups O(1) instead of
+   * a scan per name. Reset when imports change.
+   */
+  ModuleNode* last_resolver_{nullptr};
+  /*! \brief Build flattened_imports_ if imports exist and it is empty. */
+  void EnsureFlattenedImports();
 };
 
 /*!
@@ -223,12 +239,21 @@ constexpr const char* tvm_module_ctx = "__tvm_module_ctx";
 constexpr const char* tvm_dev_mblob = "__tvm_dev_mblob";
 /*! \brief Number of bytes of device module blob. */
 constexpr const char* tvm_dev_mblob_nbytes = "__tvm_dev_mblob_nbytes";
+/*! \brief Magic prefix marking a compressed device blob (TVM_EXPORT_COMPRESS). */
+constexpr const char* tvm_dev_mblob_compressed_magic = "TVMCOMP1";
 /*! \brief global function to set device */
 constexpr const char* tvm_set_device = "__tvm_set_device";
 /*! \brief Auxiliary counter to global barrier. */
 constexpr const char* tvm_global_barrier_state = "__tvm_global_barrier_state";
 /*! \brief Prepare the global barrier before kernels that uses global barrier. */
 constexpr const char* tvm_prepare_global_barrier = "__tvm_prepare_global_barrier";
+/*!
+ * \brief Function that resolves a function name to its raw
+ *  TVMBackendPackedCFunc address, letting callers skip the PackedFunc
+ *  marshalling on steady-state dispatch paths. Only library-backed modules
+ *  implement it.
+ */
+constexpr const char* tvm_lookup_packed_c_func = "__tvm_lookup_packed_c_func";
 /*! \brief Placeholder for the module's entry function. */
 constexpr const char* tvm_module_main = "__tvm_main__";
 /*! \brief Prefix for parameter symbols emitted into the main program. */
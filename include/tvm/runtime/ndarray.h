@@ -167,6 +167,17 @@ class NDArray : public ObjectRef {
    * \return The created NDArray view.
    */
   TVM_DLL static NDArray FromDLPack(DLManagedTensor* tensor);
+  /*!
+   * \brief Create a call-scoped borrowed view over an external DLTensor.
+   *
+   *  No ownership is transferred and no framework deleter is invoked: the
+   *  caller guarantees the external tensor (data and metadata) outlives the
+   *  returned NDArray. This removes the refcount/deleter round trip from
+   *  high-rate interop boundaries where tensors only live for one call.
+   * \param tensor The external tensor; borrowed, never freed by TVM.
+   * \return The borrowed view.
+   */
+  TVM_DLL static NDArray FromDLPackBorrowed(const DLTensor* tensor);
   /*!
    * \brief Function to copy data from one array to another.
    * \param from The source array.
@@ -294,6 +305,27 @@ class NDArray::Container : public Object, public NDArray::ContainerBase {
   using Object::DecRef;
   using Object::IncRef;
 
+  /*!
+   * \brief Pooled allocation for containers.
+   *
+   *  Containers are small, fixed-size, and churn heavily on tensor-allocating
+   *  hot paths; a thread-cached freelist keeps that churn off malloc. Routing
+   *  through the class operator keeps every allocation site and deleter in
+   *  the codebase consistent automatically.
+   */
+  TVM_DLL static void* operator new(size_t size);
+  /*! \brief Matching pooled deallocation; see operator new. */
+  TVM_DLL static void operator delete(void* ptr, size_t size);
+
+  /*!
+   * \brief Cached hash of the tensor contents, 0 when not yet computed.
+   *
+   *  Filled lazily by structural hashing of constant tensors; callers that
+   *  mutate a tensor after it was structurally hashed (the compiler never
+   *  does) must not rely on the cache.
+   */
+  mutable std::atomic<uint64_t> content_hash_{0};
+
   // Information for object protocol.
   static constexpr const uint32_t _type_index = TypeIndex::kRuntimeNDArray;
   static constexpr const uint32_t _type_child_slots = 0;
@@ -36,6 +36,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <new>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -70,6 +71,13 @@ class PackedFuncObj : public Object {
    */
   TVM_ALWAYS_INLINE void CallPacked(TVMArgs args, TVMRetValue* rv) const;
 
+  /*! \brief The static signature tag when this function carries a typed
+   *   direct-dispatch entry, else nullptr. */
+  const void* typed_signature() const { return typed_signature_; }
+  /*! \brief The typed entry, R(*)(const PackedFuncObj*, Args...) for the
+   *   signature in typed_signature(); only valid when the tag matches. */
+  void* f_call_typed() const { return f_call_typed_; }
+
   static constexpr const uint32_t _type_index = TypeIndex::kRuntimePackedFunc;
   static constexpr const char* _type_key = "runtime.PackedFunc";
   TVM_DECLARE_FINAL_OBJECT_INFO(PackedFuncObj, Object);
@@ -103,6 +111,10 @@ class PackedFuncObj : public Object {
 
   /*! \brief Internal callable function pointer used to call the packed function. */
   FCallPacked* f_call_packed_;
+  /*! \brief Signature tag of the typed direct entry, set by typed sub objects. */
+  const void* typed_signature_{nullptr};
+  /*! \brief Typed direct entry matching typed_signature_. */
+  void* f_call_typed_{nullptr};
 };
 
 /*! \brief Derived object class for constructing PackedFuncObj. */
@@ -792,6 +804,12 @@ class TVMRetValue : public TVMPODValue_ {
    * \param other The other return value.
    */
   TVMRetValue(TVMRetValue&& other) : TVMPODValue_(other.value_, other.type_code_) {
+    // A string living in the source's inline buffer cannot be stolen by
+    // pointer; move it into this value's own buffer instead.
+    if ((type_code_ == kTVMStr || type_code_ == kTVMBytes) && other.StrInInlineBuffer()) {
+      value_.v_handle = new (str_storage_) std::string(std::move(*other.ptr<std::string>()));
+      other.Clear();
+    }
     other.value_.v_handle = nullptr;
     other.type_code_ = kTVMNullptr;
   }
@@ -840,6 +858,11 @@ class TVMRetValue : public TVMPODValue_ {
     this->Clear();
     value_ = other.value_;
     type_code_ = other.type_code_;
+    if ((type_code_ == kTVMStr || type_code_ == kTVMBytes) && other.StrInInlineBuffer()) {
+      value_.v_handle = new (str_storage_) std::string(std::move(*other.ptr<std::string>()));
+      other.Clear();
+      other.value_.v_handle = nullptr;
+    }
     other.type_code_ = kTVMNullptr;
     return *this;
   }
@@ -885,11 +908,11 @@ class TVMRetValue : public TVMPODValue_ {
     return *this;
   }
   TVMRetValue& operator=(std::string value) {
-    this->SwitchToClass(kTVMStr, value);
+    this->SwitchToString(kTVMStr, std::move(value));
     return *this;
   }
   TVMRetValue& operator=(TVMByteArray value) {
-    this->SwitchToClass(kTVMBytes, std::string(value.data, value.size));
+    this->SwitchToString(kTVMBytes, std::string(value.data, value.size));
     return *this;
   }
   TVMRetValue& operator=(NDArray other) {
@@ -978,11 +1001,11 @@ class TVMRetValue : public TVMPODValue_ {
   void Assign(const T& other) {
     switch (other.type_code()) {
       case kTVMStr: {
-        SwitchToClass<std::string>(kTVMStr, other);
+        SwitchToString(kTVMStr, other.operator std::string());
         break;
       }
       case kTVMBytes: {
-        SwitchToClass<std::string>(kTVMBytes, other);
+        SwitchToString(kTVMBytes, other.operator std::string());
         break;
       }
       case kTVMPackedFuncHandle: {
@@ -1021,6 +1044,27 @@ class TVMRetValue : public TVMPODValue_ {
       type_code_ = type_code;
     }
   }
+  /*!
+   * \brief Store a string/bytes payload, constructing the std::string box in
+   * the inline buffer instead of on the heap. Small-payload returns (status
+   * strings, keys) then cost no allocation at all on top of std::string's
+   * own small-string storage.
+   */
+  void SwitchToString(int type_code, std::string v) {
+    if (type_code_ == type_code) {
+      *ptr<std::string>() = std::move(v);
+      return;
+    }
+    this->Clear();
+    type_code_ = type_code;
+    value_.v_handle = new (str_storage_) std::string(std::move(v));
+  }
+  /*! \brief Whether the string box lives in the inline buffer. */
+  bool StrInInlineBuffer() const {
+    return value_.v_handle == static_cast<const void*>(str_storage_);
+  }
+  /*! \brief Inline storage backing the string box; see SwitchToString. */
+  alignas(std::string) char str_storage_[sizeof(std::string)];
   template <typename T>
   void SwitchToClass(int type_code, T v) {
     if (type_code_ != type_code) {
@@ -1048,7 +1092,11 @@ class TVMRetValue : public TVMPODValue_ {
     switch (type_code_) {
       case kTVMStr:
       case kTVMBytes:
-        delete ptr<std::string>();
+        if (StrInInlineBuffer()) {
+          ptr<std::string>()->~basic_string();
+        } else {
+          delete ptr<std::string>();
+        }
         break;
       case kTVMPackedFuncHandle:
         static_cast<Object*>(value_.v_handle)->DecRef();
@@ -1517,32 +1565,90 @@ template <typename R, typename... Args>
 TypedPackedFunc<R(Args...)>::TypedPackedFunc(TVMMovableArgValueWithContext_&& value)
     : packed_(value.operator PackedFunc()) {}
 
+namespace detail {
+/*!
+ * \brief Address-identity tag for a static call signature.
+ *
+ *  One tag object per signature per binary; comparing addresses avoids
+ *  typeid (usable under -fno-rtti) and makes cross-shared-object calls
+ *  fall back to the packed path rather than direct-dispatching across an
+ *  ABI boundary.
+ */
+template <typename FSig>
+struct TypedSignatureTag {
+  static char tag;
+};
+template <typename FSig>
+char TypedSignatureTag<FSig>::tag;
+}  // namespace detail
+
+/*!
+ * \brief Packed function sub object that also keeps the statically typed
+ *  entry point of the lambda it wraps.
+ *
+ *  C++-to-C++ calls through a TypedPackedFunc of the exact same signature
+ *  then dispatch straight to the lambda - no TVMValue boxing, no type-code
+ *  round trip - while every other caller still goes through the packed
+ *  path. The signature tag lives on the base object so call sites can test
+ *  it without knowing the lambda type.
+ */
+template <typename FLambda, typename FSig>
+class TypedPackedFuncSubObj;
+
+template <typename FLambda, typename R, typename... Args>
+class TypedPackedFuncSubObj<FLambda, R(Args...)> : public PackedFuncObj {
+ public:
+  using TSelf = TypedPackedFuncSubObj<FLambda, R(Args...)>;
+  TypedPackedFuncSubObj(FLambda callable, std::string name)
+      : PackedFuncObj(CallPackedImpl), callable_(std::move(callable)), name_(std::move(name)) {
+    typed_signature_ = &detail::TypedSignatureTag<R(Args...)>::tag;
+    f_call_typed_ = reinterpret_cast<void*>(&CallTypedImpl);
+  }
+
+  mutable FLambda callable_;
+  std::string name_;
+
+ private:
+  static void CallPackedImpl(const PackedFuncObj* obj, TVMArgs args, TVMRetValue* rv) {
+    const TSelf* self = static_cast<const TSelf*>(obj);
+    if (args.size() != sizeof...(Args)) {
+      LOG(FATAL) << "Function " << (self->name_.empty() ? "<anonymous>" : self->name_)
+                 << " expects " << sizeof...(Args) << " arguments, but " << args.size()
+                 << " were provided.";
+    }
+    detail::unpack_call<R, sizeof...(Args)>(self->name_.empty() ? nullptr : &self->name_,
+                                            self->callable_, args, rv);
+  }
+
+  static R CallTypedImpl(const PackedFuncObj* obj, Args... args) {
+    const TSelf* self = static_cast<const TSelf*>(obj);
+    return self->callable_(std::forward<Args>(args)...);
+  }
+};
+
 template <typename R, typename... Args>
 template <typename FType>
 inline void TypedPackedFunc<R(Args...)>::AssignTypedLambda(FType flambda, std::string name) {
-  packed_ = PackedFunc([flambda, name](const TVMArgs& args, TVMRetValue* rv) {
-    if (args.size() != sizeof...(Args)) {
-      LOG(FATAL) << "Function " << name << " expects " << sizeof...(Args) << " arguments, but "
-                 << args.size() << " were provided.";
-    }
-    detail::unpack_call<R, sizeof...(Args)>(&name, flambda, args, rv);
-  });
+  packed_ = PackedFunc(
+      make_object<TypedPackedFuncSubObj<FType, R(Args...)>>(std::move(flambda), std::move(name)));
 }
 
 template <typename R, typename... Args>
 template <typename FType>
 inline void TypedPackedFunc<R(Args...)>::AssignTypedLambda(FType flambda) {
-  packed_ = PackedFunc([flambda](const TVMArgs& args, TVMRetValue* rv) {
-    if (args.size() != sizeof...(Args)) {
-      LOG(FATAL) << "Function <anonymous> expects " << sizeof...(Args) << " arguments, but "
-                 << args.size() << " were provided.";
-    }
-    detail::unpack_call<R, sizeof...(Args)>(nullptr, flambda, args, rv);
-  });
+  packed_ = PackedFunc(
+      make_object<TypedPackedFuncSubObj<FType, R(Args...)>>(std::move(flambda), std::string()));
 }
 
 template <typename R, typename... Args>
 TVM_ALWAYS_INLINE R TypedPackedFunc<R(Args...)>::operator()(Args... args) const {
+  // Same-binary direct dispatch: a function registered through a typed
+  // lambda of this exact signature is called without TVMValue boxing.
+  const auto* obj = static_cast<const PackedFuncObj*>(packed_.get());
+  if (obj != nullptr && obj->typed_signature() == &detail::TypedSignatureTag<R(Args...)>::tag) {
+    using FDirect = R (*)(const PackedFuncObj*, Args...);
+    return reinterpret_cast<FDirect>(obj->f_call_typed())(obj, std::forward<Args>(args)...);
+  }
   return detail::typed_packed_call_dispatcher<R>::run(packed_, std::forward<Args>(args)...);
 }
 
@@ -30,6 +30,7 @@
 #include <tvm/runtime/packed_func.h>
 #include <tvm/runtime/registry.h>
 
+#include <mutex>
 #include <stack>
 #include <string>
 #include <unordered_map>
@@ -415,6 +416,53 @@ class Profiler {
 };
 
 /* \brief A duration in time. */
+/*!
+ * \brief Low-overhead sampling recorder of op events.
+ *
+ *  Unlike Profiler, starting and stopping an event never synchronizes the
+ *  device: events hold their (possibly still in-flight) Timer in a bounded
+ *  ring buffer, overwriting the oldest entry when full, and timers are only
+ *  resolved when a report is requested. That keeps the recorder cheap enough
+ *  to stay enabled in production and still yield a Report-compatible view of
+ *  where time went.
+ */
+class TVM_DLL EventRecorder {
+ public:
+  /*!
+   * \brief Construct a recorder.
+   * \param capacity Maximum number of retained events.
+   */
+  explicit EventRecorder(size_t capacity = 65536) : capacity_(capacity) {}
+
+  /*!
+   * \brief Record one completed (but possibly not yet synced) op event.
+   * \param name The op name the event aggregates under.
+   * \param dev The device the op ran on.
+   * \param timer A stopped Timer for the op; resolved lazily at report time.
+   */
+  void Record(String name, Device dev, Timer timer);
+  /*!
+   * \brief Resolve all retained timers and aggregate them per op name into a
+   * Report. Clears the ring.
+   */
+  Report GetReport();
+  /*! \brief Global recorder instance used by executor sampling hooks. */
+  static EventRecorder* Global();
+
+ private:
+  struct Event {
+    String name;
+    Device dev;
+    Timer timer;
+  };
+  std::mutex mutex_;
+  size_t capacity_;
+  /*! \brief Ring of completed events. */
+  std::vector<Event> ring_;
+  /*! \brief Next write position in ring_ once it reached capacity. */
+  size_t next_{0};
+};
+
 class DurationNode : public Object {
  public:
   /* The duration as a floating point number of microseconds. */
@@ -64,21 +64,41 @@ class ThreadGroup {
   enum AffinityMode : int {
     kBig = 1,
     kLittle = -1,
+    /*! \brief Spread workers across NUMA nodes, or pin them to one node. */
+    kNuma = 2,
   };
 
   /*!
    * \brief configure the CPU id affinity
    *
-   * \param mode The preferred CPU type (1 = big, -1 = little).
+   * \param mode The preferred CPU type (1 = big, -1 = little, 2 = NUMA).
    * \param nthreads The number of threads to use (0 = use all).
    * \param exclude_worker0 Whether to use the main thread as a worker.
    *        If  `true`, worker0 will not be launched in a new thread and
    *        `worker_callback` will only be called for values >= 1. This
    *        allows use of the main thread as a worker.
+   * \param numa_node In kNuma mode, restrict all workers to this NUMA node;
+   *        -1 spreads workers round-robin across the nodes. Ignored by the
+   *        other modes.
    *
    * \return The number of workers to use.
    */
-  int Configure(AffinityMode mode, int nthreads, bool exclude_worker0);
+  int Configure(AffinityMode mode, int nthreads, bool exclude_worker0, int numa_node = -1);
+
+  /*!
+   * \brief Confine this pool to one of several disjoint worker groups.
+   *
+   * Splits the machine's cores into \p num_groups contiguous slices and pins
+   * every thread of this pool inside slice \p group_index, so several pools
+   * configured with distinct indices run concurrently without sharing cores.
+   *
+   * \param group_index Which slice this pool owns, in [0, num_groups).
+   * \param num_groups How many concurrent pools the cores are split across.
+   * \param exclude_worker0 Whether the main thread runs as a worker.
+   *
+   * \return The number of workers to use (the slice width).
+   */
+  int ConfigureGroup(int group_index, int num_groups, bool exclude_worker0);
 
  private:
   Impl* impl_;
@@ -126,6 +126,23 @@ class Executable : public ModuleNode {
    */
   void MoveLateBoundConstantsToFile(const std::string& path, size_t byte_limit);
 
+  /*!
+   * \brief As for \p MoveLateBoundConstantsToFile, but in the aligned format
+   * that \p LoadLateBoundConstantsFromFile memory-maps instead of copying.
+   */
+  void MoveLateBoundConstantsToAlignedFile(const std::string& path, size_t byte_limit);
+
+  /*!
+   * \brief Move constants of at least \p byte_limit bytes out of the executable,
+   * returning them keyed by their synthesized late-bound names.
+   */
+  Map<String, NDArray> MoveLateBoundConstantsToMap(size_t byte_limit);
+
+  /*!
+   * \brief Bind the given late-bound constants back into the executable.
+   */
+  void ApplyLateBoundConstants(Map<String, NDArray> map);
+
   /*!
    * \brief Restores the late-bound constants for the executable (if any) from given byte-stream.
    *
@@ -50,6 +50,7 @@ struct Buffer {
 enum AllocatorType {
   kNaive = 1,
   kPooled,
+  kSizeClass,
 };
 
 class Allocator {
@@ -80,6 +81,8 @@ class Allocator {
    *  \return The amount of memory currently allocated.
    */
   virtual size_t UsedMemory() const = 0;
+  /*! \brief Return cached but unused memory to the device, if any. */
+  virtual void ReleaseUnused() {}
 
  private:
   AllocatorType type_;
@@ -101,6 +104,27 @@ class MemoryManager {
    * \return The memory allocator.
    */
   static Allocator* GetAllocator(Device dev);
+  /*!
+   * \brief Cap the bytes TVM's allocators may hold on a device.
+   *
+   *  On budget pressure the pooled allocators first return their cached
+   *  blocks; an allocation that would still exceed the budget fails. Zero
+   *  (the default) means unlimited.
+   * \param dev The TVM device.
+   * \param budget_bytes The budget, or 0 to remove it.
+   */
+  static void SetDeviceBudget(Device dev, size_t budget_bytes);
+  /*! \brief The configured budget for a device; 0 when unlimited. */
+  static size_t GetDeviceBudget(Device dev);
+  /*! \brief Total bytes TVM allocators currently hold on a device. */
+  static size_t UsedBytes(Device dev);
+  /*!
+   * \brief Return every allocator's cached-but-unused memory on a device.
+   *
+   *  Safe to call from foreign frameworks sharing the process (exposed as
+   *  runtime.memory_manager.ReleaseUnused) when their own allocations fail.
+   */
+  static void ReleaseUnused(Device dev);
 
  private:
   MemoryManager() {}
@@ -108,6 +132,7 @@ class MemoryManager {
  private:
   std::mutex mu_;
   std::unordered_map<Device, std::unique_ptr<Allocator>> allocators_;
+  std::unordered_map<Device, size_t> budgets_;
 };
 
 /*! \brief An object representing a storage allocation. */
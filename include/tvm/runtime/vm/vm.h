@@ -25,6 +25,7 @@
 #define TVM_RUNTIME_VM_VM_H_
 
 #include <tvm/runtime/container/closure.h>
+#include <tvm/runtime/c_backend_api.h>
 #include <tvm/runtime/module.h>
 #include <tvm/runtime/object.h>
 #include <tvm/runtime/packed_func.h>
@@ -130,6 +131,16 @@ struct VMFrame {
         code(code),
         register_file(register_file_size),
         caller_return_register(0) {}
+
+  /*! \brief Construct a frame around a recycled register file buffer. */
+  VMFrame(Index pc, Index func_index, Index args, const Instruction* code,
+          std::vector<ObjectRef> register_file)
+      : pc(pc),
+        func_index(func_index),
+        args(args),
+        code(code),
+        register_file(std::move(register_file)),
+        caller_return_register(0) {}
 };
 
 /*!
@@ -164,11 +175,13 @@ class VirtualMachine : public runtime::ModuleNode {
    */
   virtual PackedFunc GetFunction(const std::string& name, const ObjectPtr<Object>& sptr_to_self);
 
-  virtual ~VirtualMachine() {}
+  virtual ~VirtualMachine();
 
   const char* type_key() const final { return "VirtualMachine"; }
 
-  VirtualMachine() : frames_(), func_index_(0), code_(nullptr), pc_(0), exec_(nullptr) {}
+  VirtualMachine() : frames_(), func_index_(0), code_(nullptr), pc_(0), exec_(nullptr) {
+    frames_.reserve(kInitialFrameCapacity);
+  }
 
   /*!
    * \brief load the executable for the virtual machine.
@@ -249,6 +262,18 @@ class VirtualMachine : public runtime::ModuleNode {
   /*! \brief Run VM dispatch loop. */
   void RunLoop();
 
+  /*!
+   * \brief Try to issue a window of consecutive InvokePacked instructions,
+   * starting at the current pc, onto the lookahead execution streams.
+   *
+   * Only instructions whose tensor arguments are pairwise non-overlapping are
+   * grouped, so the kernels may run concurrently; the default stream is
+   * synchronized with every lane after the group. Enabled by initializing the
+   * VM with TVM_VM_EXEC_STREAMS > 1 on a device with stream support.
+   * \return Whether a multi-instruction group was issued (and pc advanced).
+   */
+  bool TryInvokePackedMultiStream();
+
   /*! \brief Get device from the device list based on a given device index. */
   Device GetDevice(Index device_index) const;
   Allocator* GetAllocator(Index device_index) const;
@@ -289,8 +314,25 @@ class VirtualMachine : public runtime::ModuleNode {
  protected:
   /*! \brief The virtual machine's packed function table. */
   std::vector<PackedFunc> packed_funcs_;
+  /*!
+   * \brief Raw C entry points of packed_funcs_ when the library exposes
+   * them (nullptr otherwise); lets InvokePacked skip PackedFunc dispatch.
+   */
+  std::vector<TVMBackendPackedCFunc> raw_funcs_;
+  /*! \brief Reusable argument marshalling buffers for InvokePacked: shape
+   *   chains call many tiny kernels, and per-call heap allocation would
+   *   outweigh the scalar work inside them. */
+  std::vector<TVMValue> arg_values_scratch_;
+  std::vector<int> arg_codes_scratch_;
+  /*! \brief Initial call stack capacity, so shallow call chains never reallocate. */
+  static constexpr size_t kInitialFrameCapacity = 16;
   /*! \brief The current stack of call frames. */
   std::vector<VMFrame> frames_;
+  /*!
+   * \brief Register file buffers of completed frames, kept for reuse so the
+   * interpreter hot path does not pay a heap allocation per call.
+   */
+  std::vector<std::vector<ObjectRef>> free_register_files_;
   /*! \brief The fuction table index of the current function. */
   Index func_index_;
   /*! \brief The current pointer to the code section. */
@@ -311,6 +353,10 @@ class VirtualMachine : public runtime::ModuleNode {
   std::vector<Device> devices_;
   /*! \brief The cached memory allocators, one per device. */
   std::vector<Allocator*> allocators_;
+  /*! \brief The device the lookahead execution streams belong to. */
+  Device exec_stream_device_;
+  /*! \brief Lookahead execution streams, one per dispatch lane. */
+  std::vector<TVMStreamHandle> exec_streams_;
   /*!
    * \brief The constant pool for runtime. It caches the device dependent
    * object to avoid rellocation of constants during inference.
@@ -27,6 +27,7 @@
 #include <tvm/runtime/c_runtime_api.h>
 
 #include <functional>
+#include <mutex>
 #include <vector>
 
 namespace tvm {
@@ -64,6 +65,13 @@ TVM_DLL std::vector<std::vector<int>> rr_partitioner(int begin, int end, int ste
  * \note 1. Currently do not support nested parallel_for; 2. The order of execution in each thread
  * is not guaranteed, the for loop task should be thread independent and thread safe.
  */
+/*!
+ * \brief The mutex callers take (try-lock) before using parallel_for when a
+ *  concurrent caller may exist: only one parallel_for can run process-wide,
+ *  so losers of the race should fall back to their serial path.
+ */
+TVM_DLL std::mutex& ParallelForMutex();
+
 TVM_DLL void parallel_for(int begin, int end, const std::function<void(int)>& f, int step = 1,
                           const PartitionerFuncType partitioner = rr_partitioner);
 
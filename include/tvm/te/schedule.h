@@ -251,6 +251,14 @@ class Stage : public ObjectRef {
    * \return reference to self.
    */
   TVM_DLL Stage& double_buffer();  // NOLINT(*)
+  /*!
+   * \brief Rotate the stage's storage over num_stages slots so the producer
+   *  runs num_stages - 1 iterations ahead of the consumer (multi-stage
+   *  software pipelining; 2 equals double_buffer).
+   * \param num_stages The number of pipeline stages.
+   * \return reference to self.
+   */
+  TVM_DLL Stage& software_pipeline(int num_stages);  // NOLINT(*)
   /*!
    * \brief Compute current stage with rolling buffering.
    * \return reference to self.
@@ -498,6 +506,8 @@ class StageNode : public Object {
   bool is_output{false};
   /*! \brief Whether apply double buffer optimization to this stage */
   bool double_buffer{false};
+  /*! \brief Number of rotating buffer slots when double_buffer is set. */
+  int double_buffer_stages{2};
   /*! \brief Whether apply rolling buffer optimization to this stage */
   bool rolling_buffer{false};
   /*!
@@ -522,6 +532,7 @@ class StageNode : public Object {
     v->Visit("scope", &scope);
     v->Visit("is_output", &is_output);
     v->Visit("double_buffer", &double_buffer);
+    v->Visit("double_buffer_stages", &double_buffer_stages);
     v->Visit("group", &group);
     v->Visit("num_child_stages", &num_child_stages);
   }
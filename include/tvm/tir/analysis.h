@@ -95,6 +95,20 @@ TVM_DLL Array<Var> UndefinedVars(const PrimExpr& expr);
  */
 TVM_DLL CallEffectKind SideEffect(const PrimExpr& expr);
 
+/*!
+ * \brief Estimate the memory traffic of a PrimFunc per buffer.
+ *
+ *  Reports, per buffer, the no-cache bytes moved ("<name>.traffic": access
+ *  bytes scaled by the enclosing constant loop extents) and the unique
+ *  footprint ("<name>.footprint"); their ratio is the reuse a schedule must
+ *  keep in cache to avoid being bandwidth bound. Also reports
+ *  "__total_traffic" and the number of "__dynamic_extents" treated as one
+ *  iteration.
+ * \param func The function to analyze.
+ * \return The per-buffer metric map.
+ */
+TVM_DLL Map<String, Integer> EstimateMemoryTraffic(const PrimFunc& func);
+
 /*!
  * \brief Whether the given Stmt uses any var in the given variable set.
  * \param stmt The Stmt to be checked.
@@ -49,12 +49,14 @@ using tvm::transform::Sequential;
  * \param opt_level The optimization level of the function pass.
  * \param name The name of the function pass.
  * \param required The list of the passes that the function pass is dependent on.
+ * \param parallel Whether the pass function is thread-safe and may be mapped
+ * over the module's PrimFuncs in parallel.
  *
  * \return The created function pass.
  */
 TVM_DLL Pass CreatePrimFuncPass(
     const runtime::TypedPackedFunc<PrimFunc(PrimFunc, IRModule, PassContext)>& pass_func,
-    int opt_level, String name, tvm::Array<String> required);
+    int opt_level, String name, tvm::Array<String> required, bool parallel = false);
 
 /*!
  * \brief Inject prefetch instructions into stmt.
@@ -135,6 +137,22 @@ TVM_DLL Pass InjectVirtualThread();
  */
 TVM_DLL Pass InjectDoubleBuffer();
 
+/*!
+ * \brief Inject rolling buffers for buffers annotated with
+ *  rolling_buffer_scope, keeping cascaded-stage line buffers resident
+ *  instead of full intermediates.
+ * \return The pass.
+ */
+TVM_DLL Pass InjectRollingBuffer();
+
+/*!
+ * \brief Hoist loop-invariant integer division and modulo out of loops into
+ *  let bindings, so index chains left by buffer flattening stop paying
+ *  per-iteration integer divisions.
+ * \return The pass.
+ */
+TVM_DLL Pass HoistDivMod();
+
 /*!
  * \brief Rewrite storage allocation pattern.
  *  Moves the allocation to outer most possible scope.
@@ -62,6 +62,15 @@ Map<BufferInfo, PoolAllocation> GreedyByConflicts(const Array<BufferInfo>& buffe
  *
  * \return A Map of BufferInfo objects and their associated PoolAllocation
  */
+/*!
+ * \brief The Best-Fit algorithm: GreedyBySize's ordering with gap-filling
+ * placement, scaling to thousands of buffers where hill climbing does not.
+ *
+ * \return A map of pool allocations based on the provided BufferInfo objects
+ */
+Map<BufferInfo, PoolAllocation> BestFit(const Array<BufferInfo>& buffer_info_arr,
+                                        const Integer& memory_pressure);
+
 Map<BufferInfo, PoolAllocation> HillClimb(const Array<BufferInfo>& buffer_info_arr,
                                           const Integer& memory_pressure);
 
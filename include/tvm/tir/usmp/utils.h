@@ -41,6 +41,9 @@ constexpr const char* kUSMPEnableOption = "tir.usmp.enable";
  * \brief PassContext option to select the memory planning algorithm in USMP
  */
 constexpr const char* kUSMPAlgorithmOption = "tir.usmp.algorithm";
+/*! \brief PassContext option: function-local allocates at or below this many
+ *  bytes are left out of the pools and lowered as stack allocations. */
+constexpr const char* kUSMPStackAllocaMaxBytesOption = "tir.usmp.stack_alloca_max_bytes";
 
 namespace tir {
 namespace usmp {
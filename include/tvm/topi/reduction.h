@@ -189,6 +189,122 @@ inline Tensor CommReduce(const Tensor& data, const Array<Integer>& axis, FReduce
                       keepdims ? std::vector<int>() : real_axis);
 }
 
+/*!
+ * \brief Create a tiled tree reduction over a single axis.
+ *
+ * The axis is split into num_lanes contiguous chunks reduced independently
+ * (lane partial accumulators - the chunk loops vectorize and pipeline where
+ * the single sequential chain could not), and the partials are combined
+ * pairwise in a log2(num_lanes) tree. For floating-point sums this also
+ * bounds the accumulation error like classic pairwise summation, which is
+ * what long-axis fp16 reductions need. Falls back to CommReduce when the
+ * reduction is multi-axis, the extent is dynamic or not divisible by
+ * num_lanes, or num_lanes is not a power of two, so callers can use it
+ * unconditionally.
+ *
+ * \param data The input tensor.
+ * \param axis The axis along which the reduction is performed.
+ * \param func The reduction function eg. tvm::sum
+ * \param num_lanes The number of partial accumulators (power of two).
+ * \param keepdims If this is set to true, the axes which are reduced are
+ * left in the result as dimensions with size one.
+ * \param atleast1d Whether the output need to be atleast1d.
+ *
+ * \return The result tensor.
+ */
+inline Tensor CommReduceTree(const Tensor& data, const Array<Integer>& axis, FReduce func,
+                             int num_lanes = 8, bool keepdims = false, bool atleast1d = false) {
+  int ndim = static_cast<int>(data->shape.size());
+  ICHECK_NE(ndim, 0) << "Cannot reduce a 0 dim Tensor";
+  auto real_axis = GetRealAxis(ndim, axis);
+  const auto* extent = real_axis.size() == 1 ? data->shape[real_axis[0]].as<IntImmNode>() : nullptr;
+  bool pow2 = num_lanes > 1 && (num_lanes & (num_lanes - 1)) == 0;
+  if (extent == nullptr || !pow2 || extent->value % num_lanes != 0) {
+    return CommReduce(data, axis, func, keepdims, atleast1d);
+  }
+  const int red_dim = real_axis[0];
+  const int64_t chunk = extent->value / num_lanes;
+
+  auto shape_with_red_dim = [&](int64_t dim) {
+    Array<PrimExpr> shape;
+    for (int i = 0; i < ndim; ++i) {
+      shape.push_back(i == red_dim ? PrimExpr(static_cast<int32_t>(dim)) : data->shape[i]);
+    }
+    return shape;
+  };
+
+  // Stage 1: each lane reduces its contiguous chunk.
+  auto partial = tvm::te::compute(
+      shape_with_red_dim(num_lanes),
+      [&](const Array<Var>& indices) {
+        IterVar k = reduce_axis(Range(0, static_cast<int32_t>(chunk)), "k");
+        Array<PrimExpr> args;
+        for (int i = 0; i < ndim; ++i) {
+          args.push_back(i == red_dim ? indices[i] * static_cast<int32_t>(chunk) + k->var
+                                      : PrimExpr(indices[i]));
+        }
+        return func(data(args), {k}, {}, Span());
+      },
+      data->op->name + "_red_partial", kCommReduce);
+
+  // Stage 2: pairwise tree over the lane dimension.
+  Tensor cur = partial;
+  for (int width = num_lanes / 2; width >= 1; width /= 2) {
+    cur = tvm::te::compute(
+        shape_with_red_dim(width),
+        [&, width](const Array<Var>& indices) {
+          IterVar k2 = reduce_axis(Range(0, 2), "k2");
+          Array<PrimExpr> args;
+          for (int i = 0; i < ndim; ++i) {
+            args.push_back(i == red_dim ? indices[i] * 2 + k2->var : PrimExpr(indices[i]));
+          }
+          return func(cur(args), {k2}, {}, Span());
+        },
+        data->op->name + "_red_pair" + std::to_string(width), kCommReduce);
+  }
+
+  if (keepdims) {
+    return cur;  // the lane dimension is already extent 1 in place
+  }
+  // Squeeze the reduced dimension to match CommReduce's output shape.
+  auto target_shape = MakeReduceTargetShape(real_axis, data, /*keepdims=*/false, atleast1d);
+  Tensor final_stage = cur;
+  return tvm::te::compute(
+      target_shape,
+      [&, final_stage](const Array<Var>& indices) {
+        Array<PrimExpr> args;
+        int arg_counter = 0;
+        for (int i = 0; i < ndim; ++i) {
+          if (i == red_dim) {
+            args.push_back(0);
+          } else {
+            args.push_back(indices[arg_counter++]);
+          }
+        }
+        return final_stage(args);
+      },
+      data->op->name + "_red", kInjective);
+}
+
+/*!
+ * \brief Tree-reduction sum: lane partial accumulators combined pairwise.
+ *
+ * \param data The input tensor.
+ * \param axis The axis along which the sum is performed.
+ * \param num_lanes The number of partial accumulators (power of two).
+ * \param keepdims Keep the reduced axis as an extent-1 dimension.
+ * \param atleast1d Whether the output need to be atleast1d.
+ *
+ * \return The result tensor.
+ */
+inline Tensor tree_sum(const Tensor& data, const Array<Integer>& axis, int num_lanes = 8,
+                       bool keepdims = false, bool atleast1d = false) {
+  if (data->dtype.is_bool()) {
+    return CommReduce(data, axis, tvm::all, keepdims, atleast1d);
+  }
+  return CommReduceTree(data, axis, tvm::sum, num_lanes, keepdims, atleast1d);
+}
+
 /*!
  * \brief Create an index reduction operation.
  *
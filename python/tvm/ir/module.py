@@ -88,6 +88,20 @@ class IRModule(Node):
                 var = _ty.GlobalTypeVar(var)
             _ffi_api.Module_AddDef(self, var, val, update)
 
+    def add_bulk(self, functions):
+        """Add many functions at once, deferring per-call invariant checks.
+
+        Frontend importers that assemble large modules one ``__setitem__``
+        at a time pay a per-function well-formedness analysis; this inserts
+        the whole batch with only the symbol-table invariants enforced.
+
+        Parameters
+        ----------
+        functions: dict of GlobalVar to Function
+            The functions to insert.
+        """
+        _ffi_api.Module_AddBulkUnchecked(self, functions)
+
     def __getitem__(self, var):
         """Lookup a global definition by name or by variable.
 
@@ -21,4 +21,5 @@ for measure candidates generation and measurement, then save
 records to the database.
 """
 from .task_scheduler import TaskScheduler, PyTaskScheduler
+from .gradient_based import GradientBased
 from .round_robin import RoundRobin
@@ -0,0 +1,87 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Gradient Based Task Scheduler"""
+
+from typing import List, Optional, TYPE_CHECKING
+
+from tvm._ffi import register_object
+from tvm.meta_schedule.measure_callback.measure_callback import MeasureCallback
+
+from ..builder import Builder
+from ..runner import Runner
+from ..database import Database
+from ..cost_model import CostModel
+from .task_scheduler import TaskScheduler
+
+from .. import _ffi_api
+
+if TYPE_CHECKING:
+    from ..tune_context import TuneContext
+
+
+@register_object("meta_schedule.GradientBased")
+class GradientBased(TaskScheduler):
+    """Gradient-based task scheduler: allocates measurement trials by the
+    predicted end-to-end latency improvement of each task instead of
+    uniformly, so converged tasks stop burning board time.
+
+    Parameters
+    ----------
+    tasks : List[TuneContext]
+        The list of tune contexts as tasks.
+    task_weights : List[float]
+        The weight of each task, e.g. its occurrence count in the model.
+    builder : Builder
+        The builder.
+    runner : Runner
+        The runner.
+    database : Database
+        The database.
+    alpha : float
+        The multiplier of the exploration term.
+    window_size : int
+        The trailing window of the improvement-rate estimate.
+    cost_model : Optional[CostModel]
+        The cost model of the scheduler.
+    measure_callbacks : Optional[List[MeasureCallback]]
+        The list of measure callbacks of the scheduler.
+    """
+
+    def __init__(
+        self,
+        tasks: List["TuneContext"],
+        task_weights: List[float],
+        builder: Builder,
+        runner: Runner,
+        database: Database,
+        alpha: float = 0.2,
+        window_size: int = 3,
+        cost_model: Optional[CostModel] = None,
+        measure_callbacks: Optional[List[MeasureCallback]] = None,
+    ) -> None:
+        self.__init_handle_by_constructor__(
+            _ffi_api.TaskSchedulerGradientBased,  # type: ignore # pylint: disable=no-member
+            tasks,
+            [float(w) for w in task_weights],
+            alpha,
+            window_size,
+            builder,
+            runner,
+            database,
+            cost_model,
+            measure_callbacks,
+        )
@@ -78,6 +78,13 @@ def _get_cache_key(source_func, target):
     return source_func
 
 
+_valid_implementations_cache = {}
+"""Resolved strategy results keyed by (op, attrs, static shapes, out type,
+target). Strategy dispatch re-enters Python per op occurrence, and repeated
+shapes dominate real models; implementations are plain compute/schedule
+function wrappers, so reusing the resolved list is sound for static shapes."""
+
+
 def get_valid_implementations(op, attrs, inputs, out_type, target):
     """Get all valid implementations from the op strategy.
 
@@ -105,6 +112,36 @@ def get_valid_implementations(op, attrs, inputs, out_type, target):
     ret : List[relay.op.OpImplementation]
         The list of all valid op implementations.
     """
+    cache_key = None
+    static_sig = []
+    for tensor in inputs:
+        dims = []
+        for dim in tensor.shape:
+            if not isinstance(dim, tvm.tir.IntImm):
+                static_sig = None
+                break
+            dims.append(int(dim))
+        if static_sig is None:
+            break
+        static_sig.append((tuple(dims), tensor.dtype))
+    if static_sig is not None:
+        # Strategies branch on the global auto-scheduler toggle, so it is
+        # part of the key: flipping it between compilations must not reuse
+        # the other mode's resolution.
+        from tvm.auto_scheduler import is_auto_scheduler_enabled  # deferred: import cycle
+
+        cache_key = (
+            op.name,
+            str(attrs),
+            tuple(static_sig),
+            str(out_type),
+            str(target),
+            bool(is_auto_scheduler_enabled()),
+        )
+        cached = _valid_implementations_cache.get(cache_key)
+        if cached is not None:
+            return cached
+
     fstrategy = op.get_attr("FTVMStrategy")
     assert fstrategy is not None, (
         "%s doesn't have an FTVMStrategy registered. You can register "
@@ -130,6 +167,10 @@ def get_valid_implementations(op, attrs, inputs, out_type, target):
         else:
             for impl in spec.implementations:
                 ret.append(impl)
+    if cache_key is not None:
+        if len(_valid_implementations_cache) >= 16384:
+            _valid_implementations_cache.clear()
+        _valid_implementations_cache[cache_key] = ret
     return ret
 
 
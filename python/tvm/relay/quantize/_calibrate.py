@@ -30,7 +30,6 @@ from .. import expr as _expr
 from .. import analysis as _analysis
 from .. import build_module as _build_module
 from ...contrib import graph_executor
-from .kl_divergence import _find_scale_by_kl
 
 
 def _get_profile_runtime(mod):
@@ -91,13 +90,42 @@ def collect_stats(mod, dataset, chunk_by=-1):
 
 
 def _kl_scale(mod, dataset):
+    """KL calibration through the native streaming statistics engine.
+
+    Two passes over the calibration dataset feed per-layer ranges and then
+    histograms into the C++ accumulator, and the KL threshold searches for
+    all layers run natively in parallel. Only the reduced statistics ever
+    cross the FFI boundary, so no activation tensors accumulate in Python.
+    """
     cfg = quantize.current_qconfig()
-    chunk_by = cfg.calibrate_chunk_by
-    scales = []
-    for samples in collect_stats(mod, dataset, chunk_by):
-        logging.info("finding threshold with kl for calibration...")
-        with mp.Pool() as pool:
-            scales += list(pool.map(_find_scale_by_kl, samples))
+    num_bins = 8001
+    runtime = _get_profile_runtime(mod)
+    num_outputs = runtime.get_num_outputs()
+    cpu_dev = tvm.cpu(0)
+
+    def _output_on_cpu(index):
+        out = runtime.get_output(index)
+        if out.device.device_type != cpu_dev.device_type:
+            out = out.copyto(cpu_dev)
+        return out
+
+    stats = _quantize.CreateCalibrationStats(num_outputs, num_bins)
+    logging.info("collecting ranges for calibration...")
+    for batch in dataset:
+        runtime.set_input(**batch)
+        runtime.run()
+        for j in range(num_outputs):
+            _quantize.CalibrationStatsObserveRange(stats, j, _output_on_cpu(j))
+    _quantize.CalibrationStatsBeginHistograms(stats)
+    logging.info("collecting histograms for calibration...")
+    for batch in dataset:
+        runtime.set_input(**batch)
+        runtime.run()
+        for j in range(num_outputs):
+            _quantize.CalibrationStatsObserveHistogram(stats, j, _output_on_cpu(j))
+    logging.info("finding threshold with kl for calibration...")
+    is_uint8 = cfg.dtype_activation == "uint8"
+    scales = list(_quantize.FindScaleByKLFromStats(stats, 255, is_uint8).numpy())
 
     def func(_):
         scale = scales[func.scale_idx]
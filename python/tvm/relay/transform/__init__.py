@@ -19,4 +19,5 @@
 # transformation passes
 from .transform import *
 from .recast import recast
+from .param_layout import bake_param_layouts
 from . import fake_quantization_to_integer, mixed_precision
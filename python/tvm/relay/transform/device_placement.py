@@ -0,0 +1,199 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Measurement-driven operator placement across heterogeneous devices.
+
+Manual ``on_device`` annotation lists per SKU rot as models and drivers
+change. This module measures each distinct operator of a model on every
+candidate device (single-op extraction, like task extraction does for
+tuning), then assigns each call to its fastest device unless the implied
+host/device transfer of its operands would cost more than the speedup,
+and finally emits the ``on_device`` annotations the device planner
+already consumes.
+"""
+import logging
+
+import numpy as np
+
+import tvm
+from tvm import relay
+from .. import expr as _expr
+from ..expr_functor import ExprMutator, ExprVisitor
+from ..op.annotation import on_device
+
+logger = logging.getLogger("device_placement")
+
+
+def _tensor_bytes(ttype):
+    size = np.dtype(ttype.dtype).itemsize
+    for dim in ttype.shape:
+        size *= int(dim)
+    return size
+
+
+def _call_signature(call):
+    """Measurement cache key: op, attrs text, and argument types."""
+    attrs = str(call.attrs) if call.attrs is not None else ""
+    types = ",".join(str(arg.checked_type) for arg in call.args)
+    return f"{call.op.name}|{attrs}|{types}|{call.checked_type}"
+
+
+def _measure_call(call, target, dev, number, repeat):
+    """Build the call as a one-op module and time it on the device."""
+    args = [_expr.var(f"p{i}", type_annotation=arg.checked_type) for i, arg in enumerate(call.args)]
+    func = _expr.Function(args, _expr.Call(call.op, args, call.attrs, call.type_args))
+    mod = tvm.IRModule.from_expr(func)
+    with tvm.transform.PassContext(opt_level=3):
+        lib = relay.build(mod, target=target)
+    from tvm.contrib import graph_executor  # deferred: contrib pulls runtime pieces
+
+    runtime = graph_executor.GraphModule(lib["default"](dev))
+    for i, arg in enumerate(call.args):
+        ttype = arg.checked_type
+        shape = [int(dim) for dim in ttype.shape]
+        runtime.set_input(i, np.random.uniform(-1, 1, size=shape).astype(ttype.dtype))
+    timer = runtime.module.time_evaluator("run", dev, number=number, repeat=repeat)
+    return timer().median
+
+
+class _CallCollector(ExprVisitor):
+    """Gather every call to a primitive op with fully static types."""
+
+    def __init__(self):
+        super().__init__()
+        self.calls = []
+
+    def visit_call(self, call):
+        super().visit_call(call)
+        if isinstance(call.op, tvm.ir.Op):
+            def _static_tensor(ttype):
+                return isinstance(ttype, relay.TensorType) and all(
+                    isinstance(dim, tvm.tir.IntImm) for dim in ttype.shape
+                )
+
+            if _static_tensor(call.checked_type) and all(
+                _static_tensor(arg.checked_type) for arg in call.args
+            ):
+                self.calls.append(call)
+
+
+def plan_placement(
+    mod, device_targets, bandwidth_bytes_per_s=8e9, number=3, repeat=3
+):
+    """Measure per-op cost on each device and assign a device per call.
+
+    Parameters
+    ----------
+    mod : tvm.IRModule
+        The model, with types inferred.
+
+    device_targets : dict of tvm.runtime.Device to target
+        Candidate devices and the target to compile with for each. The
+        first entry is the default (fallback) device.
+
+    bandwidth_bytes_per_s : float
+        Estimated host/device transfer bandwidth used to charge a crossing
+        penalty on operands and results when a call's device differs from
+        the default.
+
+    number, repeat : int
+        Measurement counts forwarded to ``time_evaluator``.
+
+    Returns
+    -------
+    mod : tvm.IRModule
+        The type-inferred module the plan is keyed on; pass this exact
+        module to :func:`annotate_placement`.
+
+    plan : dict of relay.Call to tvm.runtime.Device
+        The chosen device per measured call, keyed by node identity in the
+        returned module; calls that fail to build on a device are kept on
+        the default.
+    """
+    mod = relay.transform.InferType()(mod)
+    collector = _CallCollector()
+    collector.visit(mod["main"])
+
+    devices = list(device_targets.keys())
+    default_dev = devices[0]
+    cost_cache = {}
+    plan = {}
+    for call in collector.calls:
+        sig = _call_signature(call)
+        if sig not in cost_cache:
+            costs = {}
+            for dev in devices:
+                try:
+                    costs[dev] = _measure_call(
+                        call, device_targets[dev], dev, number, repeat
+                    )
+                except Exception as err:  # pylint: disable=broad-except
+                    logger.warning("placement: %s failed on %s: %s", call.op.name, dev, err)
+            cost_cache[sig] = costs
+        costs = cost_cache[sig]
+        if default_dev not in costs:
+            continue
+        best_dev = default_dev
+        best_cost = costs[default_dev]
+        transfer_bytes = sum(_tensor_bytes(arg.checked_type) for arg in call.args)
+        transfer_bytes += _tensor_bytes(call.checked_type)
+        # Worst-case crossing penalty: every operand and the result move.
+        # The planner later elides transfers between same-device neighbors,
+        # so this only under-approximates the benefit of clustering.
+        penalty = transfer_bytes / bandwidth_bytes_per_s
+        for dev, cost in costs.items():
+            if dev == default_dev:
+                continue
+            if cost + penalty < best_cost:
+                best_dev = dev
+                best_cost = cost + penalty
+        if best_dev != default_dev:
+            plan[call] = best_dev
+    return mod, plan
+
+
+class _Annotator(ExprMutator):
+    def __init__(self, plan):
+        super().__init__()
+        self._plan = plan
+
+    def visit_call(self, call):
+        new_call = super().visit_call(call)
+        dev = self._plan.get(call)
+        if dev is None:
+            return new_call
+        return on_device(new_call, dev, constrain_result=False, constrain_body=True)
+
+
+def annotate_placement(mod, plan):
+    """Apply a plan from :func:`plan_placement` to the module it returned.
+
+    The plan is keyed by node identity, so this must receive the same
+    module object ``plan_placement`` handed back; re-inferring types here
+    would rebuild nodes and orphan the plan.
+    """
+    main = mod["main"]
+    new_body = _Annotator(plan).visit(main.body)
+    mod["main"] = _expr.Function(
+        main.params, new_body, main.ret_type, main.type_params, main.attrs
+    )
+    return mod
+
+
+def auto_place(mod, device_targets, **kwargs):
+    """Measure, plan, and annotate in one step; see :func:`plan_placement`."""
+    typed_mod, plan = plan_placement(mod, device_targets, **kwargs)
+    return annotate_placement(typed_mod, plan)
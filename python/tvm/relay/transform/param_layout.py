@@ -0,0 +1,174 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Bake statically known parameter layout transforms into the stored weights.
+
+AlterOpLayout leaves ``layout_transform`` ops on parameters; with bound
+params constant folding removes them, but deployments with late-bound
+params (the VM path) re-run every transform at each model load, including
+a transient double allocation per weight. This utility rewrites the stored
+parameter bytes to the final layout at build time and drops the runtime
+transforms, for every parameter whose uses all agree on one transform.
+"""
+import tvm
+from .. import expr as _expr
+from ..expr_functor import ExprMutator
+
+
+def _collect_param_uses(main, param_vars):
+    """Classify every use site of each candidate parameter.
+
+    Returns (transforms, other_uses): transforms maps a param var to the
+    ``layout_transform`` calls consuming it as data, and other_uses holds
+    params consumed by anything else - any other call argument position,
+    tuple fields, let values, branch operands, direct returns, references,
+    or match scrutinees. Only params absent from other_uses may be baked;
+    missing a use site here would leave a dangling reference to a removed
+    var, so every expression kind with children is enumerated explicitly.
+    """
+    from .. import analysis as _analysis
+
+    param_set = set(param_vars)
+    transforms = {v: [] for v in param_vars}
+    other_uses = set()
+
+    def _mark(child):
+        if child in param_set:
+            other_uses.add(child)
+
+    def _fvisit(node):
+        if isinstance(node, _expr.Call):
+            is_transform = isinstance(node.op, tvm.ir.Op) and node.op.name == "layout_transform"
+            _mark(node.op)
+            for i, arg in enumerate(node.args):
+                if arg in param_set:
+                    if is_transform and i == 0:
+                        transforms[arg].append(node)
+                    else:
+                        other_uses.add(arg)
+        elif isinstance(node, _expr.Tuple):
+            for field in node.fields:
+                _mark(field)
+        elif isinstance(node, _expr.TupleGetItem):
+            _mark(node.tuple_value)
+        elif isinstance(node, _expr.Let):
+            _mark(node.value)
+            _mark(node.body)
+        elif isinstance(node, _expr.If):
+            _mark(node.cond)
+            _mark(node.true_branch)
+            _mark(node.false_branch)
+        elif isinstance(node, _expr.Function):
+            _mark(node.body)
+        elif isinstance(node, _expr.RefCreate):
+            _mark(node.value)
+        elif isinstance(node, _expr.RefRead):
+            _mark(node.ref)
+        elif isinstance(node, _expr.RefWrite):
+            _mark(node.ref)
+            _mark(node.value)
+        elif isinstance(node, tvm.relay.Match):
+            _mark(node.data)
+            for clause in node.clauses:
+                _mark(clause.rhs)
+
+    _analysis.post_order_visit(main, _fvisit)
+    return transforms, other_uses
+
+
+class _TransformEliminator(ExprMutator):
+    """Replace baked layout_transform(param) calls with the new param var."""
+
+    def __init__(self, replacements):
+        super().__init__()
+        self._replacements = replacements
+
+    def visit_call(self, call):
+        replacement = self._replacements.get(call)
+        if replacement is not None:
+            return replacement
+        return super().visit_call(call)
+
+
+def _run_transform(param_value, src_layout, dst_layout):
+    """Evaluate one layout_transform on the host to produce the new bytes."""
+    from tvm import relay  # deferred: this module is imported during relay init
+
+    var = _expr.var("p", shape=param_value.shape, dtype=param_value.dtype)
+    body = relay.layout_transform(var, src_layout, dst_layout)
+    func = _expr.Function([var], body)
+    with tvm.transform.PassContext(opt_level=0):
+        result = relay.create_executor(
+            "graph", mod=tvm.IRModule.from_expr(func), device=tvm.cpu(0), target="llvm"
+        ).evaluate()(param_value)
+    return result
+
+
+def bake_param_layouts(mod, params):
+    """Pre-transform parameters to their statically known final layouts.
+
+    Parameters
+    ----------
+    mod : tvm.IRModule
+        The optimized module (after AlterOpLayout etc.), with late-bound
+        parameters as free vars of ``main``.
+
+    params : dict of str to NDArray
+        The stored parameters.
+
+    Returns
+    -------
+    mod : tvm.IRModule
+        The module with the baked transforms removed.
+
+    params : dict of str to NDArray
+        The parameters rewritten to the target layouts.
+    """
+    from .transform import InferType  # deferred: imported during relay init
+
+    mod = InferType()(mod)
+    main = mod["main"]
+    param_vars = [v for v in main.params if v.name_hint in params]
+    transforms, other_uses = _collect_param_uses(main, param_vars)
+
+    replacements = {}
+    new_params = dict(params)
+    new_main_params = list(main.params)
+    for var in param_vars:
+        calls = transforms.get(var, [])
+        if not calls or var in other_uses:
+            continue
+        attrs = [(str(c.attrs.src_layout), str(c.attrs.dst_layout)) for c in calls]
+        # Only bake when every use agrees on one transform; a parameter
+        # consumed in two layouts must keep the runtime transforms.
+        if len(set(attrs)) != 1:
+            continue
+        src_layout, dst_layout = attrs[0]
+        transformed = _run_transform(params[var.name_hint], src_layout, dst_layout)
+        new_var = _expr.var(var.name_hint, shape=transformed.shape, dtype=transformed.dtype)
+        for call in calls:
+            replacements[call] = new_var
+        new_params[var.name_hint] = transformed
+        new_main_params[new_main_params.index(var)] = new_var
+
+    if not replacements:
+        return mod, params
+
+    new_body = _TransformEliminator(replacements).visit(main.body)
+    mod["main"] = _expr.Function(
+        new_main_params, new_body, main.ret_type, main.type_params, main.attrs
+    )
+    return InferType()(mod), new_params
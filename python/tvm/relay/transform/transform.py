@@ -1319,6 +1319,35 @@ def ToMixedPrecision(mixed_precision_type="float16", missing_op_mode=1):
     return _ffi_api.ToMixedPrecision(mixed_precision_type, missing_op_mode)
 
 
+def PruneDeadParameters():
+    """Drop function parameters whose bodies never read them.
+
+    Rewrites non-escaping global functions and every direct call site;
+    arguments are only dropped when trivial at all call sites so effects
+    are preserved. Runs InferType afterwards since signatures change.
+
+    Returns
+    -------
+    ret : tvm.transform.Pass
+        The registered pass.
+    """
+    return _ffi_api.PruneDeadParameters()
+
+
+def InternConstants():
+    """Deduplicate identical small constants into canonical shared nodes.
+
+    The size threshold comes from the "relay.InternConstants.max_bytes"
+    PassContext config (default 1024 bytes).
+
+    Returns
+    -------
+    ret : tvm.transform.Pass
+        The registered pass.
+    """
+    return _ffi_api.InternConstants()
+
+
 def SplitArgs(max_function_args):
     """Split function with huge number of arguments to smaller pieces.
 
@@ -257,6 +257,10 @@ class Module(object):
             where the first one is warm up and will be discarded.
             The returned result contains `repeat` costs,
             each of which is an average of `number` costs.
+            When the environment variable `TVM_TIME_EVALUATOR_CI` is set to a
+            relative half-width (e.g. ``0.05``), `repeat` acts as a hard cap
+            and measurement stops early once the confidence interval of the
+            median is narrow enough; the result then holds fewer costs.
 
         min_repeat_ms: int, optional
             The minimum duration of one `repeat` in milliseconds.
@@ -295,7 +299,9 @@ class Module(object):
                 """Internal wrapped evaluator."""
                 # Wrap feval so we can add more stats in future.
                 blob = feval(*args)
-                fmt = "@" + ("d" * repeat)
+                # With TVM_TIME_EVALUATOR_CI set the evaluator may stop early,
+                # so the blob can hold fewer than `repeat` costs.
+                fmt = "@" + ("d" * (len(blob) // 8))
                 results = struct.unpack(fmt, blob)
                 return BenchmarkResult(results)
 
@@ -465,8 +471,10 @@ class Module(object):
                 files.append(path_obj)
             else:
                 path_cc = os.path.join(workspace_dir, "devc.c")
-                with open(path_cc, "w") as f:
-                    f.write(_ffi_api.ModulePackImportsToC(self, is_system_lib))
+                # Stream straight to the file: the hex-encoded array is
+                # several times the serialized blob, and materializing it
+                # as a string spikes memory on GB-scale artifacts.
+                _ffi_api.ModulePackImportsToCFile(self, is_system_lib, path_cc)
                 files.append(path_cc)
 
         # The imports could contain a c module but the object format could be tar
@@ -511,6 +511,19 @@ class Stage(Object):
         """
         _ffi_api.StageDoubleBuffer(self)
 
+    def software_pipeline(self, num_stages=2):
+        """Compute the current stage via a multi-stage rotating buffer.
+
+        The producer runs num_stages - 1 iterations ahead of the consumer,
+        generalizing double_buffer to software pipelines with more stages.
+
+        Parameters
+        ----------
+        num_stages : int
+            The number of buffer slots to rotate over.
+        """
+        _ffi_api.StageSoftwarePipeline(self, num_stages)
+
     def rolling_buffer(self):
         """Compute the current stage via rolling buffering.
 
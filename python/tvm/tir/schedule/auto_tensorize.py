@@ -0,0 +1,124 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Automatic structural matching for tensorize.
+
+``tensorize`` demands that the caller hand it a loop nest that already
+mirrors the intrinsic's description exactly, which makes adopting a custom
+intrinsic a per-kernel manual exercise. :func:`auto_tensorize` performs the
+mechanical half automatically: it reads the intrinsic description's
+iteration extents, finds block loops whose extents are divisible by them,
+splits those loops, reorders the inner pieces to the intrinsic's order, and
+applies ``tensorize`` at the outermost matched inner loop. Kernels whose
+compute does not match the intrinsic's description still fail inside
+``tensorize``'s own comparator, so a successful return means the mapping is
+correct, not merely plausible.
+"""
+from tvm.tir.function import TensorIntrin
+
+
+def _desc_iter_extents(desc):
+    """The iteration extents of the description's (single) compute block."""
+    extents = []
+
+    def _collect(stmt):
+        # Walk down the single-branch loop nest of the description body.
+        import tvm.tir as _tir
+
+        node = stmt
+        while True:
+            if isinstance(node, _tir.For):
+                extents.append(int(node.extent))
+                node = node.body
+            elif isinstance(node, _tir.BlockRealize):
+                node = node.block.body
+            elif isinstance(node, _tir.Block):
+                node = node.body
+            elif isinstance(node, _tir.SeqStmt):
+                return
+            else:
+                return
+
+    _collect(desc.body)
+    return extents
+
+
+def auto_tensorize(sch, block, tensor_intrin):
+    """Match and apply a tensor intrinsic to a block's loop nest.
+
+    Parameters
+    ----------
+    sch : tvm.tir.Schedule
+        The schedule to transform.
+
+    block : BlockRV
+        The block whose loop nest is matched.
+
+    tensor_intrin : str
+        The registered TensorIntrin name.
+
+    Returns
+    -------
+    success : bool
+        True when a mapping was found and tensorize applied; False when the
+        loop structure cannot cover the intrinsic, in which case the
+        schedule is untouched. If the extents match but the block's compute
+        does not, tensorize's own comparator raises after the loops were
+        restructured - apply to a copy when probing speculatively.
+    """
+    intrin = TensorIntrin.get(tensor_intrin)
+    desc_extents = _desc_iter_extents(intrin.desc)
+    if not desc_extents:
+        return False
+
+    loops = list(sch.get_loops(block))
+    # Greedily assign each description iterator (innermost-first) to the
+    # innermost unassigned block loop whose extent it divides.
+    assignments = []  # (loop index, desc extent)
+    used = set()
+    for extent in reversed(desc_extents):
+        chosen = None
+        for idx in range(len(loops) - 1, -1, -1):
+            if idx in used:
+                continue
+            loop_extent = sch.get(loops[idx]).extent
+            if not hasattr(loop_extent, "value"):
+                continue
+            if int(loop_extent) % extent == 0:
+                chosen = idx
+                break
+        if chosen is None:
+            return False
+        used.add(chosen)
+        assignments.append((chosen, extent))
+
+    # Split each matched loop so its inner piece has exactly the intrinsic
+    # extent, then move the inner pieces innermost in description order.
+    inner_loops = {}
+    for idx, extent in assignments:
+        loop = loops[idx]
+        loop_extent = int(sch.get(loop).extent)
+        if loop_extent == extent:
+            inner_loops[idx] = loop
+        else:
+            _, inner = sch.split(loop, factors=[loop_extent // extent, extent])
+            inner_loops[idx] = inner
+    # assignments were collected innermost-desc-iter first; tensorize wants
+    # description order outer-to-inner.
+    ordered_inner = [inner_loops[idx] for idx, _ in reversed(assignments)]
+    sch.reorder(*ordered_inner)
+    sch.tensorize(ordered_inner[0], tensor_intrin)
+    return True
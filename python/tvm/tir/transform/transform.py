@@ -217,6 +217,19 @@ def InjectRollingBuffer():
     return _ffi_api.InjectRollingBuffer()  # type: ignore
 
 
+def HoistDivMod():
+    """Hoist loop-invariant integer division and modulo into let bindings
+    above the loop, removing per-iteration integer divisions from flattened
+    index chains.
+
+    Returns
+    -------
+    fpass : tvm.transform.Pass
+        The result pass
+    """
+    return _ffi_api.HoistDivMod()  # type: ignore
+
+
 def StorageRewrite():
     """Rewrite storage allocation pattern.
 
@@ -16,13 +16,15 @@
 # under the License.
 # pylint: disable=invalid-name,unused-variable,unused-argument,invalid-name
 """Conv2D schedule on for Intel CPU"""
+import os
+
 import tvm
 from tvm.autotvm.task.space import SplitEntity, OtherOptionEntity
 
 from ..generic import conv2d as conv2d_generic
 from ..utils import get_const_tuple
 from .tensor_intrin import dot_16x1x16_uint8_int8_int32
-from .utils import get_simd_32bit_lanes
+from .utils import get_simd_32bit_lanes, cache_aware_parallel
 
 
 def _fallback_schedule(cfg, wkl):
@@ -123,7 +125,18 @@ def _schedule_conv_NCHWc(s, cfg, data_vec, kernel_vec, conv_out, last):
     parallel_axis = s[C].fuse(batch, oc_chunk, oh)
     s[C].vectorize(oc_block)
     if C == O:
-        s[C].parallel(parallel_axis)
+        if os.environ.get("TVM_X86_CACHE_AWARE_PARALLEL"):
+            # Chunk the parallel loop so one worker's output slab (and the
+            # input rows it pulls) stays L2-resident on shared-L3 parts.
+            out_shape = get_const_tuple(O.shape)
+            itemsize = (tvm.runtime.DataType(O.dtype).bits + 7) // 8
+            # Rough per-traversal footprint: output plus one reuse of input.
+            working_set = 2 * itemsize
+            for dim in out_shape:
+                working_set *= dim
+            cache_aware_parallel(s, C, parallel_axis, working_set)
+        else:
+            s[C].parallel(parallel_axis)
 
     s[CC].compute_at(s[C], ow_chunk)
     _, oc_chunk, oh, ow, oc_block = s[CC].op.axis
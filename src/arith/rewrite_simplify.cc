@@ -1620,24 +1620,59 @@ PrimExpr RewriteSimplifier::Impl::VisitExpr_(const LetNode* op) {
   }
 }
 
+// Cap on memoized entries before the table recycles.
+//
+// The memo is deliberately per-analyzer rather than shared across functions
+// keyed by alpha-normalized fingerprints: a simplification is conditioned on
+// the analyzer's whole constraint environment (var bounds bound into the
+// const-int-bound analyzer, literal constraints, modular sets), and two
+// structurally identical expressions from different functions may sit under
+// different environments. A cross-function cache would need the environment
+// folded into the key - fingerprinting mutable sub-analyzer state - and a
+// stale hit silently miscompiles. Batch builds of structurally identical
+// kernels instead dedup one level up, where whole functions are compared
+// with free-var mapping and reused wholesale.
+static constexpr size_t kMemoLimit = 100000;
+
 PrimExpr RewriteSimplifier::operator()(const PrimExpr& expr) {
+  auto it = memo_.find(expr);
+  if (it != memo_.end()) {
+    return it->second;
+  }
   // Run simplification in post order
   PrimExpr res = expr;
   int max_iter = 2;
   for (int i = 0; i < max_iter; ++i) {
     PrimExpr new_expr = impl_->operator()(res);
-    if (new_expr.same_as(res)) return res;
+    if (new_expr.same_as(res)) break;
     res = new_expr;
   }
+  // Bound the table so one long-lived analyzer cannot grow without limit.
+  if (memo_.size() >= kMemoLimit) {
+    memo_.clear();
+  }
+  memo_.emplace(expr, res);
   return res;
 }
 
 void RewriteSimplifier::Update(const Var& var, const PrimExpr& info, bool allow_override) {
+  // Results are conditioned on the binding environment.
+  memo_.clear();
   impl_->Update(var, info, allow_override);
 }
 
 std::function<void()> RewriteSimplifier::EnterConstraint(const PrimExpr& constraint) {
-  return impl_->EnterConstraint(constraint);
+  // Results are conditioned on the constraint stack, both entering and
+  // leaving a scope.
+  memo_.clear();
+  std::function<void()> recover = impl_->EnterConstraint(constraint);
+  if (recover == nullptr) {
+    return recover;
+  }
+  return [this, recover]() {
+    memo_.clear();
+    recover();
+  };
 }
 
 RewriteSimplifier::RewriteSimplifier(Analyzer* parent) : impl_(new Impl(parent)) {}
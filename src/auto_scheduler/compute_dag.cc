@@ -22,6 +22,7 @@
  * \brief Compute declaration graph and its related analysis tools.
  */
 
+#include <dmlc/json.h>
 #include <tvm/auto_scheduler/compute_dag.h>
 #include <tvm/auto_scheduler/loop_state.h>
 #include <tvm/auto_scheduler/search_policy.h>
@@ -36,6 +37,7 @@
 #include <tvm/topi/transform.h>
 
 #include <algorithm>
+#include <mutex>
 #include <cstdint>
 #include <queue>
 #include <unordered_map>
@@ -1306,6 +1308,45 @@ String ComputeDAG::PrintDAG(bool simple_mode) const {
 State ComputeDAG::InferBound(const State& state) const {
   ICHECK(state->concrete) << "Only concrete state can be processed to get bound info.";
 
+  // The result is a pure function of (dag, transform steps), and evolutionary
+  // rounds re-infer surviving population members every generation; memoize on
+  // the steps' record serialization (steps carry no structural-equality
+  // reflection, but WriteToRecord is their exact canonical form). Bounded and
+  // mutex-guarded since batch InferBound runs under parallel_for.
+  struct BoundCacheEntry {
+    ComputeDAG dag;  // held strongly so the identity comparison stays valid
+    std::string steps_record;
+    State result;
+  };
+  static std::mutex bound_cache_mutex;
+  static std::unordered_map<size_t, std::vector<BoundCacheEntry>> bound_cache;
+  std::string steps_record;
+  {
+    std::ostringstream os;
+    dmlc::JSONWriter writer(&os);
+    writer.BeginArray(false);
+    for (const Step& step : state->transform_steps) {
+      writer.WriteArraySeperator();
+      writer.BeginArray(false);
+      step->WriteToRecord(&writer);
+      writer.EndArray();
+    }
+    writer.EndArray();
+    steps_record = os.str();
+  }
+  size_t cache_key = std::hash<std::string>()(steps_record);
+  {
+    std::lock_guard<std::mutex> lock(bound_cache_mutex);
+    auto it = bound_cache.find(cache_key);
+    if (it != bound_cache.end()) {
+      for (const BoundCacheEntry& entry : it->second) {
+        if (entry.dag.get() == get() && entry.steps_record == steps_record) {
+          return entry.result;
+        }
+      }
+    }
+  }
+
   State ret_state;
   StateNode* pstate;
 
@@ -1362,6 +1403,14 @@ State ComputeDAG::InferBound(const State& state) const {
         i, Stage(stage->op, stage->op_type, new_iters, stage->compute_at, stage->attrs));
   }
 
+  {
+    std::lock_guard<std::mutex> lock(bound_cache_mutex);
+    if (bound_cache.size() > 4096) {
+      bound_cache.clear();
+    }
+    bound_cache[cache_key].push_back(
+        BoundCacheEntry{GetRef<ComputeDAG>(operator->()), steps_record, ret_state});
+  }
   return ret_state;
 }
 
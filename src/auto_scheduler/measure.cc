@@ -22,10 +22,16 @@
  * \brief Distributed measurement infrastructure to measure the runtime costs of tensor programs.
  */
 
+#include <dmlc/json.h>
 #include <tvm/auto_scheduler/measure.h>
 #include <tvm/runtime/registry.h>
 
 #include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "search_policy/empty_policy.h"
 #include "search_policy/sketch_policy.h"
@@ -114,10 +120,101 @@ LocalBuilder::LocalBuilder(int timeout, int n_parallel, const String& build_func
   data_ = std::move(node);
 }
 
+namespace {
+
+/*!
+ * \brief Canonical key of one build candidate: workload plus the record
+ *  serialization of its transform steps (their exact canonical form; the
+ *  step objects carry no structural-equality reflection).
+ */
+std::string BuildCacheKey(const MeasureInput& input) {
+  std::ostringstream os;
+  os << input->task->workload_key << "|" << input->task->target->str() << "|";
+  dmlc::JSONWriter writer(&os);
+  writer.BeginArray(false);
+  for (const auto& step : input->state->transform_steps) {
+    writer.WriteArraySeperator();
+    writer.BeginArray(false);
+    step->WriteToRecord(&writer);
+    writer.EndArray();
+  }
+  writer.EndArray();
+  return os.str();
+}
+
+/*!
+ * \brief Bounded cache of build results within one search process.
+ *
+ *  Evolutionary mutation regenerates duplicate candidates constantly; an
+ *  exact transform-step match reuses the earlier artifact (the builder's
+ *  temp files live for the whole search) instead of re-lowering and
+ *  re-compiling. Only successful builds are cached so transient failures
+ *  retry.
+ */
+class LocalBuildCache {
+ public:
+  static LocalBuildCache* Global() {
+    static LocalBuildCache* inst = new LocalBuildCache();
+    return inst;
+  }
+
+  bool Lookup(const std::string& key, BuildResult* result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = cache_.find(key);
+    if (it == cache_.end()) return false;
+    *result = it->second;
+    return true;
+  }
+
+  void Insert(const std::string& key, const BuildResult& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cache_.size() >= kMaxEntries) {
+      cache_.clear();  // simple epoch reset; the search quickly re-warms it
+    }
+    cache_.emplace(key, result);
+  }
+
+ private:
+  static constexpr size_t kMaxEntries = 4096;
+  std::mutex mutex_;
+  std::unordered_map<std::string, BuildResult> cache_;
+};
+
+}  // namespace
+
 Array<BuildResult> LocalBuilderNode::Build(const Array<MeasureInput>& inputs, int verbose) {
   if (const auto* f = runtime::Registry::Get("auto_scheduler.local_builder.build")) {
-    Array<BuildResult> results = (*f)(inputs, timeout, n_parallel, build_func, verbose);
-    return results;
+    // Split cache hits from candidates that actually need building.
+    std::vector<std::string> keys;
+    keys.reserve(inputs.size());
+    std::vector<BuildResult> results(inputs.size());
+    std::vector<bool> hit(inputs.size(), false);
+    Array<MeasureInput> misses;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      keys.push_back(BuildCacheKey(inputs[i]));
+      hit[i] = LocalBuildCache::Global()->Lookup(keys[i], &results[i]);
+      if (!hit[i]) {
+        misses.push_back(inputs[i]);
+      }
+    }
+    Array<BuildResult> built;
+    if (!misses.empty()) {
+      built = (*f)(misses, timeout, n_parallel, build_func, verbose);
+    }
+    Array<BuildResult> out;
+    size_t next_built = 0;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      if (hit[i]) {
+        out.push_back(results[i]);
+        continue;
+      }
+      BuildResult res = built[next_built++];
+      if (res->error_no == 0) {
+        LocalBuildCache::Global()->Insert(keys[i], res);
+      }
+      out.push_back(res);
+    }
+    return out;
   }
   LOG(FATAL) << "auto_scheduler.local_builder.build is not registered. "
              << "This is a function registered in Python, "
@@ -28,7 +28,9 @@
 #include <tvm/auto_scheduler/transform_step.h>
 #include <tvm/runtime/registry.h>
 
+#include <algorithm>
 #include <fstream>
+#include <map>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -403,6 +405,86 @@ std::pair<Array<MeasureInput>, Array<MeasureResult>> RecordReaderNode::ReadLines
   return std::make_pair(inputs, results);
 }
 
+void RecordReaderNode::CompactTo(const String& out_filename, int top_k) {
+  // One pass: drop failed measurements, keep only the best result per exact
+  // (workload, target, schedule-config) key, then the top-k configs per
+  // workload by measured cost. Lines are carried through verbatim, so the
+  // output stays an ordinary record file every existing reader loads.
+  struct BestRecord {
+    double cost;
+    std::string line;
+  };
+  std::map<std::string, std::map<std::string, BestRecord>> per_workload;
+
+  std::ifstream infile_compact(filename, std::ifstream::in);
+  CHECK(infile_compact.good()) << "Cannot open " << filename;
+  std::string line;
+  auto inp = make_object<MeasureInputNode>();
+  auto res = make_object<MeasureResultNode>();
+  std::string log_version;
+  while (std::getline(infile_compact, line)) {
+    if (line.empty() || line[0] == '#' || line[0] == ' ') continue;
+    try {
+      ReadMeasureRecord(line, inp.get(), res.get(), &log_version);
+    } catch (const std::exception& e) {
+      continue;  // skip corrupt lines
+    }
+    if (res->error_no != static_cast<int>(MeasureErrorNO::kNoError)) continue;
+    if (res->costs.empty()) continue;
+    double cost = 0.0;
+    bool costs_valid = true;
+    for (const auto& c : res->costs) {
+      const auto* imm = c.as<FloatImmNode>();
+      if (imm == nullptr) {
+        costs_valid = false;
+        break;
+      }
+      cost += imm->value;
+    }
+    if (!costs_valid) continue;
+    cost /= res->costs.size();
+
+    std::string workload_group =
+        std::string(inp->task->workload_key) + "|" + inp->task->target->str();
+    std::ostringstream config_os;
+    {
+      dmlc::JSONWriter writer(&config_os);
+      writer.BeginArray(false);
+      for (const auto& step : inp->state->transform_steps) {
+        writer.WriteArraySeperator();
+        writer.BeginArray(false);
+        step->WriteToRecord(&writer);
+        writer.EndArray();
+      }
+      writer.EndArray();
+    }
+    std::string config_key = config_os.str();
+    auto& best = per_workload[workload_group];
+    auto it = best.find(config_key);
+    if (it == best.end() || cost < it->second.cost) {
+      best[config_key] = BestRecord{cost, line};
+    }
+  }
+
+  std::ofstream outfile(out_filename.operator std::string(), std::ofstream::out);
+  CHECK(outfile.good()) << "Cannot open " << out_filename << " for writing";
+  for (auto& kv : per_workload) {
+    std::vector<BestRecord*> records;
+    records.reserve(kv.second.size());
+    for (auto& entry : kv.second) {
+      records.push_back(&entry.second);
+    }
+    std::sort(records.begin(), records.end(),
+              [](const BestRecord* a, const BestRecord* b) { return a->cost < b->cost; });
+    int kept = 0;
+    for (BestRecord* record : records) {
+      if (top_k > 0 && kept >= top_k) break;
+      outfile << record->line << "\n";
+      ++kept;
+    }
+  }
+}
+
 TVM_REGISTER_GLOBAL("auto_scheduler.RecordToFile").set_body_typed([](const String& filename) {
   return RecordToFile(filename);
 });
@@ -417,6 +499,11 @@ TVM_REGISTER_GLOBAL("auto_scheduler.RecordReaderReadLines")
       return Array<ObjectRef>{res.first, res.second};
     });
 
+TVM_REGISTER_GLOBAL("auto_scheduler.RecordReaderCompactTo")
+    .set_body_typed([](RecordReader reader, const String& out_filename, int top_k) {
+      reader->CompactTo(out_filename, top_k);
+    });
+
 TVM_REGISTER_GLOBAL("auto_scheduler.RecordReaderReadNext").set_body_typed([](RecordReader reader) {
   auto inp = make_object<MeasureInputNode>();
   auto res = make_object<MeasureResultNode>();
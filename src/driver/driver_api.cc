@@ -24,6 +24,8 @@
 #include <dmlc/thread_local.h>
 #include <tvm/driver/driver_api.h>
 #include <tvm/ir/transform.h>
+#include <tvm/node/structural_equal.h>
+#include <tvm/node/structural_hash.h>
 #include <tvm/relay/executor.h>
 #include <tvm/relay/runtime.h>
 #include <tvm/runtime/registry.h>
@@ -34,6 +36,7 @@
 
 #include <algorithm>
 #include <mutex>
+#include <unordered_map>
 #include <stack>
 
 namespace tvm {
@@ -41,6 +44,7 @@ namespace tvm {
 // Register build pipeline related options
 TVM_REGISTER_PASS_CONFIG_OPTION("tir.noalias", Bool);
 TVM_REGISTER_PASS_CONFIG_OPTION("tir.detect_global_barrier", Bool);
+TVM_REGISTER_PASS_CONFIG_OPTION("tir.checkpoint_lowering", Bool);
 TVM_REGISTER_PASS_CONFIG_OPTION("tir.instrument_bound_checkers", Bool);
 TVM_REGISTER_PASS_CONFIG_OPTION("tir.disable_assert", Bool);
 TVM_REGISTER_PASS_CONFIG_OPTION("tir.disable_vectorize", Bool);
@@ -189,7 +193,15 @@ transform::Pass Filter(FCond fcond) {
   return tir::transform::CreatePrimFuncPass(fpass, 0, "Filter", {});
 }
 
-Array<tvm::transform::Pass> CreatePassList(bool disable_loop_partition) {
+/*!
+ * \brief Split point of CreatePassList's result for checkpointed lowering:
+ * everything before it is the schedule-shape-independent prefix (phases 0-1,
+ * flattening and canonicalization), everything after is the phase-2+ suffix
+ * that unroll/vectorize style experiments actually vary.
+ */
+Array<tvm::transform::Pass> CreatePassList(bool disable_loop_partition, size_t* phase2_start = nullptr);
+
+Array<tvm::transform::Pass> CreatePassList(bool disable_loop_partition, size_t* phase2_start) {
   transform::PassContext pass_ctx = transform::PassContext::Current();
 
   bool disable_vectorize = pass_ctx->GetConfig<Bool>("tir.disable_vectorize", Bool(false)).value();
@@ -240,6 +252,9 @@ Array<tvm::transform::Pass> CreatePassList(bool disable_loop_partition) {
 
   // PHASE 1
   pass_list.push_back(tir::transform::InjectPrefetch());
+  // Consumes rolling_buffer_scope annotations; must see BufferRealize, i.e.
+  // run before flattening. A no-op for unannotated schedules.
+  pass_list.push_back(tir::transform::InjectRollingBuffer());
   pass_list.push_back(tir::transform::TextureFlatten());
   pass_list.push_back(tir::transform::StorageFlatten(64, instrument_bound_checkers));
   pass_list.push_back(tir::transform::LowerCrossThreadReduction());
@@ -258,6 +273,10 @@ Array<tvm::transform::Pass> CreatePassList(bool disable_loop_partition) {
   // Add user-defined phase-1 passes
   pass_list.insert(pass_list.end(), user_lower_phase1.begin(), user_lower_phase1.end());
 
+  if (phase2_start != nullptr) {
+    *phase2_start = pass_list.size();
+  }
+
   // PHASE 2
   if (!disable_loop_partition) {
     pass_list.push_back(tir::transform::LoopPartition());
@@ -292,6 +311,62 @@ Array<tvm::transform::Pass> CreatePassList(bool disable_loop_partition) {
   return pass_list;
 }
 
+/*!
+ * \brief Apply the shared phase-0/1 prefix with a checkpoint cache.
+ *
+ *  Keyed by the structural hash of the input module; iterating on
+ *  target-dependent knobs (phase 2+ variants) then replays the cached
+ *  post-prefix IR instead of re-running flattening and canonicalization.
+ *  Opt-in (tir.checkpoint_lowering) because the cache assumes the pass
+ *  configuration affecting the prefix stays fixed within the session.
+ */
+IRModule ApplyCheckpointedPrefix(IRModule mod, Array<tvm::transform::Pass> prefix) {
+  struct Entry {
+    IRModule input;
+    IRModule lowered;
+  };
+  static std::mutex mutex;
+  static std::unordered_map<size_t, Entry> cache;
+  size_t key = tvm::StructuralHash()(mod);
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(key);
+    // A hash collision must degrade to a miss, never to wrong IR.
+    if (it != cache.end() && tvm::StructuralEqual()(it->second.input, mod)) {
+      return it->second.lowered;
+    }
+  }
+  IRModule input = mod;
+  IRModule lowered = tvm::transform::Sequential(prefix)(std::move(mod));
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (cache.size() > 128) cache.clear();
+    cache[key] = Entry{input, lowered};
+  }
+  return lowered;
+}
+
+IRModule LowerWithPassList(IRModule mod, Array<tvm::transform::Pass> pass_list);
+
+/*!
+ * \brief Lower with the standard pass list, optionally checkpointing the
+ * shared phase-0/1 prefix (tir.checkpoint_lowering=True).
+ */
+IRModule LowerWithCheckpoint(IRModule mod, bool simple_mode) {
+  size_t phase2_start = 0;
+  Array<transform::Pass> pass_list = CreatePassList(simple_mode, &phase2_start);
+  bool checkpoint = transform::PassContext::Current()
+                        ->GetConfig<Bool>("tir.checkpoint_lowering", Bool(false))
+                        .value();
+  if (checkpoint && phase2_start > 0 && phase2_start < pass_list.size()) {
+    Array<transform::Pass> prefix(pass_list.begin(), pass_list.begin() + phase2_start);
+    Array<transform::Pass> suffix(pass_list.begin() + phase2_start, pass_list.end());
+    mod = ApplyCheckpointedPrefix(std::move(mod), prefix);
+    return LowerWithPassList(std::move(mod), suffix);
+  }
+  return LowerWithPassList(std::move(mod), pass_list);
+}
+
 IRModule LowerWithPassList(IRModule mod, Array<tvm::transform::Pass> pass_list) {
   auto optimize = tvm::transform::Sequential(pass_list);
   mod = optimize(std::move(mod));
@@ -351,8 +426,7 @@ TVM_REGISTER_GLOBAL("driver.schedule_to_module")
     });
 
 IRModule LowerModule(IRModule mod, bool simple_mode) {
-  Array<transform::Pass> pass_list = CreatePassList(simple_mode);
-  return LowerWithPassList(std::move(mod), pass_list);
+  return LowerWithCheckpoint(std::move(mod), simple_mode);
 }
 
 TVM_REGISTER_GLOBAL("driver.lower_module").set_body_typed([](IRModule mod, bool simple_mode) {
@@ -370,9 +444,7 @@ IRModule LowerPrimFunc(tir::PrimFunc func, const std::string& name, bool simple_
   }
   IRModule mod = IRModule(Map<GlobalVar, BaseFunc>({{GlobalVar(name), f}}));
 
-  // Get the pass list
-  Array<transform::Pass> pass_list = CreatePassList(simple_mode);
-  return LowerWithPassList(std::move(mod), pass_list);
+  return LowerWithCheckpoint(std::move(mod), simple_mode);
 }
 
 TVM_REGISTER_GLOBAL("driver.lower_primfunc")
@@ -392,9 +464,7 @@ IRModule LowerSchedule(te::Schedule sch, const Array<te::Tensor>& args, const st
 IRModule LowerSchedule(te::Schedule sch, const Array<ObjectRef>& args, const std::string& name,
                        const std::unordered_map<te::Tensor, tir::Buffer>& binds, bool simple_mode) {
   IRModule mod = ScheduleToModule(std::move(sch), args, name, binds);
-  // Get the legacy TE pass list
-  Array<transform::Pass> pass_list = CreatePassList(simple_mode);
-  return LowerWithPassList(mod, pass_list);
+  return LowerWithCheckpoint(std::move(mod), simple_mode);
 }
 
 TVM_REGISTER_GLOBAL("driver.lower_schedule")
@@ -24,6 +24,8 @@
 #include <tvm/ir/expr.h>
 #include <tvm/ir/function.h>
 #include <tvm/runtime/registry.h>
+
+#include <array>
 // NOTE: reverse dependency on top/tir.
 // These dependencies do not happen at the interface-level,
 // and are only used in minimum cases where they are clearly marked.
@@ -55,6 +57,55 @@ PrimExpr PrimExpr::FromObject_(ObjectRef ref) {
   return Downcast<PrimExpr>(ref);
 }
 
+namespace {
+
+// Hash-consed pool of the immortal small integers that lowering materializes
+// endlessly (loop bounds, strides, zero/one constants). Sharing one node per
+// (dtype, value) cuts allocation churn and gives pointer-equality fast paths
+// in the structural comparisons downstream passes run on index trees.
+constexpr int64_t kConstIntCacheMin = -16;
+constexpr int64_t kConstIntCacheMax = 64;
+
+ObjectPtr<IntImmNode> MakeIntImmNode(DataType dtype, int64_t value, Span span) {
+  ObjectPtr<IntImmNode> node = make_object<IntImmNode>();
+  node->dtype = dtype;
+  node->value = value;
+  node->span = span;
+  return node;
+}
+
+const ObjectPtr<IntImmNode>* LookupCachedIntImm(DataType dtype, int64_t value) {
+  if (value < kConstIntCacheMin || value > kConstIntCacheMax) return nullptr;
+  int type_index;
+  if (dtype == DataType::Int(32)) {
+    type_index = 0;
+  } else if (dtype == DataType::Int(64)) {
+    type_index = 1;
+  } else if (dtype == DataType::Bool() && value >= 0 && value <= 1) {
+    type_index = 2;
+  } else {
+    return nullptr;
+  }
+  static const auto* cache = []() {
+    constexpr int num_values = kConstIntCacheMax - kConstIntCacheMin + 1;
+    auto* table = new std::array<ObjectPtr<IntImmNode>, 3 * num_values>();
+    for (int64_t v = kConstIntCacheMin; v <= kConstIntCacheMax; ++v) {
+      (*table)[v - kConstIntCacheMin] = MakeIntImmNode(DataType::Int(32), v, Span());
+      (*table)[num_values + (v - kConstIntCacheMin)] =
+          MakeIntImmNode(DataType::Int(64), v, Span());
+    }
+    (*table)[2 * num_values + 0 - kConstIntCacheMin] =
+        MakeIntImmNode(DataType::Bool(), 0, Span());
+    (*table)[2 * num_values + 1 - kConstIntCacheMin] =
+        MakeIntImmNode(DataType::Bool(), 1, Span());
+    return table;
+  }();
+  constexpr int num_values = kConstIntCacheMax - kConstIntCacheMin + 1;
+  return &(*cache)[type_index * num_values + (value - kConstIntCacheMin)];
+}
+
+}  // namespace
+
 IntImm::IntImm(DataType dtype, int64_t value, Span span) {
   ICHECK(dtype.is_scalar()) << "ValueError: IntImm can only take scalar, but " << dtype
                             << " was supplied.";
@@ -63,11 +114,13 @@ IntImm::IntImm(DataType dtype, int64_t value, Span span) {
   if (dtype.is_uint()) {
     ICHECK_GE(value, 0U);
   }
-  ObjectPtr<IntImmNode> node = make_object<IntImmNode>();
-  node->dtype = dtype;
-  node->value = value;
-  node->span = span;
-  data_ = std::move(node);
+  if (!span.defined()) {
+    if (const ObjectPtr<IntImmNode>* cached = LookupCachedIntImm(dtype, value)) {
+      data_ = *cached;
+      return;
+    }
+  }
+  data_ = MakeIntImmNode(dtype, value, span);
 }
 
 TVM_REGISTER_GLOBAL("ir.IntImm").set_body_typed([](DataType dtype, int64_t value, Span span) {
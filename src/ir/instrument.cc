@@ -27,6 +27,7 @@
 #include <tvm/node/repr_printer.h>
 #include <tvm/runtime/registry.h>
 
+#include <fstream>
 #include <stack>
 
 namespace tvm {
@@ -199,6 +200,27 @@ TVM_STATIC_IR_FUNCTOR(ReprPrinter, vtable)
       p->stream << node->name;
     });
 
+/*!
+ * \brief Peak resident set size of this process in bytes (VmHWM), or 0 when
+ * the platform does not expose it. Monotonic, so the per-pass delta
+ * attributes memory growth to the pass that caused it.
+ */
+int64_t GetPeakRSSBytes() {
+#if defined(__linux__)
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.rfind("VmHWM:", 0) == 0) {
+      std::istringstream is(line.substr(6));
+      int64_t kb = 0;
+      is >> kb;
+      return kb * 1024;
+    }
+  }
+#endif
+  return 0;
+}
+
 /*! \brief PassProfile stores profiling information for a given pass and its sub-passes. */
 struct PassProfile {
   // TODO(@altanh): expose PassProfile through TVM Object API
@@ -216,9 +238,17 @@ struct PassProfile {
   Duration duration;
   /*! \brief PassProfiles for all sub-passes invoked during the execution of the pass. */
   std::vector<PassProfile> children;
+  /*! \brief Peak RSS when the pass was entered, in bytes. */
+  int64_t peak_rss_start;
+  /*! \brief Growth of peak RSS attributable to the pass, in bytes. */
+  int64_t peak_rss_delta{0};
 
   explicit PassProfile(String name)
-      : name(name), start(Clock::now()), end(Clock::now()), children() {}
+      : name(name),
+        start(Clock::now()),
+        end(Clock::now()),
+        children(),
+        peak_rss_start(GetPeakRSSBytes()) {}
 
   /*! \brief Gets the PassProfile of the currently executing pass. */
   static PassProfile* Current();
@@ -251,6 +281,7 @@ void PassProfile::ExitPass() {
   ICHECK_NE(cur->name, "root") << "mismatched enter/exit for pass profiling";
   cur->end = PassProfile::Clock::now();
   cur->duration = std::chrono::duration_cast<PassProfile::Duration>(cur->end - cur->start);
+  cur->peak_rss_delta = GetPeakRSSBytes() - cur->peak_rss_start;
   PassProfileThreadLocalStore::Get()->profile_stack.pop();
 }
 
@@ -312,7 +343,12 @@ String RenderPassProfiles() {
     os << profile->name << ": ";
     os << std::setprecision(0);
     os << profile->duration.count() << "us [" << self_duration.count() << "us] ";
-    os << std::setprecision(2) << "(" << total_pct << "%; " << parent_pct << "%)\n";
+    os << std::setprecision(2) << "(" << total_pct << "%; " << parent_pct << "%)";
+    if (profile->peak_rss_delta > 0) {
+      os << " (+" << std::setprecision(2) << profile->peak_rss_delta / (1024.0 * 1024.0)
+         << " MB peak RSS)";
+    }
+    os << "\n";
   }
 
   return os.str();
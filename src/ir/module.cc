@@ -23,6 +23,7 @@
  */
 #include <tvm/ir/module.h>
 #include <tvm/node/structural_equal.h>
+#include <tvm/node/structural_hash.h>
 #include <tvm/runtime/registry.h>
 // NOTE: reverse dependency on relay.
 // These dependencies do not happen at the interface-level,
@@ -219,6 +220,25 @@ void IRModuleNode::AddUnchecked(const GlobalVar& var, const BaseFunc& func) {
   global_var_map_.Set(var->name_hint, var);
 }
 
+void IRModuleNode::AddBulkUnchecked(const Map<GlobalVar, BaseFunc>& funcs) {
+  // Validate the whole batch first, then insert. Going through Add would
+  // additionally run the per-function malformedness analysis (a DeDup copy
+  // plus free-variable scans per call), which is what dominates frontend
+  // import of many-thousand-function modules; like AddUnchecked, bulk
+  // insertion keeps only the symbol-table invariants.
+  for (const auto& kv : funcs) {
+    auto it = global_var_map_.find(kv.first->name_hint);
+    if (it != global_var_map_.end()) {
+      ICHECK_EQ((*it).second, kv.first)
+          << "Duplicate global function name " << PrettyPrint(kv.first);
+    }
+  }
+  for (const auto& kv : funcs) {
+    this->functions.Set(kv.first, kv.second);
+    this->global_var_map_.Set(kv.first->name_hint, kv.first);
+  }
+}
+
 void IRModuleNode::RegisterConstructors(const GlobalTypeVar& var, const TypeData& type) {
   // We hash the global type var name to use as a globally unique prefix for tags.
   // The hash will be used as the most significant byte of the tag, with the index of
@@ -452,6 +472,11 @@ TVM_REGISTER_GLOBAL("ir.IRModule")
       return IRModule(funcs, types, {});
     });
 
+TVM_REGISTER_GLOBAL("ir.Module_AddBulkUnchecked")
+    .set_body_typed([](IRModule mod, Map<GlobalVar, BaseFunc> funcs) {
+      mod->AddBulkUnchecked(funcs);
+    });
+
 TVM_REGISTER_GLOBAL("ir.Module_Add").set_body([](TVMArgs args, TVMRetValue* ret) {
   IRModule mod = args[0];
   GlobalVar var = args[1];
@@ -542,6 +567,67 @@ TVM_REGISTER_GLOBAL("ir.Module_GetAttr").set_body_typed([](IRModule mod, String
   return mod->GetAttr<ObjectRef>(key);
 });
 
+/*!
+ * \brief Per-function structural digests of a module.
+ *
+ *  One digest per global function, so downstream caches can key on
+ *  functions instead of whole modules. Structural hashing shares work
+ *  through the thread-local memo scope when one is active.
+ */
+Map<String, Integer> ModuleFunctionDigests(const IRModule& mod) {
+  Map<String, Integer> digests;
+  for (const auto& kv : mod->functions) {
+    int64_t digest = static_cast<int64_t>(StructuralHash()(kv.second));
+    digests.Set(kv.first->name_hint, Integer(digest));
+  }
+  return digests;
+}
+
+TVM_REGISTER_GLOBAL("ir.ModuleFunctionDigests").set_body_typed(ModuleFunctionDigests);
+
+/*!
+ * \brief Which functions changed between two module snapshots.
+ *
+ *  Passes copy-on-write: a function a pass left alone is the same object in
+ *  both modules, so the common all-unchanged answer costs only pointer
+ *  compares and no hashing. Only functions whose object changed are
+ *  structurally hashed to filter out identity rewrites. Returns a map with
+ *  "changed", "added", and "removed" name lists; an empty result means a
+ *  downstream consumer can reuse everything.
+ */
+Map<String, Array<String>> ModuleDiff(const IRModule& before, const IRModule& after) {
+  Array<String> changed;
+  Array<String> added;
+  Array<String> removed;
+  for (const auto& kv : after->functions) {
+    const String& name = kv.first->name_hint;
+    if (!before->ContainGlobalVar(name)) {
+      added.push_back(name);
+      continue;
+    }
+    BaseFunc before_func = before->Lookup(name);
+    if (before_func.same_as(kv.second)) {
+      continue;
+    }
+    if (StructuralHash()(before_func) != StructuralHash()(kv.second) ||
+        !StructuralEqual()(before_func, kv.second)) {
+      changed.push_back(name);
+    }
+  }
+  for (const auto& kv : before->functions) {
+    if (!after->ContainGlobalVar(kv.first->name_hint)) {
+      removed.push_back(kv.first->name_hint);
+    }
+  }
+  Map<String, Array<String>> result;
+  result.Set("changed", changed);
+  result.Set("added", added);
+  result.Set("removed", removed);
+  return result;
+}
+
+TVM_REGISTER_GLOBAL("ir.ModuleDiff").set_body_typed(ModuleDiff);
+
 TVM_STATIC_IR_FUNCTOR(ReprPrinter, vtable)
     .set_dispatch<IRModuleNode>([](const ObjectRef& ref, ReprPrinter* p) {
       auto* node = static_cast<const IRModuleNode*>(ref.get());
@@ -0,0 +1,188 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file gbt_predictor.cc
+ * \brief Native gradient-boosted-tree inference for tuning cost models.
+ *
+ *  Per-round prediction of thousands of candidates used to cross the FFI and
+ *  the Python GIL per call. This loads an XGBoost tree dump
+ *  (bst.get_dump(dump_format="json"), joined into one JSON array) into a
+ *  flat node table and scores whole feature matrices in C++ with one FFI
+ *  crossing per round: meta_schedule.GBTreesLoad / meta_schedule.GBTreesPredict.
+ *  Scores are raw margin sums, which is all candidate ranking needs.
+ */
+#include <picojson.h>
+#include <tvm/runtime/ndarray.h>
+#include <tvm/runtime/packed_func.h>
+#include <tvm/runtime/registry.h>
+
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tvm {
+namespace meta_schedule {
+
+using runtime::NDArray;
+
+/*! \brief A flattened decision-tree ensemble. */
+class GBTreesObj : public runtime::Object {
+ public:
+  /*! \brief One node of a tree in the flat table. */
+  struct Node {
+    /*! \brief Feature index to test; -1 marks a leaf. */
+    int feature{-1};
+    /*! \brief Split threshold: go left (yes) when value < threshold. */
+    float threshold{0.0f};
+    /*! \brief Index of the yes-branch node in the table. */
+    int yes{-1};
+    /*! \brief Index of the no-branch node in the table. */
+    int no{-1};
+    /*! \brief Index of the missing-value branch node in the table. */
+    int missing{-1};
+    /*! \brief Leaf response value. */
+    float leaf_value{0.0f};
+  };
+
+  /*! \brief All nodes of all trees. */
+  std::vector<Node> nodes;
+  /*! \brief Root index of each tree in nodes. */
+  std::vector<int> tree_roots;
+
+  /*! \brief Score one dense feature row: the sum of all tree responses. */
+  float PredictRow(const float* features, int64_t num_features) const {
+    float sum = 0.0f;
+    for (int root : tree_roots) {
+      int index = root;
+      while (nodes[index].feature >= 0) {
+        const Node& node = nodes[index];
+        if (node.feature >= num_features || std::isnan(features[node.feature])) {
+          index = node.missing;
+        } else if (features[node.feature] < node.threshold) {
+          index = node.yes;
+        } else {
+          index = node.no;
+        }
+      }
+      sum += nodes[index].leaf_value;
+    }
+    return sum;
+  }
+
+  static constexpr const uint32_t _type_index = runtime::TypeIndex::kDynamic;
+  static constexpr const char* _type_key = "meta_schedule.GBTrees";
+  TVM_DECLARE_FINAL_OBJECT_INFO(GBTreesObj, runtime::Object);
+};
+
+TVM_REGISTER_OBJECT_TYPE(GBTreesObj);
+
+class GBTrees : public runtime::ObjectRef {
+ public:
+  TVM_DEFINE_MUTABLE_OBJECT_REF_METHODS(GBTrees, runtime::ObjectRef, GBTreesObj);
+};
+
+namespace {
+
+/*!
+ * \brief Recursively flatten one dumped tree node.
+ * \return The index of the flattened node in the table.
+ */
+int FlattenTree(const picojson::object& node_json, std::vector<GBTreesObj::Node>* nodes) {
+  int index = static_cast<int>(nodes->size());
+  nodes->emplace_back();
+  auto leaf_it = node_json.find("leaf");
+  if (leaf_it != node_json.end()) {
+    (*nodes)[index].leaf_value = static_cast<float>(leaf_it->second.get<double>());
+    return index;
+  }
+  // Internal node: "split" is the feature name "f<idx>".
+  const std::string& split = node_json.at("split").get<std::string>();
+  CHECK(split.size() > 1 && split[0] == 'f') << "Unsupported split feature name: " << split;
+  int feature = std::stoi(split.substr(1));
+  float threshold = static_cast<float>(node_json.at("split_condition").get<double>());
+  int64_t yes_id = static_cast<int64_t>(node_json.at("yes").get<double>());
+  int64_t no_id = static_cast<int64_t>(node_json.at("no").get<double>());
+  int64_t missing_id = yes_id;
+  auto missing_it = node_json.find("missing");
+  if (missing_it != node_json.end()) {
+    missing_id = static_cast<int64_t>(missing_it->second.get<double>());
+  }
+  // Flatten children, then resolve the child node ids to table indexes.
+  std::unordered_map<int64_t, int> child_index;
+  for (const picojson::value& child : node_json.at("children").get<picojson::array>()) {
+    const picojson::object& child_json = child.get<picojson::object>();
+    int64_t nodeid = static_cast<int64_t>(child_json.at("nodeid").get<double>());
+    child_index[nodeid] = FlattenTree(child_json, nodes);
+  }
+  CHECK(child_index.count(yes_id) && child_index.count(no_id) && child_index.count(missing_id))
+      << "Malformed tree dump: child node id not found";
+  GBTreesObj::Node& node = (*nodes)[index];
+  node.feature = feature;
+  node.threshold = threshold;
+  node.yes = child_index[yes_id];
+  node.no = child_index[no_id];
+  node.missing = child_index[missing_id];
+  return index;
+}
+
+}  // namespace
+
+GBTrees GBTreesLoad(const std::string& json) {
+  picojson::value parsed;
+  std::string err = picojson::parse(parsed, json);
+  CHECK(err.empty()) << "Cannot parse tree dump: " << err;
+  CHECK(parsed.is<picojson::array>()) << "Expected a JSON array of trees";
+  auto trees = runtime::make_object<GBTreesObj>();
+  for (const picojson::value& tree : parsed.get<picojson::array>()) {
+    trees->tree_roots.push_back(
+        FlattenTree(tree.get<picojson::object>(), &trees->nodes));
+  }
+  return GBTrees(trees);
+}
+
+NDArray GBTreesPredict(GBTrees trees, NDArray features) {
+  const DLTensor* tensor = features.operator->();
+  CHECK_EQ(tensor->ndim, 2) << "Expected a (num_rows, num_features) matrix";
+  CHECK(tensor->dtype.code == kDLFloat && tensor->dtype.bits == 32 && tensor->dtype.lanes == 1)
+      << "Expected float32 features";
+  CHECK_EQ(tensor->device.device_type, kDLCPU) << "Expected CPU-resident features";
+  CHECK(runtime::IsContiguous(*tensor)) << "Expected contiguous features";
+  int64_t num_rows = tensor->shape[0];
+  int64_t num_features = tensor->shape[1];
+  const float* data =
+      reinterpret_cast<const float*>(static_cast<const char*>(tensor->data) + tensor->byte_offset);
+  NDArray scores = NDArray::Empty({num_rows}, {kDLFloat, 32, 1}, {kDLCPU, 0});
+  float* out = static_cast<float*>(scores->data);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    out[i] = trees->PredictRow(data + i * num_features, num_features);
+  }
+  return scores;
+}
+
+TVM_REGISTER_GLOBAL("meta_schedule.GBTreesLoad").set_body_typed([](runtime::String json) {
+  return GBTreesLoad(json);
+});
+
+TVM_REGISTER_GLOBAL("meta_schedule.GBTreesPredict").set_body_typed(GBTreesPredict);
+
+}  // namespace meta_schedule
+}  // namespace tvm
@@ -57,6 +57,14 @@ class JSONDatabaseNode : public DatabaseNode {
   std::unordered_map<Workload, int, WorkloadHash, WorkloadEqual> workloads2idx_;
   /*! \brief All the tuning records in the database */
   std::multiset<TuningRecord, SortTuningRecordByMeanRunSecs> tuning_records_;
+  /*!
+   * \brief Per-workload index over tuning_records_, so GetTopK queries touch
+   * only the records of the queried workload instead of scanning (and
+   * structurally comparing against) the whole database.
+   */
+  std::unordered_map<Workload, std::multiset<TuningRecord, SortTuningRecordByMeanRunSecs>,
+                     WorkloadHash, WorkloadEqual>
+      records_by_workload_;
 
   void VisitAttrs(tvm::AttrVisitor* v) {
     v->Visit("path_workload", &path_workload);
@@ -90,6 +98,7 @@ class JSONDatabaseNode : public DatabaseNode {
 
   void CommitTuningRecord(const TuningRecord& record) {
     this->tuning_records_.insert(record);
+    this->records_by_workload_[record->workload].insert(record);
     JSONFileAppendLine(this->path_tuning_record,
                        JSONObj2Str(Array<ObjectRef>{
                            /*workload_index=*/Integer(this->workloads2idx_.at(record->workload)),
@@ -104,14 +113,42 @@ class JSONDatabaseNode : public DatabaseNode {
     }
     Array<TuningRecord> results;
     results.reserve(top_k);
+    auto it = this->records_by_workload_.find(workload);
+    if (it == this->records_by_workload_.end()) {
+      return results;
+    }
     int counter = 0;
-    for (const TuningRecord& record : this->tuning_records_) {
-      if (WorkloadEqual()(record->workload, workload)) {
-        results.push_back(record);
-        if (++counter == top_k) {
-          break;
-        }
+    for (const TuningRecord& record : it->second) {
+      results.push_back(record);
+      if (++counter == top_k) {
+        break;
+      }
+    }
+    return results;
+  }
+
+  Array<TuningRecord> GetTopKOtherWorkloads(const Workload& workload, int top_k) final {
+    CHECK_GE(top_k, 0) << "ValueError: top_k must be non-negative";
+    Array<TuningRecord> results;
+    if (top_k == 0) {
+      return results;
+    }
+    results.reserve(top_k);
+    // Breadth-first over the per-workload buckets: every foreign workload
+    // contributes its best record before any contributes its second, so the
+    // warm-start pool stays diverse.
+    for (size_t rank = 0; static_cast<int>(results.size()) < top_k; ++rank) {
+      bool any = false;
+      for (const auto& kv : records_by_workload_) {
+        if (WorkloadEqual()(kv.first, workload)) continue;
+        if (rank >= kv.second.size()) continue;
+        auto it = kv.second.begin();
+        std::advance(it, rank);
+        results.push_back(*it);
+        any = true;
+        if (static_cast<int>(results.size()) == top_k) break;
       }
+      if (!any) break;
     }
     return results;
   }
@@ -150,7 +187,9 @@ Database Database::JSONDatabase(String path_workload, String path_tuning_record,
         LOG(FATAL) << "ValueError: Unable to parse the JSON object: " << json_obj
                    << "\nThe error is: " << e.what();
       }
-      n->tuning_records_.insert(TuningRecord::FromJSON(tuning_record, workloads[workload_index]));
+      TuningRecord record = TuningRecord::FromJSON(tuning_record, workloads[workload_index]);
+      n->tuning_records_.insert(record);
+      n->records_by_workload_[record->workload].insert(record);
     }
   }
   n->path_workload = path_workload;
@@ -1285,6 +1285,8 @@ class PerStoreFeatureNode : public FeatureExtractorNode {
     for (int i = 0; i < n_features; ++i) {
       const tir::Feature& feature = features[i];
       std::vector<double>& result = (*results)[i];
+      // The caller may hand us recycled buffers; the exporters append.
+      result.clear();
       result.reserve(feature_vector_length);
       feature.group1->Export(&result);
       feature.group2->Export(&result, this->buffers_per_store);
@@ -1302,7 +1304,10 @@ class PerStoreFeatureNode : public FeatureExtractorNode {
     results.resize(candidates.size());
     auto f = [this, is_gpu, &candidates, &results](int, int task_id) -> void {
       const auto& candidate = candidates[task_id];
-      std::vector<std::vector<double>> features;
+      // Worker-local buffers keep their capacity across the candidates this
+      // thread processes, so a 2048-candidate batch stops reallocating the
+      // feature vectors per candidate.
+      thread_local std::vector<std::vector<double>> features;
       ExtractSingle(candidate->sch->mod(), is_gpu, &features);
       results[task_id] = tir::utils::AsNDArray(features);
     };
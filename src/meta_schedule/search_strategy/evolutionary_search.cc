@@ -420,11 +420,24 @@ std::vector<Schedule> EvolutionarySearchNode::State::PickBestFromDatabase(int nu
   for (TuningRecord record : top_records) {
     measured_traces.push_back(record->trace);
   }
+  int own_num = measured_traces.size();
+  // Warm-start from sibling workloads when this task has few records of its
+  // own: near-identical tasks (conv shape families differing only in batch)
+  // rediscover the same schedules otherwise. Foreign traces that do not fit
+  // this task simply fail to replay below and are dropped.
+  if (own_num < num && this->st == 0) {
+    // Only the first round pays the cross-database enumeration; later rounds
+    // have this task's own measured records to seed from.
+    for (const TuningRecord& record :
+         self->database_->GetTopKOtherWorkloads(self->token_, num - own_num)) {
+      measured_traces.push_back(record->trace);
+    }
+  }
   int actual_num = measured_traces.size();
   ThreadedTraceApply pp(self->postprocs_);
   std::vector<Schedule> results(actual_num, Schedule{nullptr});
-  auto f_proc_measured = [this, &measured_traces, &results, &pp](int thread_id,
-                                                                 int trace_id) -> void {
+  auto f_proc_measured = [this, &measured_traces, &results, &pp, own_num](int thread_id,
+                                                                          int trace_id) -> void {
     PerThreadData& data = self->per_thread_data_.at(thread_id);
     TRandState* rand_state = &data.rand_state;
     const IRModule& mod = data.mod;
@@ -433,13 +446,22 @@ std::vector<Schedule> EvolutionarySearchNode::State::PickBestFromDatabase(int nu
     ICHECK(!result.defined());
     if (Optional<Schedule> sch = pp.Apply(mod, trace, rand_state)) {
       result = sch.value();
-    } else {
+    } else if (trace_id < own_num) {
       LOG(FATAL) << "ValueError: Cannot postprocess the trace:\n" << trace;
       throw;
     }
+    // A cross-workload trace that fails to apply is silently discarded.
   };
   support::parallel_for_dynamic(0, actual_num, self->num_threads_, f_proc_measured);
-  return results;
+  // Compact out the foreign traces that did not transfer.
+  std::vector<Schedule> picked;
+  picked.reserve(actual_num);
+  for (Schedule& sch : results) {
+    if (sch.defined()) {
+      picked.push_back(std::move(sch));
+    }
+  }
+  return picked;
 }
 
 std::vector<Schedule> EvolutionarySearchNode::State::SampleInitPopulation(int num) {
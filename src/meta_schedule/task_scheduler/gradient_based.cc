@@ -0,0 +1,210 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "../utils.h"
+
+namespace tvm {
+namespace meta_schedule {
+
+/*!
+ * \brief Gradient-based task scheduler.
+ *
+ *  Allocates measurement trials by predicted end-to-end latency improvement:
+ *  each task's score is its weight (how often the workload appears in the
+ *  model) times the recent improvement rate of its best latency, plus a small
+ *  exploration term so converged tasks are still revisited occasionally.
+ *  Tasks without any measurement yet are always scheduled first.
+ */
+class GradientBasedNode final : public TaskSchedulerNode {
+ public:
+  /*! \brief The weight of each task (e.g. its occurrence count in the model). */
+  Array<FloatImm> task_weights;
+  /*! \brief Multiplier of the exploration term. */
+  double alpha;
+  /*! \brief Trailing window (in measurement rounds) of the improvement rate. */
+  int window_size;
+
+  /*! \brief Best observed mean latency of each task so far. */
+  std::vector<double> best_latency_;
+  /*! \brief History of best latencies per task, one entry per joined round. */
+  std::vector<std::vector<double>> latency_history_;
+  /*! \brief Number of measurement rounds joined per task. */
+  std::vector<int> rounds_;
+
+  void VisitAttrs(tvm::AttrVisitor* v) {
+    TaskSchedulerNode::VisitAttrs(v);
+    v->Visit("task_weights", &task_weights);
+    v->Visit("alpha", &alpha);
+    v->Visit("window_size", &window_size);
+    // internal statistics are not visited
+  }
+
+  static constexpr const char* _type_key = "meta_schedule.GradientBased";
+  TVM_DECLARE_FINAL_OBJECT_INFO(GradientBasedNode, TaskSchedulerNode);
+
+ public:
+  void JoinRunningTask(int task_id) final {
+    TuneContext task = tasks[task_id];
+    ICHECK(task->runner_futures.defined());
+    Array<RunnerFuture> futures = task->runner_futures.value();
+    int n = futures.size();
+    Array<RunnerResult> results;
+    results.reserve(n);
+    for (const RunnerFuture future : task->runner_futures.value()) {
+      results.push_back(future->Result());
+    }
+    UpdateTaskStats(task_id, results);
+    task->search_strategy.value()->NotifyRunnerResults(task, task->measure_candidates.value(),
+                                                       results);
+    // Invoke the callbacks
+    ICHECK(task->measure_candidates.defined());
+    ICHECK(task->builder_results.defined());
+    ICHECK_EQ(results.size(), task->measure_candidates.value().size());
+    ICHECK_EQ(results.size(), task->builder_results.value().size());
+    for (const MeasureCallback& callback : this->measure_callbacks) {
+      callback->Apply(GetRef<TaskScheduler>(this), task_id, task->measure_candidates.value(),
+                      task->builder_results.value(), results);
+    }
+    task->measure_candidates = NullOpt;
+    task->builder_results = NullOpt;
+    task->runner_futures = NullOpt;
+  }
+
+ protected:
+  int NextTaskId() final {
+    int n_tasks = this->tasks.size();
+    EnsureStats(n_tasks);
+    // Always measure a task that has no data yet.
+    for (int i = 0; i < n_tasks; ++i) {
+      if (!tasks[i]->is_stopped && rounds_[i] == 0) {
+        return Prepare(i);
+      }
+    }
+    int best_task = -1;
+    double best_score = -std::numeric_limits<double>::infinity();
+    for (int i = 0; i < n_tasks; ++i) {
+      if (tasks[i]->is_stopped) continue;
+      double score = Score(i);
+      if (score > best_score || (score == best_score && best_task >= 0 &&
+                                 rounds_[i] < rounds_[best_task])) {
+        best_score = score;
+        best_task = i;
+      }
+    }
+    if (best_task == -1) {
+      return -1;
+    }
+    return Prepare(best_task);
+  }
+
+ private:
+  // Join the previous round of a task before handing it out again.
+  int Prepare(int task_id) {
+    if (IsTaskRunning(task_id)) {
+      JoinRunningTask(task_id);
+    }
+    return task_id;
+  }
+
+  void EnsureStats(int n_tasks) {
+    if (static_cast<int>(rounds_.size()) != n_tasks) {
+      best_latency_.assign(n_tasks, std::numeric_limits<double>::max());
+      latency_history_.assign(n_tasks, {});
+      rounds_.assign(n_tasks, 0);
+    }
+  }
+
+  double TaskWeight(int task_id) const {
+    if (task_id < static_cast<int>(task_weights.size())) {
+      return task_weights[task_id]->value;
+    }
+    return 1.0;
+  }
+
+  /*!
+   * \brief Predicted gain of giving the next round to a task: the weighted
+   * improvement rate of its best latency over the trailing window. The
+   * exploration term keeps flat tasks from starving entirely, decaying with
+   * the rounds already spent on them.
+   */
+  double Score(int task_id) const {
+    const std::vector<double>& history = latency_history_[task_id];
+    double weight = TaskWeight(task_id);
+    double exploration =
+        alpha * weight * best_latency_[task_id] / (1.0 + rounds_[task_id]);
+    if (history.size() < 2) {
+      return exploration;
+    }
+    int window = std::min<int>(window_size, static_cast<int>(history.size()) - 1);
+    double rate = (history[history.size() - 1 - window] - history.back()) / window;
+    return weight * std::max(rate, 0.0) + exploration;
+  }
+
+  void UpdateTaskStats(int task_id, const Array<RunnerResult>& results) {
+    EnsureStats(this->tasks.size());
+    for (const RunnerResult& result : results) {
+      if (!result->run_secs.defined() || result->run_secs.value().empty()) continue;
+      double sum = 0.0;
+      for (const FloatImm& sec : result->run_secs.value()) {
+        sum += sec->value;
+      }
+      double mean = sum / result->run_secs.value().size();
+      best_latency_[task_id] = std::min(best_latency_[task_id], mean);
+    }
+    latency_history_[task_id].push_back(best_latency_[task_id]);
+    rounds_[task_id] += 1;
+  }
+};
+
+TaskScheduler TaskScheduler::GradientBased(Array<TuneContext> tasks,            //
+                                           Array<FloatImm> task_weights,       //
+                                           double alpha,                       //
+                                           int window_size,                    //
+                                           Builder builder,                    //
+                                           Runner runner,                      //
+                                           Database database,                  //
+                                           Optional<CostModel> cost_model,     //
+                                           Optional<Array<MeasureCallback>> measure_callbacks) {
+  CHECK_EQ(tasks.size(), task_weights.size())
+      << "ValueError: each task needs a weight for gradient-based scheduling";
+  ObjectPtr<GradientBasedNode> n = make_object<GradientBasedNode>();
+  n->tasks = tasks;
+  n->task_weights = task_weights;
+  n->alpha = alpha;
+  n->window_size = window_size;
+  n->builder = builder;
+  n->runner = runner;
+  n->database = database;
+  n->cost_model = cost_model;
+  n->measure_callbacks = measure_callbacks.value_or({});
+  for (const TuneContext& task : tasks) {
+    task->task_scheduler = n.get();
+  }
+  return TaskScheduler(n);
+}
+
+TVM_REGISTER_NODE_TYPE(GradientBasedNode);
+TVM_REGISTER_GLOBAL("meta_schedule.TaskSchedulerGradientBased")
+    .set_body_typed(TaskScheduler::GradientBased);
+
+}  // namespace meta_schedule
+}  // namespace tvm
@@ -130,11 +130,36 @@ void TaskSchedulerNode::Tune() {
     ICHECK(!task->runner_futures.defined());
     SearchStrategy strategy = task->search_strategy.value();
     if ((task->measure_candidates = strategy->GenerateMeasureCandidates()).defined()) {
-      Array<BuilderResult> builder_results =
-          SendToBuilder(this->builder, task, task->measure_candidates.value());
-      task->builder_results = builder_results;
-      task->runner_futures =
-          SendToRunner(this->runner, task, task->measure_candidates.value(), builder_results);
+      // Pipelined dispatch (TVM_META_SCHEDULE_PIPELINE=1): split the batch so
+      // the measurement devices chew on the first half while the build host
+      // compiles the second, instead of idling through the whole build phase.
+      static const bool pipelined = []() {
+        const char* val = getenv("TVM_META_SCHEDULE_PIPELINE");
+        return val && atoi(val) != 0;
+      }();
+      Array<MeasureCandidate> candidates = task->measure_candidates.value();
+      int n_candidates = candidates.size();
+      if (pipelined && n_candidates >= 2) {
+        int half = n_candidates / 2;
+        Array<MeasureCandidate> first(candidates.begin(), candidates.begin() + half);
+        Array<MeasureCandidate> second(candidates.begin() + half, candidates.end());
+        Array<BuilderResult> first_built = SendToBuilder(this->builder, task, first);
+        Array<RunnerFuture> first_futures = SendToRunner(this->runner, task, first, first_built);
+        // The first half is measuring remotely while this build runs.
+        Array<BuilderResult> second_built = SendToBuilder(this->builder, task, second);
+        Array<RunnerFuture> second_futures =
+            SendToRunner(this->runner, task, second, second_built);
+        Array<BuilderResult> builder_results(first_built);
+        for (const BuilderResult& result : second_built) builder_results.push_back(result);
+        Array<RunnerFuture> runner_futures(first_futures);
+        for (const RunnerFuture& future : second_futures) runner_futures.push_back(future);
+        task->builder_results = builder_results;
+        task->runner_futures = runner_futures;
+      } else {
+        Array<BuilderResult> builder_results = SendToBuilder(this->builder, task, candidates);
+        task->builder_results = builder_results;
+        task->runner_futures = SendToRunner(this->runner, task, candidates, builder_results);
+      }
     } else {
       SetTaskStopped(task_id);
       --running_tasks;
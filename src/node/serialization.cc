@@ -33,6 +33,7 @@
 #include <tvm/runtime/registry.h>
 
 #include <cctype>
+#include <cstring>
 #include <map>
 #include <string>
 
@@ -500,7 +501,7 @@ struct JSONGraph {
     helper.ReadAllFields(reader);
   }
 
-  static JSONGraph Create(const ObjectRef& root) {
+  static JSONGraph Create(const ObjectRef& root, bool raw_tensors = false) {
     JSONGraph g;
     NodeIndexer indexer;
     indexer.MakeIndex(const_cast<Object*>(root.get()));
@@ -515,13 +516,18 @@ struct JSONGraph {
     }
     g.attrs["tvm_version"] = TVM_VERSION;
     g.root = indexer.node_index_.at(const_cast<Object*>(root.get()));
-    // serialize tensor
+    // serialize tensor; the binary format stores the raw blob while the json
+    // format base64-encodes it for printability.
     for (DLTensor* tensor : indexer.tensor_list_) {
       std::string blob;
       dmlc::MemoryStringStream mstrm(&blob);
-      support::Base64OutStream b64strm(&mstrm);
-      runtime::SaveDLTensor(&b64strm, tensor);
-      b64strm.Finish();
+      if (raw_tensors) {
+        runtime::SaveDLTensor(&mstrm, tensor);
+      } else {
+        support::Base64OutStream b64strm(&mstrm);
+        runtime::SaveDLTensor(&b64strm, tensor);
+        b64strm.Finish();
+      }
       g.b64ndarrays.emplace_back(std::move(blob));
     }
     return g;
@@ -571,28 +577,12 @@ std::string SaveJSON(const ObjectRef& n) {
   return os.str();
 }
 
-ObjectRef LoadJSON(std::string json_str) {
+// Reconstruct the object graph from a populated JSONGraph and its decoded
+// tensors; shared by the json and binary loaders.
+static ObjectRef LoadFromGraph(JSONGraph* jgraph_ptr, std::vector<runtime::NDArray> tensors) {
   ReflectionVTable* reflection = ReflectionVTable::Global();
-  JSONGraph jgraph;
-  {
-    // load in json graph.
-    std::istringstream is(json_str);
-    dmlc::JSONReader reader(&is);
-    jgraph.Load(&reader);
-  }
+  JSONGraph& jgraph = *jgraph_ptr;
   size_t n_nodes = jgraph.nodes.size();
-  std::vector<runtime::NDArray> tensors;
-  {
-    // load in tensors
-    for (const std::string& blob : jgraph.b64ndarrays) {
-      dmlc::MemoryStringStream mstrm(const_cast<std::string*>(&blob));
-      support::Base64InStream b64strm(&mstrm);
-      b64strm.InitPosition();
-      runtime::NDArray temp;
-      ICHECK(temp.Load(&b64strm));
-      tensors.emplace_back(std::move(temp));
-    }
-  }
   // Pass 1: create all non-container objects
   std::vector<ObjectPtr<Object>> nodes(n_nodes, nullptr);
   for (size_t i = 0; i < n_nodes; ++i) {
@@ -622,7 +612,232 @@ ObjectRef LoadJSON(std::string json_str) {
   return ObjectRef(nodes.at(jgraph.root));
 }
 
+ObjectRef LoadJSON(std::string json_str) {
+  JSONGraph jgraph;
+  {
+    // load in json graph.
+    std::istringstream is(json_str);
+    dmlc::JSONReader reader(&is);
+    jgraph.Load(&reader);
+  }
+  std::vector<runtime::NDArray> tensors;
+  {
+    // load in tensors
+    for (const std::string& blob : jgraph.b64ndarrays) {
+      dmlc::MemoryStringStream mstrm(const_cast<std::string*>(&blob));
+      support::Base64InStream b64strm(&mstrm);
+      b64strm.InitPosition();
+      runtime::NDArray temp;
+      ICHECK(temp.Load(&b64strm));
+      tensors.emplace_back(std::move(temp));
+    }
+  }
+  return LoadFromGraph(&jgraph, std::move(tensors));
+}
+
+namespace {
+
+/*!
+ * \brief Compact binary encoding of a JSONGraph.
+ *
+ *  Layout: magic, interned string table (type keys, attr names, map keys),
+ *  then per node the table-indexed keys with varint-encoded integers and
+ *  length-prefixed inline values; tensor payloads are raw rather than
+ *  base64. The structure mirrors the json format one-to-one, so the same
+ *  reflection machinery reconstructs the objects.
+ */
+constexpr uint64_t kTVMNodeBinaryMagic = 0xF7E58D4F05049CC0;
+
+class BinaryGraphWriter {
+ public:
+  explicit BinaryGraphWriter(std::string* out) : out_(out) {}
+
+  void WriteVarint(uint64_t value) {
+    while (value >= 0x80) {
+      out_->push_back(static_cast<char>((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    out_->push_back(static_cast<char>(value));
+  }
+
+  void WriteRaw(const std::string& bytes) {
+    WriteVarint(bytes.size());
+    out_->append(bytes);
+  }
+
+  void WriteInterned(const std::string& value) { WriteVarint(Intern(value)); }
+
+  uint64_t Intern(const std::string& value) {
+    auto it = intern_index_.find(value);
+    if (it != intern_index_.end()) return it->second;
+    uint64_t index = intern_table_.size();
+    intern_table_.push_back(value);
+    intern_index_.emplace(value, index);
+    return index;
+  }
+
+  const std::vector<std::string>& intern_table() const { return intern_table_; }
+
+ private:
+  std::string* out_;
+  std::vector<std::string> intern_table_;
+  std::unordered_map<std::string, uint64_t> intern_index_;
+};
+
+class BinaryGraphReader {
+ public:
+  explicit BinaryGraphReader(const std::string& data) : data_(data) {}
+
+  uint64_t ReadVarint() {
+    uint64_t value = 0;
+    int shift = 0;
+    for (;;) {
+      ICHECK_LT(pos_, data_.size()) << "Truncated binary node graph";
+      unsigned char byte = static_cast<unsigned char>(data_[pos_++]);
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) break;
+      shift += 7;
+      ICHECK_LT(shift, 64) << "Malformed varint in binary node graph";
+    }
+    return value;
+  }
+
+  std::string ReadRaw() {
+    uint64_t size = ReadVarint();
+    ICHECK_LE(pos_ + size, data_.size()) << "Truncated binary node graph";
+    std::string result = data_.substr(pos_, size);
+    pos_ += size;
+    return result;
+  }
+
+  const std::string& ReadInterned() {
+    uint64_t index = ReadVarint();
+    ICHECK_LT(index, intern_table_.size()) << "Malformed intern index";
+    return intern_table_[index];
+  }
+
+  void ReadInternTable() {
+    uint64_t count = ReadVarint();
+    intern_table_.reserve(count);
+    for (uint64_t i = 0; i < count; ++i) {
+      intern_table_.push_back(ReadRaw());
+    }
+  }
+
+  size_t pos() const { return pos_; }
+
+ private:
+  const std::string& data_;
+  size_t pos_{0};
+  std::vector<std::string> intern_table_;
+};
+
+}  // namespace
+
+std::string SaveBinary(const ObjectRef& n) {
+  JSONGraph jgraph = JSONGraph::Create(n, /*raw_tensors=*/true);
+  // First encode the body against the intern table, then prepend the table.
+  std::string body;
+  BinaryGraphWriter writer(&body);
+  writer.WriteVarint(jgraph.root);
+  writer.WriteVarint(jgraph.nodes.size());
+  for (const JSONNode& jnode : jgraph.nodes) {
+    writer.WriteInterned(jnode.type_key);
+    writer.WriteRaw(jnode.repr_bytes);
+    writer.WriteVarint(jnode.attrs.size());
+    for (const auto& kv : jnode.attrs) {
+      writer.WriteInterned(kv.first);
+      writer.WriteRaw(kv.second);
+    }
+    writer.WriteVarint(jnode.keys.size());
+    for (const std::string& key : jnode.keys) {
+      writer.WriteInterned(key);
+    }
+    writer.WriteVarint(jnode.data.size());
+    for (size_t index : jnode.data) {
+      writer.WriteVarint(index);
+    }
+  }
+  writer.WriteVarint(jgraph.b64ndarrays.size());
+  for (const std::string& blob : jgraph.b64ndarrays) {
+    writer.WriteRaw(blob);
+  }
+  writer.WriteVarint(jgraph.attrs.size());
+  for (const auto& kv : jgraph.attrs) {
+    writer.WriteInterned(kv.first);
+    writer.WriteRaw(kv.second);
+  }
+
+  std::string result;
+  BinaryGraphWriter header(&result);
+  result.append(reinterpret_cast<const char*>(&kTVMNodeBinaryMagic), sizeof(kTVMNodeBinaryMagic));
+  header.WriteVarint(writer.intern_table().size());
+  for (const std::string& entry : writer.intern_table()) {
+    header.WriteRaw(entry);
+  }
+  result.append(body);
+  return result;
+}
+
+ObjectRef LoadBinary(const std::string& data) {
+  ICHECK_GE(data.size(), sizeof(kTVMNodeBinaryMagic)) << "Truncated binary node graph";
+  uint64_t magic;
+  std::memcpy(&magic, data.data(), sizeof(magic));
+  ICHECK_EQ(magic, kTVMNodeBinaryMagic) << "Not a binary node graph";
+  std::string body = data.substr(sizeof(magic));
+  BinaryGraphReader reader(body);
+  reader.ReadInternTable();
+  JSONGraph jgraph;
+  jgraph.root = reader.ReadVarint();
+  uint64_t num_nodes = reader.ReadVarint();
+  jgraph.nodes.resize(num_nodes);
+  for (JSONNode& jnode : jgraph.nodes) {
+    jnode.type_key = reader.ReadInterned();
+    jnode.repr_bytes = reader.ReadRaw();
+    uint64_t num_attrs = reader.ReadVarint();
+    for (uint64_t i = 0; i < num_attrs; ++i) {
+      std::string key = reader.ReadInterned();
+      jnode.attrs[key] = reader.ReadRaw();
+    }
+    uint64_t num_keys = reader.ReadVarint();
+    for (uint64_t i = 0; i < num_keys; ++i) {
+      jnode.keys.push_back(reader.ReadInterned());
+    }
+    uint64_t num_data = reader.ReadVarint();
+    for (uint64_t i = 0; i < num_data; ++i) {
+      jnode.data.push_back(reader.ReadVarint());
+    }
+  }
+  uint64_t num_tensors = reader.ReadVarint();
+  std::vector<runtime::NDArray> tensors;
+  tensors.reserve(num_tensors);
+  for (uint64_t i = 0; i < num_tensors; ++i) {
+    std::string blob = reader.ReadRaw();
+    dmlc::MemoryStringStream mstrm(&blob);
+    runtime::NDArray temp;
+    ICHECK(temp.Load(&mstrm)) << "Invalid tensor in binary node graph";
+    tensors.emplace_back(std::move(temp));
+  }
+  uint64_t num_gattrs = reader.ReadVarint();
+  for (uint64_t i = 0; i < num_gattrs; ++i) {
+    std::string key = reader.ReadInterned();
+    jgraph.attrs[key] = reader.ReadRaw();
+  }
+  return LoadFromGraph(&jgraph, std::move(tensors));
+}
+
 TVM_REGISTER_GLOBAL("node.SaveJSON").set_body_typed(SaveJSON);
 
 TVM_REGISTER_GLOBAL("node.LoadJSON").set_body_typed(LoadJSON);
+
+TVM_REGISTER_GLOBAL("node.SaveBinary").set_body([](TVMArgs args, TVMRetValue* rv) {
+  ObjectRef node = args[0];
+  std::string bytes = SaveBinary(node);
+  // copy so the bytes are owned by the return value
+  *rv = TVMByteArray{bytes.data(), bytes.size()};
+});
+
+TVM_REGISTER_GLOBAL("node.LoadBinary").set_body([](TVMArgs args, TVMRetValue* rv) {
+  *rv = LoadBinary(args[0].operator std::string());
+});
 }  // namespace tvm
@@ -259,7 +259,36 @@ TVM_REGISTER_GLOBAL("node.StructuralHash")
       return static_cast<int64_t>(hashed_value);
     });
 
+// Thread-local whole-object hash table active while a StructuralHashMemoScope
+// is alive; nullptr otherwise.
+using StructuralHashMemoTable =
+    std::unordered_map<ObjectRef, size_t, ObjectPtrHash, ObjectPtrEqual>;
+static thread_local StructuralHashMemoTable* structural_hash_memo = nullptr;
+
+StructuralHashMemoScope::StructuralHashMemoScope() {
+  if (structural_hash_memo == nullptr) {
+    structural_hash_memo = new StructuralHashMemoTable();
+    owns_table_ = true;
+  }
+}
+
+StructuralHashMemoScope::~StructuralHashMemoScope() {
+  if (owns_table_) {
+    delete structural_hash_memo;
+    structural_hash_memo = nullptr;
+  }
+}
+
 size_t StructuralHash::operator()(const ObjectRef& object) const {
+  if (structural_hash_memo != nullptr && object.defined()) {
+    auto it = structural_hash_memo->find(object);
+    if (it != structural_hash_memo->end()) {
+      return it->second;
+    }
+    size_t value = VarCountingSHashHandler().Hash(object, false);
+    (*structural_hash_memo)[object] = value;
+    return value;
+  }
   return VarCountingSHashHandler().Hash(object, false);
 }
 
@@ -337,8 +366,17 @@ struct NDArrayContainerTrait {
     for (int i = 0; i < key->dl_tensor.ndim; ++i) {
       hash_reduce(key->dl_tensor.shape[i]);
     }
-    hash_reduce->SHashReduceHashedValue(runtime::String::HashBytes(
-        static_cast<const char*>(key->dl_tensor.data), runtime::GetDataSize(key->dl_tensor)));
+    uint64_t content_hash = key->content_hash_.load(std::memory_order_acquire);
+    if (content_hash == 0) {
+      // Weight tensors are hashed repeatedly by dedup passes; cache the
+      // multi-MB byte scan on the container. 0 marks "unset", so an actual
+      // zero hash is nudged to 1 (harmless for a hash).
+      content_hash = runtime::String::HashBytes(static_cast<const char*>(key->dl_tensor.data),
+                                                runtime::GetDataSize(key->dl_tensor));
+      if (content_hash == 0) content_hash = 1;
+      key->content_hash_.store(content_hash, std::memory_order_release);
+    }
+    hash_reduce->SHashReduceHashedValue(content_hash);
   }
 
   static bool SEqualReduce(const runtime::NDArray::Container* lhs,
@@ -357,6 +395,12 @@ struct NDArrayContainerTrait {
       if (!equal(lhs->dl_tensor.shape[i], rhs->dl_tensor.shape[i])) return false;
     }
     if (ldt.code == rdt.code && ldt.lanes == rdt.lanes && ldt.bits == rdt.bits) {
+      // Differing cached content hashes prove inequality without touching
+      // the payload; equal or missing hashes fall through to the byte
+      // comparison (memcmp is the vectorized path on every libc we target).
+      uint64_t lhash = lhs->content_hash_.load(std::memory_order_acquire);
+      uint64_t rhash = rhs->content_hash_.load(std::memory_order_acquire);
+      if (lhash != 0 && rhash != 0 && lhash != rhash) return false;
       size_t data_size = runtime::GetDataSize(lhs->dl_tensor);
       return std::memcmp(lhs->dl_tensor.data, rhs->dl_tensor.data, data_size) == 0;
     } else {
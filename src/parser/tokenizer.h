@@ -86,6 +86,20 @@ struct Tokenizer {
   char next_char;
   String source;
   std::vector<Token> tokens;
+  /*!
+   * \brief Identifier interner: schedule-database exports repeat the same
+   * identifiers thousands of times, and interning makes every repeat share
+   * one String object instead of re-allocating its payload.
+   */
+  std::unordered_map<std::string, tvm::String> interned_identifiers;
+
+  const tvm::String& InternIdentifier(const std::string& name) {
+    auto it = interned_identifiers.find(name);
+    if (it == interned_identifiers.end()) {
+      it = interned_identifiers.emplace(name, tvm::String(name)).first;
+    }
+    return it->second;
+  }
 
   char Next() {
     char c = this->source.at(this->pos);
@@ -537,7 +551,7 @@ struct Tokenizer {
       }
 
       auto span = SpanFrom(line, col);
-      return Token(span, token_type, tvm::String(ss.str()));
+      return Token(span, token_type, InternIdentifier(ss.str()));
     } else {
       std::stringstream ss;
       while (More() && !IsWhitespace(Peek())) {
@@ -230,7 +230,15 @@ class StorageAllocaInit : protected StorageAllocaBaseVisitor {
 /*! \brief Associate storage with every expression, reusing storage where possible. */
 class StorageAllocator : public StorageAllocaBaseVisitor {
  public:
-  StorageAllocator() = default;
+  StorageAllocator() {
+    // Best-fit mode considers every free block instead of the +/-16x match
+    // window, which recovers reuse across branches with disparate sizes
+    // (UNet-style skip connections) at the cost of sometimes growing a
+    // smaller block. Selectable since the greedy window is battle-tested.
+    best_fit_ = transform::PassContext::Current()
+                    ->GetConfig<Bool>("relay.backend.plan_memory_best_fit", Bool(false))
+                    .value();
+  }
 
   /*!
    * \return total number of bytes allocated
@@ -408,6 +416,9 @@ class StorageAllocator : public StorageAllocaBaseVisitor {
   StorageToken* Request(StorageToken* prototype) {
     // calculate the size;
     size_t size = GetMemorySize(prototype);
+    if (best_fit_) {
+      return this->RequestBestFit(prototype, size);
+    }
     // search memory block in [size / match_range_, size * match_range_)
     if (match_range_ == 0) {
       return this->Alloc(prototype, size);
@@ -443,6 +454,38 @@ class StorageAllocator : public StorageAllocaBaseVisitor {
     // cannot find anything return a new one.
     return this->Alloc(prototype, size);
   }
+  /*!
+   * \brief Liveness-interval best-fit: the free list only ever holds tokens
+   * whose last use has passed, so picking the smallest sufficient block over
+   * the whole list (or growing the largest smaller one) maximizes reuse.
+   * \param prototype The prototype storage token.
+   * \param size The size of memory being requested.
+   * \return The result token.
+   */
+  StorageToken* RequestBestFit(StorageToken* prototype, size_t size) {
+    // smallest free block that already fits
+    for (auto it = free_.lower_bound(size); it != free_.end(); ++it) {
+      StorageToken* tok = it->second;
+      if (!tok->is_compatible(*prototype)) continue;
+      ICHECK_EQ(tok->ref_counter, 0);
+      tok->max_bytes = std::max(size, tok->max_bytes);
+      tok->ref_counter = prototype->ref_counter;
+      free_.erase(it);
+      return tok;
+    }
+    // otherwise grow the largest free block
+    for (auto it = free_.lower_bound(size); it != free_.begin();) {
+      --it;
+      StorageToken* tok = it->second;
+      if (!tok->is_compatible(*prototype)) continue;
+      ICHECK_EQ(tok->ref_counter, 0);
+      tok->max_bytes = std::max(size, tok->max_bytes);
+      tok->ref_counter = prototype->ref_counter;
+      free_.erase(it);
+      return tok;
+    }
+    return this->Alloc(prototype, size);
+  }
   /*!
    * \brief Allocate a storage token by consuming prototype
    * \param prototype The prototype token.
@@ -467,6 +510,8 @@ class StorageAllocator : public StorageAllocaBaseVisitor {
   }
 
  private:
+  // whether whole-range best-fit reuse is enabled
+  bool best_fit_{false};
   // allocator
   support::Arena arena_;
   // scale used for rough match
@@ -479,6 +524,8 @@ class StorageAllocator : public StorageAllocaBaseVisitor {
   std::unordered_map<const ExprNode*, std::vector<StorageToken*>> prototype_;
 };
 
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.backend.plan_memory_best_fit", Bool);
+
 StaticMemoryPlan GraphPlanMemory(const Function& func) { return StorageAllocator().Plan(func); }
 
 TVM_REGISTER_GLOBAL("relay.backend.GraphPlanMemory").set_body_typed(GraphPlanMemory);
@@ -29,6 +29,8 @@
 #include <tvm/relay/attrs/debug.h>
 #include <tvm/relay/expr_functor.h>
 #include <tvm/relay/feature.h>
+#include <tvm/node/structural_equal.h>
+#include <tvm/node/structural_hash.h>
 #include <tvm/relay/interpreter.h>
 #include <tvm/relay/pattern_functor.h>
 #include <tvm/relay/transform.h>
@@ -40,6 +42,10 @@
 #include "../op/annotation/annotation.h"
 #include "../op/call/call.h"
 #include "../op/memory/device_copy.h"
+#include <dmlc/common.h>
+
+#include <mutex>
+
 #include "../transforms/pass_utils.h"
 #include "te_compiler.h"
 
@@ -402,13 +408,44 @@ class Interpreter : public ExprFunctor<ObjectRef(const Expr& n)>,
       lowered_projected_mod->Add(var, target_module->Lookup(var->name_hint));
     }
 
-    // Compile (aka 'build') the projected module into a runtime module of packed functions.
+    // Compile (aka 'build') the projected module into a runtime module of
+    // packed functions. Every ConstEvaluate builds a fresh interpreter, so
+    // without a process-level cache the same primitives recompile on every
+    // fold; cache the compiled module keyed by the projected module's
+    // structural hash (plus target), verified structurally on hits.
+    struct CompiledEntry {
+      IRModule lowered;
+      runtime::Module compiled;
+    };
+    static std::mutex compiled_cache_mutex;
+    static std::unordered_map<size_t, std::vector<CompiledEntry>> compiled_cache;
+    size_t compiled_key = dmlc::HashCombine(StructuralHash()(lowered_projected_mod),
+                                            std::hash<std::string>()(target->str()));
     runtime::Module runtime_module;
-    if (const auto* f = runtime::Registry::Get("relay.backend.build")) {
-      // TODO(mbs): Cleanup hooks.
-      runtime_module = (*f)(lowered_projected_mod, target);
-    } else {
-      runtime_module = build(lowered_projected_mod, target, /*target_host=*/Target(nullptr));
+    {
+      std::lock_guard<std::mutex> lock(compiled_cache_mutex);
+      auto cache_itr = compiled_cache.find(compiled_key);
+      if (cache_itr != compiled_cache.end()) {
+        for (const CompiledEntry& entry : cache_itr->second) {
+          if (StructuralEqual()(entry.lowered, lowered_projected_mod)) {
+            runtime_module = entry.compiled;
+            break;
+          }
+        }
+      }
+    }
+    if (!runtime_module.defined()) {
+      if (const auto* f = runtime::Registry::Get("relay.backend.build")) {
+        // TODO(mbs): Cleanup hooks.
+        runtime_module = (*f)(lowered_projected_mod, target);
+      } else {
+        runtime_module = build(lowered_projected_mod, target, /*target_host=*/Target(nullptr));
+      }
+      std::lock_guard<std::mutex> lock(compiled_cache_mutex);
+      if (compiled_cache.size() > 1024) {
+        compiled_cache.clear();
+      }
+      compiled_cache[compiled_key].push_back(CompiledEntry{lowered_projected_mod, runtime_module});
     }
 
     // Extract all the packed functions.
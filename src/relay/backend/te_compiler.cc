@@ -21,6 +21,8 @@
 
 #include <tvm/driver/driver_api.h>
 #include <tvm/ir/attrs.h>
+#include <tvm/node/serialization.h>
+#include <tvm/node/structural_equal.h>
 #include <tvm/ir/function.h>
 #include <tvm/relay/analysis.h>
 #include <tvm/relay/attrs/annotation.h>
@@ -35,10 +37,14 @@
 #include <tvm/te/schedule_pass.h>
 #include <tvm/topi/tags.h>
 
+#include <fstream>
 #include <functional>
 #include <limits>
+#include <sstream>
+#include <condition_variable>
 #include <mutex>
 #include <tuple>
+#include <unordered_set>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -61,6 +67,56 @@ using namespace tvm::relay::transform;
 
 TVM_REGISTER_OBJECT_TYPE(TECompilerNode);
 
+namespace {
+
+/*!
+ * \brief Best-effort on-disk cache of scheduled PrimFunc modules.
+ *
+ *  Keyed by CCacheKey::Hash() (structural hash of the relay function combined
+ *  with the target string) and verified on load by structural equality of the
+ *  stored source function, so a hash collision degrades to a miss. Enabled by
+ *  setting relay.backend.te_lower_cache_dir in the PassContext config to an
+ *  existing directory; IO failures silently fall back to lowering.
+ */
+std::string TELowerCachePath(const std::string& cache_dir, const CCacheKey& key) {
+  std::ostringstream os;
+  os << cache_dir << "/" << std::hex << key->Hash() << ".json";
+  return os.str();
+}
+
+Optional<IRModule> TryLoadLoweredFunc(const std::string& path, const CCacheKey& key,
+                                      std::string* main_name) {
+  std::ifstream fs(path);
+  if (fs.fail()) return Optional<IRModule>();
+  std::string json((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+  try {
+    auto entry = Downcast<Map<String, ObjectRef>>(LoadJSON(json));
+    if (Downcast<String>(entry.at("target")) != key->target->str()) return Optional<IRModule>();
+    if (!StructuralEqual()(entry.at("source_func"), key->source_func)) {
+      return Optional<IRModule>();
+    }
+    *main_name = Downcast<String>(entry.at("main"));
+    return Downcast<IRModule>(entry.at("funcs"));
+  } catch (const std::exception& err) {
+    VLOG(1) << "dropping unreadable lowering cache entry " << path << ": " << err.what();
+    return Optional<IRModule>();
+  }
+}
+
+void SaveLoweredFunc(const std::string& path, const CCacheKey& key, const std::string& main_name,
+                     const IRModule& funcs) {
+  Map<String, ObjectRef> entry;
+  entry.Set("target", key->target->str());
+  entry.Set("source_func", key->source_func);
+  entry.Set("main", String(main_name));
+  entry.Set("funcs", funcs);
+  std::ofstream fs(path);
+  if (fs.fail()) return;
+  fs << SaveJSON(entry);
+}
+
+}  // namespace
+
 class TECompilerImpl : public TECompilerNode {
  public:
   explicit TECompilerImpl(Optional<IRModule> opt_mod) {
@@ -266,15 +322,20 @@ class TECompilerImpl : public TECompilerNode {
             << PrettyPrint(key->source_func) << std::endl
             << "for target:" << std::endl
             << key->target->ToDebugString();
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::mutex> lock(mutex_);
     CCacheValue value;
     auto it = cache_.find(key);
     if (it != cache_.end()) {
-      VLOG(1) << "already lowered to name:" << std::endl
-              << PrettyPrint(it->second->cached_func->prim_fn_var);
       it->second->use_count += 1;
-      if (it->second->cached_func.defined()) return it->second;
       value = it->second;
+      // Another thread may be lowering this key right now: wait until its
+      // lowering completes (or fails, in which case we take over below).
+      lowering_cv_.wait(lock, [&]() { return in_progress_.count(value.get()) == 0; });
+      if (value->cached_func.defined()) {
+        VLOG(1) << "already lowered to name:" << std::endl
+                << PrettyPrint(value->cached_func->prim_fn_var);
+        return value;
+      }
     } else {
       value = CCacheValue(make_object<CCacheValueNode>());
       value->use_count = 1;
@@ -311,12 +372,42 @@ class TECompilerImpl : public TECompilerNode {
       return value;
     }
 
+    // Mark the entry in progress and release the cache lock: lowering of
+    // distinct keys is independent, so concurrent callers proceed in parallel
+    // instead of serializing behind one another.
+    in_progress_.insert(value.get());
+    lock.unlock();
+    try {
+      LowerToCachedFunc(key, value, mangle_fn);
+    } catch (...) {
+      lock.lock();
+      in_progress_.erase(value.get());
+      lowering_cv_.notify_all();
+      throw;
+    }
+    lock.lock();
+    in_progress_.erase(value.get());
+    lowering_cv_.notify_all();
+
+    VLOG(1) << "lowered to name:" << std::endl
+            << PrettyPrint(value->cached_func->prim_fn_var) << std::endl
+            << "with definitions:" << std::endl
+            << PrettyPrint(value->cached_func->funcs);
+
+    return value;
+  }
+
+  // Perform the actual lowering of \p key into \p value->cached_func.
+  // Runs outside the cache mutex; only name_map_ accesses are synchronized.
+  void LowerToCachedFunc(const CCacheKey& key, const CCacheValue& value,
+                         const std::function<String(String)>& mangle_fn) {
     // Enforce use the target.
     With<Target> target_scope(key->target);
 
     ICHECK(!value->cached_func.defined());
     value->cached_func = PrimFuncFor(key->source_func, key->target, [&](std::string name) {
       auto mangled = mangle_fn(name);
+      std::lock_guard<std::mutex> name_lock(name_map_mutex_);
       return GetUniqueName(mangled, &name_map_);
     });
 
@@ -333,27 +424,48 @@ class TECompilerImpl : public TECompilerNode {
       // lower the function
       std::unordered_map<te::Tensor, tir::Buffer> binds;
       auto func_name = value->cached_func->prim_fn_var->name_hint;
-      VLOG(1) << "scheduling";
-      IRModule scheduled_module =
-          tvm::LowerSchedule(value->cached_func->schedule, all_args, func_name, binds);
+      std::string cache_dir = transform::PassContext::Current()
+                                  ->GetConfig<String>("relay.backend.te_lower_cache_dir", String(""))
+                                  .value();
+      std::string cache_path;
+      std::string main_name = func_name;
+      IRModule scheduled_module;
+      if (!cache_dir.empty()) {
+        cache_path = TELowerCachePath(cache_dir, key);
+        if (auto loaded = TryLoadLoweredFunc(cache_path, key, &main_name)) {
+          VLOG(1) << "reusing lowering from " << cache_path;
+          scheduled_module = loaded.value();
+        }
+      }
+      if (!scheduled_module.defined()) {
+        VLOG(1) << "scheduling";
+        main_name = func_name;
+        scheduled_module =
+            tvm::LowerSchedule(value->cached_func->schedule, all_args, func_name, binds);
+        if (!cache_path.empty()) {
+          SaveLoweredFunc(cache_path, key, main_name, scheduled_module);
+        }
+      }
       // Unfortunately the above machinery creates its own GlobalVars instead of using *the*
       // GlobalVar we established above. Fix this before the confusion spreads any further.
       // TODO(mbs): LowerSchedule should be given prim_fn_gvar instead of func_name.
       for (const auto& kv : scheduled_module->functions) {
-        GlobalVar global_var = kv.first->name_hint == value->cached_func->prim_fn_var->name_hint
-                                   ? value->cached_func->prim_fn_var
-                                   : kv.first;
-        value->cached_func->funcs->Add(global_var, kv.second);
+        if (kv.first->name_hint == main_name) {
+          BaseFunc func = kv.second;
+          if (main_name != func_name) {
+            // The cached lowering was produced under a different unique name;
+            // rebind its global symbol to the one this compilation chose.
+            func = WithAttr(Downcast<tir::PrimFunc>(std::move(func)), tvm::attr::kGlobalSymbol,
+                            String(func_name));
+          }
+          value->cached_func->funcs->Add(value->cached_func->prim_fn_var, func);
+        } else {
+          value->cached_func->funcs->Add(kv.first, kv.second);
+        }
       }
       ICHECK(value->cached_func->funcs->Lookup(value->cached_func->prim_fn_var)
                  .as<tir::PrimFuncNode>());
     }
-    VLOG(1) << "lowered to name:" << std::endl
-            << PrettyPrint(value->cached_func->prim_fn_var) << std::endl
-            << "with definitions:" << std::endl
-            << PrettyPrint(value->cached_func->funcs);
-
-    return value;
   }
 
   // implement lowered shape func
@@ -410,6 +522,12 @@ class TECompilerImpl : public TECompilerNode {
 
   /*! \brief compiler cache lock*/
   std::mutex mutex_;
+  /*! \brief signaled when an in-progress lowering completes or fails */
+  std::condition_variable lowering_cv_;
+  /*! \brief cache values currently being lowered outside the mutex */
+  std::unordered_set<const Object*> in_progress_;
+  /*! \brief internal mutex guarding name_map_ during parallel lowering */
+  std::mutex name_map_mutex_;
   /*! \brief internal name map to get an unique name */
   std::unordered_map<std::string, int> name_map_;
   /*! \brief internal compiler cache */
@@ -434,6 +552,7 @@ TECompiler& TECompiler::Global() {
   return *inst;
 }
 TVM_REGISTER_PASS_CONFIG_OPTION("relay.backend.use_auto_scheduler", Bool);
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.backend.te_lower_cache_dir", String);
 TVM_REGISTER_PASS_CONFIG_OPTION("relay.backend.use_meta_schedule", Bool);
 
 TVM_REGISTER_GLOBAL("relay.backend._TECompilerGlobal").set_body_typed([]() {
@@ -926,13 +926,37 @@ void VMCompiler::Lower(IRModule mod, TargetMap targets, tvm::Target target_host)
   }
   exec_->host_device_index = kHostDeviceIndex;
 
-  // populate constants
-  for (const auto& data : context_.constants) {
-    exec_->constants.push_back(data);
-  }
-
-  for (auto index : context_.const_device_indexes) {
-    exec_->const_device_indexes.push_back(index);
+  // Populate constants in first-access order: LoadConst walks the pool in
+  // whatever order lifting discovered the constants, and on large dynamic
+  // models the resulting scattered pool indices cost cache misses in the
+  // hot RunLoop. Permuting the pool to instruction order makes consecutive
+  // loads touch consecutive pool entries; every const_index operand is
+  // remapped in place, so the executable is behaviorally identical.
+  {
+    std::vector<Index> old_to_new(context_.constants.size(), -1);
+    Index next_new = 0;
+    for (VMFunction& vm_func : exec_->functions) {
+      for (Instruction& instr : vm_func.instructions) {
+        if (instr.op != Opcode::LoadConst) continue;
+        if (old_to_new[instr.const_index] < 0) {
+          old_to_new[instr.const_index] = next_new++;
+        }
+        instr.const_index = old_to_new[instr.const_index];
+      }
+    }
+    // Constants never loaded (none are emitted today, but stay safe) keep
+    // stable positions after the accessed ones.
+    for (size_t i = 0; i < old_to_new.size(); ++i) {
+      if (old_to_new[i] < 0) {
+        old_to_new[i] = next_new++;
+      }
+    }
+    exec_->constants.resize(context_.constants.size());
+    exec_->const_device_indexes.resize(context_.const_device_indexes.size());
+    for (size_t i = 0; i < context_.constants.size(); ++i) {
+      exec_->constants[old_to_new[i]] = context_.constants[i];
+      exec_->const_device_indexes[old_to_new[i]] = context_.const_device_indexes[i];
+    }
   }
 
   // update global function map
@@ -770,9 +770,56 @@ TVM_REGISTER_GLOBAL("relay.dataflow_pattern.DFPatternCallback")
       return DFPatternCallback(pattern, function, require_type, rewrite_once);
     });
 
+namespace {
+
+/*!
+ * \brief Collect the ops a pattern's root can match, or report unknown.
+ *
+ *  The op identity is the discriminating first key of pattern matching:
+ *  when a pattern can only ever match calls to ops absent from the
+ *  expression, the whole grouper traversal for that callback is skipped.
+ * \return False when the root op set is known and none of it occurs in
+ *  \p ops_present; true (conservatively) otherwise.
+ */
+bool PatternMayMatchOps(const DFPattern& pattern,
+                        const std::unordered_set<const Object*>& ops_present) {
+  if (const auto* alt = pattern.as<AltPatternNode>()) {
+    return PatternMayMatchOps(alt->left, ops_present) ||
+           PatternMayMatchOps(alt->right, ops_present);
+  }
+  if (const auto* attr = pattern.as<AttrPatternNode>()) {
+    return PatternMayMatchOps(attr->pattern, ops_present);
+  }
+  if (const auto* type = pattern.as<TypePatternNode>()) {
+    return PatternMayMatchOps(type->pattern, ops_present);
+  }
+  if (const auto* dtype = pattern.as<DataTypePatternNode>()) {
+    return PatternMayMatchOps(dtype->pattern, ops_present);
+  }
+  if (const auto* shape = pattern.as<ShapePatternNode>()) {
+    return PatternMayMatchOps(shape->pattern, ops_present);
+  }
+  if (const auto* call = pattern.as<CallPatternNode>()) {
+    if (const auto* expr_pat = call->op.as<ExprPatternNode>()) {
+      if (const auto* op = expr_pat->expr.as<OpNode>()) {
+        return ops_present.count(op) != 0;
+      }
+    }
+    // Op position is itself a pattern: unknown, match conservatively.
+    return true;
+  }
+  // Non-call roots (wildcards, tuples, vars, ...): unknown.
+  return true;
+}
+
+}  // namespace
+
 Expr PatternRewriter::Rewrite(const Array<DFPatternCallback>& callbacks, const Expr& pre) {
   VLOG_CONTEXT << "PatternRewriter";
   VLOG(1) << "rewriting:" << std::endl << PrettyPrint(pre);
+  // Every callback and rewrite round re-indexes the (unchanged) expression;
+  // keep the dataflow index cached until the expression actually changes.
+  IndexedGraphMemoScope indexed_graph_memo_scope;
   auto post = pre;
   auto last = post;
   // rewrite the graph until it stops changing to make sure all rewrites are complete
@@ -782,8 +829,21 @@ Expr PatternRewriter::Rewrite(const Array<DFPatternCallback>& callbacks, const E
   ICHECK(structural_equal) << "node.StructuralEqual is not registered.";
   do {
     last = post;
+    // One op census per round lets callbacks whose patterns cannot match
+    // any present op skip their traversal (and type inference) entirely.
+    std::unordered_set<const Object*> ops_present;
+    PostOrderVisit(post, [&ops_present](const Expr& expr) {
+      if (const auto* call = expr.as<CallNode>()) {
+        if (const auto* op = call->op.as<OpNode>()) {
+          ops_present.insert(op);
+        }
+      }
+    });
     for (auto callback : callbacks) {
       callback_ = callback;
+      if (!PatternMayMatchOps(callback_->pattern, ops_present)) {
+        continue;
+      }
       if (callback_->require_type) {
         post = InferTypeWithModule(post, mod_);
       }
@@ -156,6 +156,19 @@ Expr ExprMutator::VisitExpr(const Expr& expr) {
     return it->second;
   } else {
     Expr new_expr = ExprFunctor::VisitExpr(expr);
+    // Leaves that mutate to themselves are not worth a memo slot: re-visiting
+    // one is a virtual dispatch returning the same reference, while the memo
+    // insertion is a heap allocation per occurrence, and operator/constant
+    // references dominate node visits in large modules. Non-leaf nodes must
+    // stay memoized - re-expanding a shared subtree would be exponential on
+    // DAGs - and so must changed leaves, to keep shared occurrences
+    // rewriting consistently. Vars also keep their slots: substitution
+    // passes routinely override the var case with bookkeeping that expects
+    // one visit per unique node.
+    if (new_expr.same_as(expr) &&
+        (expr.as<ConstantNode>() || expr.as<GlobalVarNode>() || expr.as<OpNode>())) {
+      return new_expr;
+    }
     memo_[expr] = new_expr;
     return new_expr;
   }
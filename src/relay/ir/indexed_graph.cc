@@ -33,7 +33,34 @@ namespace relay {
 
 // IndexedGraph
 
+// Thread-local per-root index table active while an IndexedGraphMemoScope is
+// alive; nullptr otherwise. Entries share node storage with the returned
+// copies, so hits are O(1) shallow copies.
+using IndexedGraphMemoTable =
+    std::unordered_map<Expr, IndexedGraph<Expr>, ObjectPtrHash, ObjectPtrEqual>;
+static thread_local IndexedGraphMemoTable* indexed_graph_memo = nullptr;
+
+IndexedGraphMemoScope::IndexedGraphMemoScope() {
+  if (indexed_graph_memo == nullptr) {
+    indexed_graph_memo = new IndexedGraphMemoTable();
+    owns_table_ = true;
+  }
+}
+
+IndexedGraphMemoScope::~IndexedGraphMemoScope() {
+  if (owns_table_) {
+    delete indexed_graph_memo;
+    indexed_graph_memo = nullptr;
+  }
+}
+
 IndexedGraph<Expr> CreateIndexedGraph(const Expr& expr) {
+  if (indexed_graph_memo != nullptr) {
+    auto it = indexed_graph_memo->find(expr);
+    if (it != indexed_graph_memo->end()) {
+      return it->second;
+    }
+  }
   using NodePtr = std::shared_ptr<IndexedGraph<Expr>::Node>;
   /*! \brief Creator Creates an IndexedGraph and determintes Topological order */
   class Creator : public MixedModeVisitor {
@@ -197,7 +224,11 @@ IndexedGraph<Expr> CreateIndexedGraph(const Expr& expr) {
 
     void VisitType(const Type& t) { return; }
   };
-  return Annotator(Creator().CreateGraph(expr)).Annotate();
+  IndexedGraph<Expr> graph = Annotator(Creator().CreateGraph(expr)).Annotate();
+  if (indexed_graph_memo != nullptr) {
+    (*indexed_graph_memo)[expr] = graph;
+  }
+  return graph;
 }
 
 IndexedGraph<DFPattern> CreateIndexedGraph(const DFPattern& pattern) {
@@ -157,6 +157,29 @@ IndexedGraph<Expr> CreateIndexedGraph(const Expr& expr);
 /*! \brief Create an Indexed Graph based on an DFPattern */
 IndexedGraph<DFPattern> CreateIndexedGraph(const DFPattern& pattern);
 
+/*!
+ * \brief RAII scope that memoizes CreateIndexedGraph(Expr) results per root.
+ *
+ *  Pattern drivers rebuild the dataflow index of the same expression once per
+ *  callback and rewrite round; while a scope is alive on the current thread,
+ *  CreateIndexedGraph returns a shallow copy sharing the cached node storage
+ *  instead. Expressions are immutable, so an entry can never go stale - a
+ *  structural edit produces a new root object and therefore a fresh index.
+ *  Scopes may nest; the outermost owns (and finally drops) the table.
+ */
+class IndexedGraphMemoScope {
+ public:
+  IndexedGraphMemoScope();
+  ~IndexedGraphMemoScope();
+
+  IndexedGraphMemoScope(const IndexedGraphMemoScope&) = delete;
+  IndexedGraphMemoScope& operator=(const IndexedGraphMemoScope&) = delete;
+
+ private:
+  /*! \brief Whether this scope owns (and will clear) the thread's table. */
+  bool owns_table_{false};
+};
+
 }  // namespace relay
 }  // namespace tvm
 #endif  // TVM_RELAY_IR_INDEXED_GRAPH_H_
@@ -25,12 +25,16 @@
 #include <tvm/node/repr_printer.h>
 #include <tvm/relay/transform.h>
 #include <tvm/runtime/registry.h>
+#include <tvm/support/parallel_for.h>
+
+#include <mutex>
 
 namespace tvm {
 namespace relay {
 namespace transform {
 
 TVM_REGISTER_PASS_CONFIG_OPTION("relay.fallback_device_type", IntImm);
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.experimental_parallel_passes", Bool);
 
 class FunctionPass;
 
@@ -130,8 +134,29 @@ IRModule FunctionPassNode::operator()(IRModule mod, const PassContext& pass_ctx)
   for (const auto& kv : updated_mod->functions) {
     // only process optimizable Relay Functions
     if (const auto* function_node = AsOptimizableFunctionNode(kv.second)) {
-      Function updated_func = pass_func(GetRef<Function>(function_node), updated_mod, pass_ctx);
-      updates.push_back({kv.first, std::move(updated_func)});
+      updates.push_back({kv.first, GetRef<Function>(function_node)});
+    }
+  }
+
+  // support::parallel_for allows only one active instance process-wide, so
+  // concurrent pipelines race for the parallel executor and the losers simply
+  // run serially instead of tripping its ICHECK.
+  // Parallel mapping is opt-in (relay.experimental_parallel_passes): the
+  // flagged passes are believed thread-safe per function, but stay serial
+  // by default until CI exercises multi-function modules under TSan.
+  bool parallel_enabled =
+      pass_ctx->GetConfig<Bool>("relay.experimental_parallel_passes", Bool(false)).value();
+  std::unique_lock<std::mutex> parallel_lock(support::ParallelForMutex(), std::try_to_lock);
+  if (parallel_enabled && pass_info->parallel && updates.size() > 1 && parallel_lock.owns_lock()) {
+    // The pass declared itself side-effect free: map it over the functions in
+    // parallel. The module is only read during the map; the rewritten
+    // functions are written back single-threaded below.
+    support::parallel_for(0, static_cast<int>(updates.size()), [&](int i) {
+      updates[i].second = pass_func(updates[i].second, updated_mod, pass_ctx);
+    });
+  } else {
+    for (auto& update : updates) {
+      update.second = pass_func(update.second, updated_mod, pass_ctx);
     }
   }
 
@@ -154,8 +179,8 @@ IRModule FunctionPassNode::operator()(IRModule mod, const PassContext& pass_ctx)
 
 Pass CreateFunctionPass(
     const runtime::TypedPackedFunc<Function(Function, IRModule, PassContext)>& pass_func,
-    int opt_level, String name, tvm::Array<String> required) {
-  PassInfo pass_info = PassInfo(opt_level, name, required);
+    int opt_level, String name, tvm::Array<String> required, bool parallel) {
+  PassInfo pass_info = PassInfo(opt_level, name, required, parallel);
   return FunctionPass(pass_func, pass_info);
 }
 
@@ -543,7 +543,11 @@ Example::
     .set_attr<FTVMCompute>("FTVMCompute", [](const Attrs& attrs, const Array<te::Tensor>& inputs,
                                              const Type& out_type) {
       return Array<te::Tensor>{topi::nn::flatten(inputs[0])};
-    });
+    })
+    // batch_flatten is a row-major identity on compact storage, exactly like
+    // reshape; marking it lets memory planning alias it to its input (VM
+    // reshape_tensor / graph __nop) instead of materializing a copy.
+    .set_attr<TReshapeOp>("TReshapeOp", true);
 
 // relu
 TVM_REGISTER_GLOBAL("relay.op.nn._make.relu").set_body_typed([](Expr data) {
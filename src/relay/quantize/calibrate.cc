@@ -26,8 +26,13 @@
 #include <tvm/relay/analysis.h>
 #include <tvm/relay/expr_functor.h>
 #include <tvm/relay/op.h>
+#include <tvm/support/parallel_for.h>
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
+#include <utility>
+#include <vector>
 
 #include "./quantize.h"
 
@@ -206,6 +211,241 @@ class StatsCollector : private ExprMutator {
  */
 Expr CreateStatsCollector(const Expr& expr) { return StatsCollector().Collect(expr); }
 
+/*!
+ * \brief Streaming per-layer calibration statistics.
+ *
+ *  Gathering every profile output into Python and histogramming with numpy
+ *  keeps the whole calibration dataset's activations alive and runs the
+ *  reductions single-threaded. This accumulator instead folds each batch
+ *  into per-layer running statistics as it is produced: a first pass over
+ *  the dataset records the absolute ranges, a second accumulates fixed-edge
+ *  histograms, and only the reduced statistics (num_bins ints per layer)
+ *  survive. Large tensors are reduced with support::parallel_for over
+ *  chunked partials, and the inner loops are written to auto-vectorize.
+ */
+class CalibrationStatsObj : public Object {
+ public:
+  void Init(int num_layers, int num_bins) {
+    ICHECK_GT(num_layers, 0);
+    ICHECK_GT(num_bins, 1);
+    num_bins_ = num_bins;
+    max_abs_.assign(num_layers, 0.f);
+    min_.assign(num_layers, 0.f);
+    hist_.clear();
+  }
+
+  void ObserveRange(int layer, const runtime::NDArray& data) {
+    const float* ptr;
+    int64_t size;
+    std::tie(ptr, size) = CheckedData(layer, data);
+    float batch_max = Reduce(ptr, size, [](const float* p, int64_t begin, int64_t end) {
+      float m = 0.f;
+      for (int64_t i = begin; i < end; ++i) {
+        m = std::max(m, std::fabs(p[i]));
+      }
+      return m;
+    });
+    max_abs_[layer] = std::max(max_abs_[layer], batch_max);
+    // The signed minimum decides whether a uint8 layer is non-negative; it is
+    // clipped at zero since only its sign is ever consulted.
+    float batch_min = -Reduce(ptr, size, [](const float* p, int64_t begin, int64_t end) {
+      float m = 0.f;
+      for (int64_t i = begin; i < end; ++i) {
+        m = std::max(m, -p[i]);
+      }
+      return m;
+    });
+    min_[layer] = std::min(min_[layer], batch_min);
+  }
+
+  void BeginHistograms() {
+    ICHECK(hist_.empty()) << "Histograms already started";
+    hist_.assign(max_abs_.size(), std::vector<int>(num_bins_, 0));
+  }
+
+  void ObserveHistogram(int layer, const runtime::NDArray& data) {
+    ICHECK(!hist_.empty()) << "Call BeginHistograms after the range pass first";
+    const float* ptr;
+    int64_t size;
+    std::tie(ptr, size) = CheckedData(layer, data);
+    const float thres = max_abs_[layer];
+    if (thres == 0.f) {
+      // Constant-zero layer: everything lands in the middle bin.
+      hist_[layer][num_bins_ / 2] += static_cast<int>(size);
+      return;
+    }
+    const float inv_width = static_cast<float>(num_bins_) / (2.f * thres);
+    std::vector<int>& hist = hist_[layer];
+    constexpr int64_t kParallelGrain = 1 << 20;
+    if (size < kParallelGrain) {
+      AccumulateHistogram(ptr, 0, size, thres, inv_width, &hist);
+    } else {
+      // Per-chunk partial histograms keep the parallel accumulation free of
+      // atomics; the merge is num_bins adds per chunk.
+      int num_chunks = static_cast<int>(std::min<int64_t>(size / kParallelGrain + 1, 16));
+      std::vector<std::vector<int>> partial(num_chunks, std::vector<int>(num_bins_, 0));
+      int64_t chunk = (size + num_chunks - 1) / num_chunks;
+      support::parallel_for(0, num_chunks, [&](int c) {
+        int64_t begin = c * chunk;
+        int64_t end = std::min<int64_t>(begin + chunk, size);
+        AccumulateHistogram(ptr, begin, end, thres, inv_width, &partial[c]);
+      });
+      for (const std::vector<int>& part : partial) {
+        for (int b = 0; b < num_bins_; ++b) {
+          hist[b] += part[b];
+        }
+      }
+    }
+  }
+
+  double GetMaxAbs(int layer) const {
+    ICHECK_LT(static_cast<size_t>(layer), max_abs_.size());
+    return max_abs_[layer];
+  }
+
+  double GetMin(int layer) const {
+    ICHECK_LT(static_cast<size_t>(layer), min_.size());
+    return min_[layer];
+  }
+
+  const std::vector<int>& GetHistogram(int layer) const {
+    ICHECK_LT(static_cast<size_t>(layer), hist_.size());
+    return hist_[layer];
+  }
+
+  int num_bins() const { return num_bins_; }
+  int num_layers() const { return static_cast<int>(max_abs_.size()); }
+
+  static constexpr const uint32_t _type_index = runtime::TypeIndex::kDynamic;
+  static constexpr const char* _type_key = "relay.quantize.CalibrationStats";
+  TVM_DECLARE_FINAL_OBJECT_INFO(CalibrationStatsObj, Object);
+
+ private:
+  std::pair<const float*, int64_t> CheckedData(int layer, const runtime::NDArray& data) {
+    ICHECK_LT(static_cast<size_t>(layer), max_abs_.size());
+    const DLTensor* tensor = data.operator->();
+    ICHECK_EQ(tensor->device.device_type, kDLCPU) << "Calibration outputs must be on CPU";
+    ICHECK(tensor->dtype.code == kDLFloat && tensor->dtype.bits == 32 && tensor->dtype.lanes == 1)
+        << "Calibration outputs must be float32";
+    ICHECK(runtime::IsContiguous(*tensor)) << "Calibration outputs must be compact";
+    int64_t size = 1;
+    for (int i = 0; i < tensor->ndim; ++i) {
+      size *= tensor->shape[i];
+    }
+    const float* ptr = reinterpret_cast<const float*>(static_cast<const char*>(tensor->data) +
+                                                     tensor->byte_offset);
+    return {ptr, size};
+  }
+
+  template <typename FChunk>
+  float Reduce(const float* ptr, int64_t size, FChunk fchunk) {
+    constexpr int64_t kParallelGrain = 1 << 20;
+    if (size < kParallelGrain) {
+      return fchunk(ptr, 0, size);
+    }
+    int num_chunks = static_cast<int>(std::min<int64_t>(size / kParallelGrain + 1, 16));
+    std::vector<float> partial(num_chunks, 0.f);
+    int64_t chunk = (size + num_chunks - 1) / num_chunks;
+    support::parallel_for(0, num_chunks, [&](int c) {
+      int64_t begin = c * chunk;
+      int64_t end = std::min<int64_t>(begin + chunk, size);
+      partial[c] = fchunk(ptr, begin, end);
+    });
+    return *std::max_element(partial.begin(), partial.end());
+  }
+
+  static void AccumulateHistogram(const float* ptr, int64_t begin, int64_t end, float thres,
+                                  float inv_width, std::vector<int>* hist) {
+    const int last_bin = static_cast<int>(hist->size()) - 1;
+    for (int64_t i = begin; i < end; ++i) {
+      int bin = static_cast<int>((ptr[i] + thres) * inv_width);
+      bin = std::min(std::max(bin, 0), last_bin);
+      ++(*hist)[bin];
+    }
+  }
+
+  int num_bins_{0};
+  std::vector<float> max_abs_;
+  std::vector<float> min_;
+  std::vector<std::vector<int>> hist_;
+};
+
+TVM_REGISTER_OBJECT_TYPE(CalibrationStatsObj);
+
+class CalibrationStats : public ObjectRef {
+ public:
+  TVM_DEFINE_MUTABLE_OBJECT_REF_METHODS(CalibrationStats, ObjectRef, CalibrationStatsObj);
+};
+
+TVM_REGISTER_GLOBAL("relay._quantize.CreateCalibrationStats")
+    .set_body_typed([](int num_layers, int num_bins) {
+      auto stats = make_object<CalibrationStatsObj>();
+      stats->Init(num_layers, num_bins);
+      return CalibrationStats(stats);
+    });
+
+TVM_REGISTER_GLOBAL("relay._quantize.CalibrationStatsObserveRange")
+    .set_body_typed([](CalibrationStats stats, int layer, runtime::NDArray data) {
+      stats->ObserveRange(layer, data);
+    });
+
+TVM_REGISTER_GLOBAL("relay._quantize.CalibrationStatsBeginHistograms")
+    .set_body_typed([](CalibrationStats stats) { stats->BeginHistograms(); });
+
+TVM_REGISTER_GLOBAL("relay._quantize.CalibrationStatsObserveHistogram")
+    .set_body_typed([](CalibrationStats stats, int layer, runtime::NDArray data) {
+      stats->ObserveHistogram(layer, data);
+    });
+
+TVM_REGISTER_GLOBAL("relay._quantize.CalibrationStatsMaxAbs")
+    .set_body_typed([](CalibrationStats stats, int layer) { return stats->GetMaxAbs(layer); });
+
+/*!
+ * \brief KL-optimal thresholds for every layer of accumulated statistics.
+ *
+ *  Layers are independent, so the threshold searches map over
+ *  support::parallel_for; each runs the same MinimizeKL as the per-layer
+ *  entry point on the layer's accumulated histogram. Layers whose data was
+ *  identically zero get threshold 0, which the caller treats as degenerate.
+ *
+ * \param stats Accumulated calibration statistics (after both passes).
+ * \param num_quantized_bins Quantized bin count for signed layers.
+ * \param is_uint8 Whether activations quantize to uint8; non-negative
+ *        layers then use the widened positive-only bin count, matching the
+ *        per-layer Python helper.
+ * \return A CPU float32 tensor with one threshold per layer.
+ */
+runtime::NDArray FindScaleByKLFromStats(CalibrationStats stats, int num_quantized_bins,
+                                        bool is_uint8) {
+  const int num_layers = stats->num_layers();
+  const int num_bins = stats->num_bins();
+  runtime::NDArray thresholds =
+      runtime::NDArray::Empty({num_layers}, {kDLFloat, 32, 1}, {kDLCPU, 0});
+  float* out = static_cast<float*>(thresholds->data);
+  support::parallel_for(0, num_layers, [&](int layer) {
+    const double thres = stats->GetMaxAbs(layer);
+    if (thres == 0.0) {
+      out[layer] = 0.f;
+      return;
+    }
+    int layer_bins = num_quantized_bins;
+    if (is_uint8 && stats->GetMin(layer) >= 0.0) {
+      // Move the negative bins to positive ones to fit the uint8 range.
+      layer_bins = num_quantized_bins * 2 + 1;
+    }
+    std::vector<float> edges(num_bins + 1);
+    const double width = 2.0 * thres / num_bins;
+    for (int j = 0; j <= num_bins; ++j) {
+      edges[j] = static_cast<float>(-thres + j * width);
+    }
+    out[layer] = MinimizeKL(stats->GetHistogram(layer), edges, num_bins, layer_bins);
+  });
+  return thresholds;
+}
+
+TVM_REGISTER_GLOBAL("relay._quantize.FindScaleByKLFromStats")
+    .set_body_typed(FindScaleByKLFromStats);
+
 TVM_REGISTER_GLOBAL("relay._quantize.CreateStatsCollector").set_body_typed(CreateStatsCollector);
 
 TVM_REGISTER_GLOBAL("relay._quantize.FindScaleByKLMinimization")
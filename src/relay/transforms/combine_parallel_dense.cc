@@ -29,6 +29,12 @@
  *
  * This prevents launching multiple kernels in networks with multiple
  * dense branches, such as BERT.
+ *
+ * With the pass config "relay.combine_parallel_dense.pad_buckets" enabled,
+ * branches whose static output dims differ by at most 2x also combine:
+ * their weights are zero-padded to a shared bucket size and the padded
+ * output columns are sliced away afterwards, trading bounded padding waste
+ * for one batched kernel on graphs full of small mismatched GEMMs.
  */
 
 #include <tvm/relay/analysis.h>
@@ -38,6 +44,7 @@
 #include <tvm/relay/op_attr_types.h>
 #include <tvm/relay/transform.h>
 
+#include <algorithm>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -53,27 +60,36 @@ namespace relay {
  */
 class ParallelDenseToBatchCombiner : public ParallelOpBatchCombiner {
  public:
-  explicit ParallelDenseToBatchCombiner(uint64_t min_num_branches)
-      : ParallelOpBatchCombiner("nn.dense", "nn.batch_matmul", min_num_branches) {}
+  explicit ParallelDenseToBatchCombiner(uint64_t min_num_branches, bool pad_buckets)
+      : ParallelOpBatchCombiner("nn.dense", "nn.batch_matmul", min_num_branches),
+        pad_buckets_(pad_buckets) {}
 
  protected:
   Call MakeCombinedOp(const Group& branches) {
-    Array<Expr> new_args;
-    size_t num_args = branches[0][0]->args.size();
-    for (size_t i = 0; i < num_args; i++) {
-      Array<Expr> arg_from_all_branches;
-      for (const auto& branch : branches) {
-        arg_from_all_branches.push_back(branch[0]->args[i]);
+    Array<Expr> datas;
+    Array<Expr> weights;
+    int64_t max_units = MaxStaticUnits(branches);
+    for (const auto& branch : branches) {
+      CHECK_EQ(branch[0]->args.size(), 2);
+      datas.push_back(branch[0]->args[0]);
+      Expr weight = branch[0]->args[1];
+      const auto* wtype = branch[0]->args[1]->type_as<TensorTypeNode>();
+      const int64_t* units = tir::as_const_int(wtype->shape[0]);
+      if (max_units > 0 && *units < max_units) {
+        // Round the weight up to the bucket size with zero rows; the extra
+        // output columns are sliced away again in UpdateGroupOutput.
+        Array<Integer> pad_rows{Integer(0), Integer(max_units - *units)};
+        Array<Integer> pad_cols{Integer(0), Integer(0)};
+        weight = MakePad(weight, {pad_rows, pad_cols}, MakeConstantScalar(wtype->dtype, 0),
+                         "constant");
       }
-
-      new_args.push_back(MakeStack(Tuple(arg_from_all_branches), 0));
+      weights.push_back(weight);
     }
 
-    CHECK_EQ(num_args, 2);
     const auto* origin_attrs = branches[0][0]->attrs.as<DenseAttrs>();
     ICHECK(origin_attrs);
-    return Downcast<Call>(
-        MakeBatchMatmul(new_args[0], new_args[1], origin_attrs->out_dtype, false, true));
+    return Downcast<Call>(MakeBatchMatmul(MakeStack(Tuple(datas), 0), MakeStack(Tuple(weights), 0),
+                                          origin_attrs->out_dtype, false, true));
   }
 
   virtual bool CanOpsBeCombined(const CallNode* a, const CallNode* b) {
@@ -85,9 +101,78 @@ class ParallelDenseToBatchCombiner : public ParallelOpBatchCombiner {
     const auto* weight_a = a->args[1]->type_as<TensorTypeNode>();
     const auto* weight_b = b->args[1]->type_as<TensorTypeNode>();
 
-    return eq(attrs_a->out_dtype, attrs_b->out_dtype) &&
-           eq(weight_a->shape[0], weight_b->shape[0]) && eq(weight_a->shape[1], weight_b->shape[1]);
+    if (!eq(attrs_a->out_dtype, attrs_b->out_dtype) ||
+        !eq(weight_a->shape[1], weight_b->shape[1])) {
+      return false;
+    }
+    if (eq(weight_a->shape[0], weight_b->shape[0])) {
+      return true;
+    }
+    if (!pad_buckets_) {
+      return false;
+    }
+    // Bucketed mode: static output dims within 2x of the group leader share
+    // a bucket, trading bounded zero-padding waste for one batched kernel.
+    const int64_t* units_a = tir::as_const_int(weight_a->shape[0]);
+    const int64_t* units_b = tir::as_const_int(weight_b->shape[0]);
+    if (units_a == nullptr || units_b == nullptr) {
+      return false;
+    }
+    return *units_a <= 2 * *units_b && *units_b <= 2 * *units_a;
   }
+
+  void UpdateGroupOutput(const Expr& data, const Group& branches, size_t depth,
+                         ExprSubstMap* subst_map) final {
+    int64_t max_units = MaxStaticUnits(branches);
+    int index = 0;
+    auto split = MakeSplit(data, Integer(static_cast<int>(branches.size())), 0);
+    for (const auto& branch : branches) {
+      Expr out = MakeSqueeze(TupleGetItem(split, index++), {0});
+      const auto* wtype = branch[0]->args[1]->type_as<TensorTypeNode>();
+      const int64_t* units = tir::as_const_int(wtype->shape[0]);
+      if (max_units > 0 && *units < max_units) {
+        // Slice off the columns the padded weight rows produced; elemwise
+        // follow-ops preserve the column count, so this holds at any depth.
+        size_t ndim = branch[depth]->type_as<TensorTypeNode>()->shape.size();
+        Array<Integer> begin;
+        Array<Integer> end;
+        Array<Integer> strides;
+        for (size_t k = 0; k + 1 < ndim; ++k) {
+          begin.push_back(0);
+          end.push_back(-1);
+          strides.push_back(1);
+        }
+        begin.push_back(0);
+        end.push_back(static_cast<int>(*units));
+        strides.push_back(1);
+        out = MakeStridedSlice(out, begin, end, strides, "size");
+      }
+      subst_map->insert({GetRef<Expr>(branch[depth]), out});
+    }
+  }
+
+ private:
+  /*!
+   * \brief The bucket size of a group, or -1 when no padding applies.
+   *
+   * Groups with equal (possibly dynamic) output dims need no padding; mixed
+   * dims only enter a group through the static bucket check above.
+   */
+  static int64_t MaxStaticUnits(const Group& branches) {
+    int64_t max_units = -1;
+    int64_t min_units = -1;
+    for (const auto& branch : branches) {
+      const auto* wtype = branch[0]->args[1]->type_as<TensorTypeNode>();
+      const int64_t* units = tir::as_const_int(wtype->shape[0]);
+      if (units == nullptr) return -1;
+      max_units = std::max(max_units, *units);
+      min_units = (min_units < 0) ? *units : std::min(min_units, *units);
+    }
+    return (max_units == min_units) ? -1 : max_units;
+  }
+
+  /*! \brief Whether differing output dims may be padded to a shared bucket. */
+  bool pad_buckets_;
 };
 
 /*
@@ -234,9 +319,10 @@ class ParallelDenseToDenseCombiner : public ParallelOpCombiner {
 };
 
 /*! \brief Combine parallel dense if number of branches >= min_num_branches */
-Expr CombineParallelDense(const Expr& expr, uint64_t min_num_branches, bool to_batch) {
+Expr CombineParallelDense(const Expr& expr, uint64_t min_num_branches, bool to_batch,
+                          bool pad_buckets) {
   if (to_batch) {
-    return ParallelDenseToBatchCombiner(min_num_branches).Combine(expr);
+    return ParallelDenseToBatchCombiner(min_num_branches, pad_buckets).Combine(expr);
   } else {
     return ParallelDenseToDenseCombiner(min_num_branches).Combine(expr);
   }
@@ -244,10 +330,15 @@ Expr CombineParallelDense(const Expr& expr, uint64_t min_num_branches, bool to_b
 
 namespace transform {
 
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.combine_parallel_dense.pad_buckets", Bool);
+
 Pass CombineParallelDense(uint64_t min_num_branches, bool to_batch_matmul) {
   runtime::TypedPackedFunc<Function(Function, IRModule, PassContext)> pass_func =
       [=](Function f, IRModule m, PassContext pc) {
-        return Downcast<Function>(CombineParallelDense(f, min_num_branches, to_batch_matmul));
+        bool pad_buckets =
+            pc->GetConfig<Bool>("relay.combine_parallel_dense.pad_buckets", Bool(false)).value();
+        return Downcast<Function>(
+            CombineParallelDense(f, min_num_branches, to_batch_matmul, pad_buckets));
       };
   return CreateFunctionPass(pass_func, 4, "CombineParallelDense", {"InferType"});
 }
@@ -20,6 +20,8 @@
 /*!
  * \file constant_folding.cc
  */
+#include <tvm/node/structural_equal.h>
+#include <tvm/node/structural_hash.h>
 #include <tvm/relay/analysis.h>
 #include <tvm/relay/attrs/annotation.h>
 #include <tvm/relay/attrs/transform.h>
@@ -31,6 +33,10 @@
 #include <tvm/runtime/ndarray.h>
 #include <tvm/runtime/object.h>
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "../op/memory/on_device.h"
 #include "./pattern_utils.h"
 
@@ -246,6 +252,20 @@ class ConstantFolder : public MixedModeMutator {
     VLOG_CONTEXT << "ConstEvaluate";
     VLOG(1) << "Evaluating :" << std::endl << PrettyPrint(expr);
 
+    // Quantized models repeat the same small constant subgraphs (scale and
+    // zero-point arithmetic) hundreds of times; each evaluation JIT-compiles
+    // through the interpreter, so fold structurally identical subgraphs once.
+    size_t hash = StructuralHash()(expr);
+    auto it = eval_memo_.find(hash);
+    if (it != eval_memo_.end()) {
+      for (const auto& entry : it->second) {
+        if (StructuralEqual()(entry.first, expr)) {
+          VLOG(1) << "Reusing previously folded structurally equal subgraph";
+          return entry.second;
+        }
+      }
+    }
+
     // We'll invoke the interpreter using the generic CPU device and target. Technically there's
     // no guarantee the results will be bitwise equal what we'd get on the true device, however to
     // support cross-compilation we don't want to assume the true device is available.
@@ -257,6 +277,7 @@ class ConstantFolder : public MixedModeMutator {
     Expr result = ObjectToExpr(
         Eval(expr, module_->type_definitions, module_->Imports(), eval_cpu_dev_, eval_cpu_target_));
     VLOG(1) << "Evaluated to constant:" << std::endl << PrettyPrint(result);
+    eval_memo_[hash].emplace_back(expr, result);
     return result;
   }
 
@@ -379,6 +400,10 @@ class ConstantFolder : public MixedModeMutator {
   // Module
   IRModule module_;
 
+  // Folded results keyed by structural hash of the evaluated subgraph, with
+  // structural equality confirming each hit.
+  std::unordered_map<size_t, std::vector<std::pair<Expr, Expr>>> eval_memo_;
+
   // The kDLCPU device assumed to be available to the compiler. Used only when evaluating
   // sub-expressions.
   Device eval_cpu_dev_{kDLCPU, /*device_id=*/0};
@@ -422,6 +447,9 @@ TVM_REGISTER_GLOBAL("relay._transform.FoldConstantExpr").set_body_typed(FoldCons
 Pass FoldConstant() {
   runtime::TypedPackedFunc<Function(Function, IRModule, PassContext)> pass_func =
       [=](Function f, IRModule m, PassContext pc) {
+        // The memo in ConstEvaluate hashes candidate subgraphs repeatedly;
+        // keep whole-object hash results cached for the pass duration.
+        StructuralHashMemoScope hash_memo_scope;
         return Downcast<Function>(FoldConstantExpr(f, m));
       };
   return CreateFunctionPass(pass_func, 2, "FoldConstant", {});
@@ -30,6 +30,8 @@
 #include <tvm/relay/transform.h>
 #include <tvm/tir/op.h>
 
+#include <algorithm>
+
 #include "../../support/arena.h"
 #include "../op/annotation/annotation.h"
 #include "./pass_utils.h"
@@ -85,6 +87,11 @@ constexpr uint32_t kMaxFusedOps = 256;
 static const Op& stop_fusion_op = Op::Get("annotation.stop_fusion");
 
 TVM_REGISTER_PASS_CONFIG_OPTION("relay.FuseOps.max_depth", Integer);
+// Tighter depth limit for groups containing an anchor op (conv/gemm-like
+// kOutEWiseFusable roots): long elementwise tails fused behind a heavy
+// anchor are the classic register-pressure regression on GPU targets, so
+// deployments can cap them per target without touching the global depth.
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.FuseOps.max_anchor_depth", Integer);
 
 /*!
  * \brief Indexed data flow graph in forward direction.
@@ -508,8 +515,12 @@ DominatorTree DominatorTree::PostDom(support::Arena* arena, const IndexedForward
  */
 class GraphPartitioner {
  public:
-  explicit GraphPartitioner(support::Arena* arena, int opt_level, size_t max_fuse_depth)
-      : arena_(arena), opt_level_(opt_level), max_fuse_depth_(max_fuse_depth) {}
+  explicit GraphPartitioner(support::Arena* arena, int opt_level, size_t max_fuse_depth,
+                            size_t max_anchor_depth)
+      : arena_(arena),
+        opt_level_(opt_level),
+        max_fuse_depth_(max_fuse_depth),
+        max_anchor_depth_(max_anchor_depth) {}
   /*!
    * \brief Group as a union find data structure.
    */
@@ -563,6 +574,8 @@ class GraphPartitioner {
   int opt_level_;
   /*! \brief The maximum number of operations in one fused function */
   size_t max_fuse_depth_;
+  /*! \brief The depth limit for groups that contain an anchor op. */
+  size_t max_anchor_depth_;
   /*! \brief The internal groups. */
   std::vector<Group*> groups_;
   /*! \brief internal field used for deduplication */
@@ -714,9 +727,14 @@ class GraphPartitioner {
       ICHECK(!graph_node->extern_ref);
       size_t dom_parent_gindex = dom_node->parent->gnode->index;
 
-      // refuse the fusion if too many ops are going to be fused together
-      if (CountFusedNodesWithNewChild(graph_node, dom_node->parent->gnode) > max_fuse_depth_)
-        continue;
+      // refuse the fusion if too many ops are going to be fused together;
+      // groups carrying an anchor op answer to the tighter anchor limit
+      size_t depth_limit = max_fuse_depth_;
+      if (groups_[dom_parent_gindex]->FindRoot()->anchor_ref != nullptr ||
+          group_node->FindRoot()->anchor_ref != nullptr) {
+        depth_limit = std::min(depth_limit, max_anchor_depth_);
+      }
+      if (CountFusedNodesWithNewChild(graph_node, dom_node->parent->gnode) > depth_limit) continue;
 
       if (phase == 2) {
         // Fuse injective ops into intermediate tuples, if any
@@ -810,10 +828,12 @@ std::vector<GraphPartitioner::Group*> GraphPartitioner::Partition(
 class FuseMutator : private MixedModeMutator {
  public:
   // Run the transform
-  Expr Transform(const Expr& body, int fuse_opt_level, size_t max_fuse_depth) {
+  Expr Transform(const Expr& body, int fuse_opt_level, size_t max_fuse_depth,
+                 size_t max_anchor_depth) {
     // setup the group map.
     auto graph = IndexedForwardGraph::Create(&arena_, body);
-    auto groups = GraphPartitioner(&arena_, fuse_opt_level, max_fuse_depth).Partition(graph);
+    auto groups =
+        GraphPartitioner(&arena_, fuse_opt_level, max_fuse_depth, max_anchor_depth).Partition(graph);
     for (size_t nid = 0; nid < graph.post_dfs_order.size(); ++nid) {
       ICHECK(graph.post_dfs_order[nid]->ref != nullptr);
       gmap_[graph.post_dfs_order[nid]->ref] = groups[nid];
@@ -1017,8 +1037,9 @@ class FuseMutator : private MixedModeMutator {
   }
 };
 
-Expr FuseOps(const Expr& expr, int fuse_opt_level, size_t max_fuse_depth, const IRModule& module) {
-  return FuseMutator().Transform(expr, fuse_opt_level, max_fuse_depth);
+Expr FuseOps(const Expr& expr, int fuse_opt_level, size_t max_fuse_depth,
+             size_t max_anchor_depth, const IRModule& module) {
+  return FuseMutator().Transform(expr, fuse_opt_level, max_fuse_depth, max_anchor_depth);
 }
 
 namespace transform {
@@ -1028,9 +1049,13 @@ Pass FuseOps(int fuse_opt_level) {
       [=](Function f, IRModule m, PassContext pc) {
         int opt_level = fuse_opt_level == -1 ? pc->opt_level : fuse_opt_level;
         auto max_fuse_depth = pc->GetConfig("relay.FuseOps.max_depth", Integer(kMaxFusedOps));
-        return Downcast<Function>(FuseOps(f, opt_level, max_fuse_depth.value(), m));
+        // Unset means no extra anchor restriction.
+        auto max_anchor_depth =
+            pc->GetConfig("relay.FuseOps.max_anchor_depth", max_fuse_depth.value());
+        return Downcast<Function>(
+            FuseOps(f, opt_level, max_fuse_depth.value(), max_anchor_depth.value(), m));
       };
-  return CreateFunctionPass(pass_func, 0, "FuseOps", {"InferType"});
+  return CreateFunctionPass(pass_func, 0, "FuseOps", {"InferType"}, /*parallel=*/true);
 }
 
 TVM_REGISTER_GLOBAL("relay._transform.FuseOps").set_body_typed(FuseOps);
@@ -0,0 +1,131 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file intern_constants.cc
+ * \brief Deduplicate identical small constants into canonical nodes.
+ *
+ *  Frontend importers materialize hundreds of identical small constants
+ *  (zero biases, scale scalars) as distinct ConstantNodes. Every later
+ *  structural operation then hashes and compares each copy separately, and
+ *  serialization stores each one. This pass interns constants up to a size
+ *  threshold by content: one canonical node per distinct value, shared by
+ *  pointer, which both shrinks the module and lets downstream
+ *  pointer-keyed memoization fire across former duplicates. Large
+ *  constants are left alone - hashing them would cost more than the
+ *  sharing saves, and real weights are rarely duplicated.
+ */
+#include <tvm/relay/expr_functor.h>
+#include <tvm/relay/transform.h>
+#include <tvm/runtime/ndarray.h>
+
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tvm {
+namespace relay {
+namespace transform {
+
+namespace {
+
+/*! \brief Content key of a CPU-resident constant: dtype, shape, raw bytes. */
+struct ConstantContentKey {
+  std::string bytes;
+  size_t hash;
+
+  bool operator==(const ConstantContentKey& other) const {
+    return hash == other.hash && bytes == other.bytes;
+  }
+};
+
+struct ConstantContentKeyHash {
+  size_t operator()(const ConstantContentKey& key) const { return key.hash; }
+};
+
+class ConstantInterner : public ExprMutator {
+ public:
+  explicit ConstantInterner(int64_t max_bytes) : max_bytes_(max_bytes) {}
+
+  Expr VisitExpr_(const ConstantNode* op) final {
+    const DLTensor* tensor = op->data.operator->();
+    if (tensor->device.device_type != kDLCPU) {
+      return GetRef<Expr>(op);
+    }
+    int64_t nbytes = static_cast<int64_t>(runtime::GetDataSize(*tensor));
+    if (nbytes > max_bytes_) {
+      return GetRef<Expr>(op);
+    }
+    ConstantContentKey key;
+    key.bytes.reserve(nbytes + 32);
+    key.bytes.append(reinterpret_cast<const char*>(&tensor->dtype), sizeof(tensor->dtype));
+    for (int i = 0; i < tensor->ndim; ++i) {
+      int64_t dim = tensor->shape[i];
+      key.bytes.append(reinterpret_cast<const char*>(&dim), sizeof(dim));
+    }
+    key.bytes.append(static_cast<const char*>(tensor->data) + tensor->byte_offset, nbytes);
+    key.hash = std::hash<std::string>()(key.bytes);
+    auto it = interned_.find(key);
+    if (it != interned_.end()) {
+      return it->second;
+    }
+    Expr canonical = GetRef<Expr>(op);
+    interned_.emplace(std::move(key), canonical);
+    return canonical;
+  }
+
+ private:
+  int64_t max_bytes_;
+  std::unordered_map<ConstantContentKey, Expr, ConstantContentKeyHash> interned_;
+};
+
+}  // namespace
+
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.InternConstants.max_bytes", Integer);
+
+Pass InternConstants() {
+  // A module pass with one interner so duplicates unify across functions.
+  auto pass_func = [=](IRModule mod, const PassContext& pc) -> IRModule {
+    int64_t max_bytes =
+        pc->GetConfig("relay.InternConstants.max_bytes", Integer(1024)).value()->value;
+    ConstantInterner interner(max_bytes);
+    IRModule updated_mod = mod->ShallowCopy();
+    std::vector<std::pair<GlobalVar, Function>> updates;
+    for (const auto& kv : updated_mod->functions) {
+      const auto* fn = kv.second.as<FunctionNode>();
+      if (fn == nullptr) continue;
+      Function new_fn = Downcast<Function>(interner.Mutate(kv.second));
+      if (!new_fn.same_as(kv.second)) {
+        updates.emplace_back(kv.first, new_fn);
+      }
+    }
+    for (const auto& pair : updates) {
+      updated_mod->AddUnchecked(pair.first, pair.second);
+    }
+    return updated_mod;
+  };
+  return tvm::transform::CreateModulePass(pass_func, 0, "InternConstants", {});
+}
+
+TVM_REGISTER_GLOBAL("relay._transform.InternConstants").set_body_typed(InternConstants);
+
+}  // namespace transform
+}  // namespace relay
+}  // namespace tvm
@@ -405,15 +405,15 @@ class Environment {
     ICHECK_GT(env_.size(), 0);
     ICHECK_EQ(env_.back().locals.count(v), 0);
     env_.back().locals[v] = ps;
+    // Shadow stack per var: lookups become O(1) instead of walking the
+    // frame list, which is what deep specialization recursion pays for.
+    flat_[v].push_back(ps);
   }
 
   PStatic Lookup(const Var& v) {
-    auto rit = env_.rbegin();
-    while (rit != env_.rend()) {
-      if (rit->locals.find(v) != rit->locals.end()) {
-        return rit->locals.find(v)->second;
-      }
-      ++rit;
+    auto it = flat_.find(v);
+    if (it != flat_.end() && !it->second.empty()) {
+      return it->second.back();
     }
     LOG(FATAL) << "Unknown Variable: " << v;
     throw;
@@ -421,11 +421,24 @@ class Environment {
 
  private:
   std::list<Frame> env_;
+  /*! \brief Per-var binding stacks mirroring the frames; top is innermost. */
+  std::unordered_map<Var, std::vector<PStatic>, ObjectPtrHash, ObjectPtrEqual> flat_;
 
   struct FrameContext {
     Environment* env_;
     explicit FrameContext(Environment* env) : env_(env) { env_->env_.push_back(Frame()); }
-    ~FrameContext() { env_->env_.pop_back(); }
+    ~FrameContext() {
+      // Unwind this frame's bindings from the shadow stacks.
+      for (const auto& kv : env_->env_.back().locals) {
+        auto it = env_->flat_.find(kv.first);
+        ICHECK(it != env_->flat_.end() && !it->second.empty());
+        it->second.pop_back();
+        if (it->second.empty()) {
+          env_->flat_.erase(it);
+        }
+      }
+      env_->env_.pop_back();
+    }
   };
 };
 
@@ -0,0 +1,226 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file prune_dead_params.cc
+ *
+ * \brief Interprocedural pruning of unused function parameters.
+ *
+ *  Partitioning and constant folding leave functions with parameters their
+ *  bodies no longer read; the arguments (often sliced weight constants) still
+ *  get serialized, loaded, and kept alive. This module pass drops a
+ *  parameter when the owning function never reads it and every use of the
+ *  function is a direct call through its GlobalVar (a function that escapes
+ *  as a value keeps its signature), rewriting all call sites to stop passing
+ *  the corresponding arguments. Follow with DeadCode and constant-pulling
+ *  passes to reclaim the newly unreferenced bindings, and InferType runs at
+ *  the end since signatures changed.
+ */
+#include <tvm/relay/analysis.h>
+#include <tvm/relay/expr_functor.h>
+#include <tvm/relay/transform.h>
+
+#include <iterator>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace tvm {
+namespace relay {
+namespace transform {
+
+namespace {
+
+/*! \brief Find global functions that are only used as direct call targets. */
+class EscapeAnalyzer : public ExprVisitor {
+ public:
+  void VisitExpr_(const CallNode* call) final {
+    if (const auto* gv = call->op.as<GlobalVarNode>()) {
+      direct_calls_.insert(gv);
+      // Visit arguments only; the op position does not count as an escape.
+      for (const Expr& arg : call->args) {
+        this->VisitExpr(arg);
+      }
+      return;
+    }
+    ExprVisitor::VisitExpr_(call);
+  }
+
+  void VisitExpr_(const GlobalVarNode* gv) final { escaped_.insert(gv); }
+
+  bool Escapes(const GlobalVar& gv) const { return escaped_.count(gv.get()) != 0; }
+
+ private:
+  std::unordered_set<const GlobalVarNode*> direct_calls_;
+  std::unordered_set<const GlobalVarNode*> escaped_;
+};
+
+/*! \brief Count reads of each candidate function's parameters. */
+std::vector<bool> UsedParams(const Function& func) {
+  std::unordered_set<const VarNode*> used;
+  PostOrderVisit(func->body, [&used](const Expr& expr) {
+    if (const auto* var = expr.as<VarNode>()) {
+      used.insert(var);
+    }
+  });
+  std::vector<bool> mask;
+  mask.reserve(func->params.size());
+  for (const Var& param : func->params) {
+    mask.push_back(used.count(param.get()) != 0);
+  }
+  return mask;
+}
+
+/*! \brief Rewrite calls to pruned functions, dropping dead arguments. */
+class CallSiteRewriter : public ExprMutator {
+ public:
+  explicit CallSiteRewriter(
+      const std::unordered_map<const GlobalVarNode*, std::vector<bool>>* keep_masks)
+      : keep_masks_(keep_masks) {}
+
+  Expr VisitExpr_(const CallNode* call) final {
+    Expr expr = ExprMutator::VisitExpr_(call);
+    const CallNode* new_call = expr.as<CallNode>();
+    const auto* gv = new_call->op.as<GlobalVarNode>();
+    if (gv == nullptr) return expr;
+    auto it = keep_masks_->find(gv);
+    if (it == keep_masks_->end()) return expr;
+    const std::vector<bool>& keep = it->second;
+    ICHECK_EQ(new_call->args.size(), keep.size())
+        << "call arity does not match the pruned function signature";
+    Array<Expr> args;
+    for (size_t i = 0; i < keep.size(); ++i) {
+      if (keep[i]) {
+        args.push_back(new_call->args[i]);
+      }
+    }
+    return Call(new_call->op, args, new_call->attrs, new_call->type_args, new_call->span);
+  }
+
+ private:
+  const std::unordered_map<const GlobalVarNode*, std::vector<bool>>* keep_masks_;
+};
+
+}  // namespace
+
+Pass PruneDeadParameters() {
+  auto pass_func = [=](IRModule mod, const PassContext& pass_ctx) -> IRModule {
+    // Pass 1: which globals escape as values?
+    EscapeAnalyzer escapes;
+    for (const auto& kv : mod->functions) {
+      if (const auto* fn = kv.second.as<FunctionNode>()) {
+        escapes(fn->body);
+      }
+    }
+    // Pass 2: per non-escaping, non-entry function, which params are read?
+    std::unordered_map<const GlobalVarNode*, std::vector<bool>> keep_masks;
+    for (const auto& kv : mod->functions) {
+      const auto* fn = kv.second.as<FunctionNode>();
+      if (fn == nullptr) continue;
+      if (kv.first->name_hint == "main") continue;
+      if (escapes.Escapes(kv.first)) continue;
+      // External/extern-marked functions keep their ABI.
+      if (fn->GetAttr<String>(attr::kCompiler).defined()) continue;
+      std::vector<bool> mask = UsedParams(GetRef<Function>(fn));
+      bool any_dead = false;
+      for (bool used : mask) {
+        any_dead = any_dead || !used;
+      }
+      if (any_dead) {
+        keep_masks.emplace(kv.first.get(), std::move(mask));
+      }
+    }
+    if (keep_masks.empty()) {
+      return mod;
+    }
+    // Pass 2b: an argument may only be dropped when it is a trivial
+    // expression at every call site - dropping a computed argument would
+    // drop its effects. Non-trivial dead positions stay as parameters.
+    for (const auto& kv : mod->functions) {
+      const auto* fn = kv.second.as<FunctionNode>();
+      if (fn == nullptr) continue;
+      PostOrderVisit(fn->body, [&keep_masks](const Expr& expr) {
+        const auto* call = expr.as<CallNode>();
+        if (call == nullptr) return;
+        const auto* gv = call->op.as<GlobalVarNode>();
+        if (gv == nullptr) return;
+        auto it = keep_masks.find(gv);
+        if (it == keep_masks.end()) return;
+        for (size_t i = 0; i < call->args.size() && i < it->second.size(); ++i) {
+          if (it->second[i]) continue;
+          const Expr& arg = call->args[i];
+          bool trivial = arg.as<VarNode>() || arg.as<ConstantNode>() ||
+                         arg.as<GlobalVarNode>() || arg.as<OpNode>();
+          if (!trivial) {
+            it->second[i] = true;  // keep the parameter after all
+          }
+        }
+      });
+    }
+    // Drop entries whose mask became all-true.
+    for (auto it = keep_masks.begin(); it != keep_masks.end();) {
+      bool any_dead = false;
+      for (bool used : it->second) {
+        any_dead = any_dead || !used;
+      }
+      it = any_dead ? std::next(it) : keep_masks.erase(it);
+    }
+    if (keep_masks.empty()) {
+      return mod;
+    }
+    // Pass 3: rewrite definitions and every call site.
+    IRModule updated_mod = mod->ShallowCopy();
+    CallSiteRewriter rewriter(&keep_masks);
+    std::vector<std::pair<GlobalVar, Function>> updates;
+    for (const auto& kv : updated_mod->functions) {
+      const auto* fn = kv.second.as<FunctionNode>();
+      if (fn == nullptr) continue;
+      Expr new_body = rewriter.Mutate(fn->body);
+      Array<Var> params = fn->params;
+      auto it = keep_masks.find(kv.first.get());
+      if (it != keep_masks.end()) {
+        params.clear();
+        for (size_t i = 0; i < fn->params.size(); ++i) {
+          if (it->second[i]) {
+            params.push_back(fn->params[i]);
+          }
+        }
+      }
+      if (!new_body.same_as(fn->body) || it != keep_masks.end()) {
+        // The signature changed; drop the stale result type annotation and
+        // let type inference recompute it.
+        updates.emplace_back(kv.first,
+                             Function(params, new_body, Type(), fn->type_params, fn->attrs));
+      }
+    }
+    for (const auto& pair : updates) {
+      updated_mod->Add(pair.first, pair.second, true);
+    }
+    return updated_mod;
+  };
+  auto prune = tvm::transform::CreateModulePass(pass_func, 1, "PruneDeadParameters", {});
+  return tvm::transform::Sequential({prune, InferType()}, "PruneDeadParameters");
+}
+
+TVM_REGISTER_GLOBAL("relay._transform.PruneDeadParameters").set_body_typed(PruneDeadParameters);
+
+}  // namespace transform
+}  // namespace relay
+}  // namespace tvm
@@ -682,6 +682,54 @@ class SimplifyConsecutiveAdd : public DFPatternRewrite {
   DFPattern const2_;
 };
 
+/*!
+ * \brief Sink a layout_transform below a unary elementwise op:
+ *  ewise(layout_transform(x)) becomes layout_transform(ewise(x)).
+ *
+ *  Elementwise math is layout-oblivious, so transforms migrate toward their
+ *  consumers until they meet another transform and SimplifyTranspose cancels
+ *  or fuses the pair, removing the NCHW<->NCHWc oscillation that alternating
+ *  per-op layout preferences otherwise leave behind.
+ */
+class SinkLayoutTransform : public DFPatternRewrite {
+ public:
+  SinkLayoutTransform() {
+    x_ = IsWildcard();
+    layout_trans_ = IsOp("layout_transform")({x_});
+    pattern_ = IsWildcard()({layout_trans_});
+  }
+
+  Expr Callback(const Expr& pre, const Expr& post,
+                const Map<DFPattern, Array<Expr>>& node_map) const override {
+    static const auto op_pattern_map = Op::GetAttrMap<TOpPattern>("TOpPattern");
+    const CallNode* outer = post.as<CallNode>();
+    if (outer == nullptr || outer->args.size() != 1) {
+      return post;
+    }
+    const OpNode* op = outer->op.as<OpNode>();
+    if (op == nullptr) {
+      return post;
+    }
+    Op op_ref = GetRef<Op>(op);
+    // Only unary, purely elementwise math is safely layout oblivious; the
+    // layout_transform op itself is excluded so the rewrite cannot ping-pong.
+    if (op_ref == Op::Get("layout_transform") || !op_pattern_map.count(op_ref) ||
+        op_pattern_map[op_ref] != kElemWise) {
+      return post;
+    }
+    Call layout_trans = Downcast<Call>(node_map[layout_trans_][0]);
+    const auto* attrs = layout_trans->attrs.as<LayoutTransformAttrs>();
+    ICHECK(attrs != nullptr);
+    Expr data = node_map[x_][0];
+    Expr new_inner = Call(outer->op, {data}, outer->attrs, outer->type_args, outer->span);
+    return MakeLayoutTransform(new_inner, attrs->src_layout, attrs->dst_layout);
+  }
+
+ protected:
+  DFPattern x_;
+  DFPattern layout_trans_;
+};
+
 Expr SimplifyExpr(const Expr& expr, const IRModule& mod) {
   // the rewrites will be applied in the given order, and repeated until fixed point
   DFPatternRewriteComposer composer;
@@ -693,6 +741,7 @@ Expr SimplifyExpr(const Expr& expr, const IRModule& mod) {
   composer.AddRewrite<ConcretizeBroadcastToLikeRewrite>();
   composer.AddRewrite<EliminateIdentityRewrite>();
   composer.AddRewrite<SimplifyReshape>();
+  composer.AddRewrite<SinkLayoutTransform>();
   composer.AddRewrite<SimplifyTranspose>();
   composer.AddRewrite<SimplifySameCast>();
   composer.AddRewrite<SimplifyConsecutiveCast>();
@@ -708,7 +757,7 @@ Pass SimplifyExpr() {
       [=](Function f, IRModule m, PassContext pc) {
         return Downcast<Function>(SimplifyExpr(f, m));
       };
-  return CreateFunctionPass(pass_func, 0, "SimplifyExpr", {"InferType"});
+  return CreateFunctionPass(pass_func, 0, "SimplifyExpr", {"InferType"}, /*parallel=*/true);
 }
 
 TVM_REGISTER_GLOBAL("relay._transform.SimplifyExpr").set_body_typed(SimplifyExpr);
@@ -29,6 +29,8 @@
 #include <tvm/relay/transform.h>
 #include <tvm/runtime/object.h>
 
+#include <string>
+#include <unordered_set>
 #include <utility>
 
 #include "pattern_utils.h"
@@ -105,6 +107,8 @@ class MixedPrecisionPass : public MixedModeMutator {
    * encountered. Used for emitting warnings on missing ops in the pass.
    */
   std::unordered_map<std::string, int> missing_ops_;
+  /*! \brief Ops forced to keep their original precision (measured denylist). */
+  std::unordered_set<std::string> keep_orig_ops_;
 
   Attrs GetNewAttrs(const CallNode* call, const DataType& accumulation_dtype) const {
     /* If the accumulation dtype is in the attributes make a copy and mutate the field. */
@@ -278,8 +282,11 @@ class MixedPrecisionPass : public MixedModeMutator {
  public:
   using MixedModeMutator::VisitExpr_;
 
-  explicit MixedPrecisionPass(DataType mixed_precision_type = DataType::Float(16))
-      : MixedModeMutator(), mixed_precision_type_(mixed_precision_type) {
+  explicit MixedPrecisionPass(DataType mixed_precision_type = DataType::Float(16),
+                              std::unordered_set<std::string> keep_orig_ops = {})
+      : MixedModeMutator(),
+        mixed_precision_type_(mixed_precision_type),
+        keep_orig_ops_(std::move(keep_orig_ops)) {
     if (!mixed_precision_type_.is_float() && !mixed_precision_type_.is_bfloat16()) {
       LOG(FATAL) << "Only support IEEE floating point mixed precision types and bfloat16, but got "
                  << mixed_precision_type_;
@@ -333,6 +340,14 @@ class MixedPrecisionPass : public MixedModeMutator {
         accumulation_dtype = mixed_precision_type_;
         output_dtype = mixed_precision_type_;
       }
+      // Measured per-target overrides outrank the static lists: an op whose
+      // conversion overhead was found to outweigh its compute savings on
+      // this fleet stays in the original precision.
+      if (keep_orig_ops_.count(op->name)) {
+        initial_category = MIXED_PRECISION_NEVER;
+        accumulation_dtype = DataType::Float(32);
+        output_dtype = DataType::Float(32);
+      }
     } else {
       LOG(FATAL) << "Unsupported op type in CallNode: " << pre_call_node->op;
     }
@@ -422,10 +437,12 @@ class MixedPrecisionPass : public MixedModeMutator {
 
   // To access map of ops not registered for error reporting
   friend Expr ToMixedPrecision(const Expr& expr, const DataType& mixed_precision_type,
-                               int missing_op_mode);
+                               int missing_op_mode,
+                               const std::unordered_set<std::string>& keep_orig_ops);
 };
 
-Expr ToMixedPrecision(const Expr& expr, const DataType& mixed_precision_type, int missing_op_mode) {
+Expr ToMixedPrecision(const Expr& expr, const DataType& mixed_precision_type, int missing_op_mode,
+                      const std::unordered_set<std::string>& keep_orig_ops = {}) {
   /*
   missing_op_mode:
 
@@ -436,7 +453,7 @@ Expr ToMixedPrecision(const Expr& expr, const DataType& mixed_precision_type, in
   ICHECK(missing_op_mode >= 0 && missing_op_mode <= 2)
       << " missing_op_mode must be either 0, 1, or 2 got " << missing_op_mode;
 
-  MixedPrecisionPass converter = MixedPrecisionPass(mixed_precision_type);
+  MixedPrecisionPass converter = MixedPrecisionPass(mixed_precision_type, keep_orig_ops);
   auto result = converter.Mutate(expr);
 
   for (auto it = converter.missing_ops_.begin();
@@ -457,10 +474,20 @@ Expr ToMixedPrecision(const Expr& expr, const DataType& mixed_precision_type, in
 
 namespace transform {
 
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.ToMixedPrecision.keep_orig_ops", Array<String>);
+
 Pass ToMixedPrecision(DataType mixed_precision_type, int missing_op_mode) {
   runtime::TypedPackedFunc<Function(Function, IRModule, PassContext)> pass_func =
       [=](Function f, IRModule m, PassContext pc) {
-        return Downcast<Function>(ToMixedPrecision(f, mixed_precision_type, missing_op_mode));
+        // Per-target measured denylist: these ops keep their original
+        // precision regardless of the static conversion lists.
+        std::unordered_set<std::string> keep_orig_ops;
+        auto cfg = pc->GetConfig("relay.ToMixedPrecision.keep_orig_ops", Array<String>());
+        for (const String& name : cfg.value()) {
+          keep_orig_ops.insert(name);
+        }
+        return Downcast<Function>(
+            ToMixedPrecision(f, mixed_precision_type, missing_op_mode, keep_orig_ops));
       };
   return CreateFunctionPass(pass_func, 0, "ToMixedPrecision", {});
 }
@@ -39,6 +39,7 @@
  */
 
 #include <tvm/ir/transform.h>
+#include <tvm/node/structural_equal.h>
 #include <tvm/ir/type_functor.h>
 #include <tvm/relay/analysis.h>
 #include <tvm/relay/dataflow_matcher.h>
@@ -927,6 +928,24 @@ TVM_REGISTER_GLOBAL("relay._transform.InferTypeLocal").set_body_typed([](const E
   return InferTypeLocal(expr);
 });
 
+namespace {
+
+// Whether every sub-expression of \p func already carries a checked type.
+// Nodes freshly created by a mutating pass have no checked_type_, so a fully
+// populated function is one the previous inference round already solved and
+// no pass has touched since.
+bool AllCheckedTypesPopulated(const Function& func) {
+  bool all_populated = true;
+  PostOrderVisit(func, [&all_populated](const Expr& expr) {
+    if (!expr->checked_type_.defined()) {
+      all_populated = false;
+    }
+  });
+  return all_populated;
+}
+
+}  // namespace
+
 Pass InferType() {
   auto pass_info = PassInfo(0, "InferType", {});
   return tvm::transform::CreateModulePass(
@@ -939,43 +958,63 @@ Pass InferType() {
         // Add all the type annotations to the functions in the model.
         AddGlobalTypes(mod);
 
+        // In incremental mode only functions touched since the last round are
+        // re-solved; if any of their global signatures change we fall back to
+        // a full pass so stale callers get re-checked.
+        const bool incremental =
+            pass_ctx->GetConfig<Bool>("relay.infer_type.incremental", Bool(false)).value();
+        bool signature_changed = false;
+
         std::vector<std::pair<GlobalVar, Function> > updates;
-        for (const auto& it : updated_mod->functions) {
-          // Currently we don't type check TIR.
-          //
-          // The inferencer will only check Relay functions.
-
-          // In the future we plan a unified type checker
-          // that works on TIR and Relay at the same time.
-          if (auto* func_node = it.second.as<FunctionNode>()) {
-            auto func = GetRef<Function>(func_node);
-
-            // // If a function already has type information we can skip checking it.
-            // if (func->checked_type_.defined()) {
-            //   continue;
-            // }
-
-            // TODO(@jroesch): we should be able to move the type inferencer outside
-            // of this function but it seems to be more stateful then I expect.
-            auto inferencer = TypeInferencer(mod, pass_ctx->diag_ctx.value());
-            auto updated_func = inferencer.Infer(it.first, func);
-
-            pass_ctx->diag_ctx.value().Render();
-
-            // After we are done checking write the global type back
-            // into the global var.
-            it.first->checked_type_ = updated_func->checked_type();
-
-            if (!WellFormed(updated_func, pass_ctx->diag_ctx)) {
-              LOG(FATAL) << "The type checked intermediate representation is malformed";
+        auto infer_all = [&](bool skip_populated) {
+          updates.clear();
+          for (const auto& it : updated_mod->functions) {
+            // Currently we don't type check TIR.
+            //
+            // The inferencer will only check Relay functions.
+
+            // In the future we plan a unified type checker
+            // that works on TIR and Relay at the same time.
+            if (auto* func_node = it.second.as<FunctionNode>()) {
+              auto func = GetRef<Function>(func_node);
+
+              if (skip_populated && AllCheckedTypesPopulated(func)) {
+                continue;
+              }
+
+              // TODO(@jroesch): we should be able to move the type inferencer outside
+              // of this function but it seems to be more stateful then I expect.
+              auto inferencer = TypeInferencer(mod, pass_ctx->diag_ctx.value());
+              auto updated_func = inferencer.Infer(it.first, func);
+
+              pass_ctx->diag_ctx.value().Render();
+
+              // After we are done checking write the global type back
+              // into the global var.
+              if (incremental && it.first->checked_type_.defined() &&
+                  !StructuralEqual()(it.first->checked_type_, updated_func->checked_type())) {
+                signature_changed = true;
+              }
+              it.first->checked_type_ = updated_func->checked_type();
+
+              if (!WellFormed(updated_func, pass_ctx->diag_ctx)) {
+                LOG(FATAL) << "The type checked intermediate representation is malformed";
+              }
+
+              auto free_tvars = FreeTypeVars(updated_func, mod);
+              ICHECK(free_tvars.size() == 0)
+                  << "Found unbound type variables in " << updated_func << ": " << free_tvars;
+              EnsureCheckedType(updated_func);
+              updates.push_back({it.first, Downcast<Function>(updated_func)});
             }
-
-            auto free_tvars = FreeTypeVars(updated_func, mod);
-            ICHECK(free_tvars.size() == 0)
-                << "Found unbound type variables in " << updated_func << ": " << free_tvars;
-            EnsureCheckedType(updated_func);
-            updates.push_back({it.first, Downcast<Function>(updated_func)});
           }
+        };
+
+        infer_all(/*skip_populated=*/incremental);
+        if (incremental && signature_changed) {
+          // A global signature changed: callers that looked clean may now hold
+          // stale types, so re-solve the whole module.
+          infer_all(/*skip_populated=*/false);
         }
 
         for (const auto& pair : updates) {
@@ -987,6 +1026,8 @@ Pass InferType() {
       0, "InferType", {});
 }
 
+TVM_REGISTER_PASS_CONFIG_OPTION("relay.infer_type.incremental", Bool);
+
 TVM_REGISTER_GLOBAL("relay._transform.InferType").set_body_typed([]() { return InferType(); });
 
 }  // namespace transform
@@ -0,0 +1,95 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file async_call.cc
+ * \brief Future-based asynchronous invocation of packed functions.
+ *
+ *  Remote calls block for a full round trip each; runtime.AsyncCall hands the
+ *  call to a background worker and returns a future the caller redeems with
+ *  runtime.AsyncWait, so independent remote invocations (or any blocking
+ *  packed calls) overlap with local work. Calls into one RPC endpoint still
+ *  serialize on its channel - the wire protocol is strictly
+ *  request-response - but futures across pooled sessions run genuinely in
+ *  parallel, and a single session's round-trip latency no longer blocks the
+ *  issuing thread.
+ */
+#include <tvm/runtime/packed_func.h>
+#include <tvm/runtime/registry.h>
+
+#include <future>
+#include <utility>
+#include <vector>
+
+namespace tvm {
+namespace runtime {
+
+/*! \brief A pending asynchronous packed call. */
+class AsyncCallFutureObj : public Object {
+ public:
+  std::future<TVMRetValue> result;
+
+  static constexpr const uint32_t _type_index = TypeIndex::kDynamic;
+  static constexpr const char* _type_key = "runtime.AsyncCallFuture";
+  TVM_DECLARE_FINAL_OBJECT_INFO(AsyncCallFutureObj, Object);
+};
+
+TVM_REGISTER_OBJECT_TYPE(AsyncCallFutureObj);
+
+class AsyncCallFuture : public ObjectRef {
+ public:
+  TVM_DEFINE_MUTABLE_OBJECT_REF_METHODS(AsyncCallFuture, ObjectRef, AsyncCallFutureObj);
+};
+
+TVM_REGISTER_GLOBAL("runtime.AsyncCall").set_body([](TVMArgs args, TVMRetValue* rv) {
+  PackedFunc func = args[0];
+  ICHECK(func != nullptr) << "runtime.AsyncCall expects a function as first argument";
+  // Own the arguments: TVMArgs only borrows, and the call outlives this frame.
+  auto owned = std::make_shared<std::vector<TVMRetValue>>(args.size() - 1);
+  for (int i = 1; i < args.size(); ++i) {
+    // Raw DLTensor handles are borrowed from the caller's frame and cannot
+    // outlive it; pass NDArrays instead, which are owned by reference.
+    ICHECK_NE(args[i].type_code(), kTVMDLTensorHandle)
+        << "runtime.AsyncCall arguments must be NDArrays, not borrowed DLTensor handles";
+    (*owned)[i - 1] = args[i];
+  }
+  auto future = make_object<AsyncCallFutureObj>();
+  future->result = std::async(std::launch::async, [func, owned]() {
+    std::vector<TVMValue> values(owned->size());
+    std::vector<int> codes(owned->size());
+    TVMArgsSetter setter(values.data(), codes.data());
+    for (size_t i = 0; i < owned->size(); ++i) {
+      setter(i, (*owned)[i]);
+    }
+    TVMRetValue result;
+    func.CallPacked(TVMArgs(values.data(), codes.data(), static_cast<int>(owned->size())),
+                    &result);
+    return result;
+  });
+  *rv = AsyncCallFuture(future);
+});
+
+TVM_REGISTER_GLOBAL("runtime.AsyncWait").set_body([](TVMArgs args, TVMRetValue* rv) {
+  AsyncCallFuture future = args[0];
+  ICHECK(future->result.valid()) << "The future was already redeemed";
+  *rv = future->result.get();
+});
+
+}  // namespace runtime
+}  // namespace tvm
@@ -23,6 +23,14 @@
  */
 #include <builtin_fp16.h>
 #include <tvm/runtime/c_runtime_api.h>
+#include <tvm/runtime/logging.h>
+#include <tvm/runtime/ndarray.h>
+#include <tvm/runtime/registry.h>
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__clang_analyzer__)
+#include <immintrin.h>
+#define TVM_FP16_USE_F16C 1
+#endif
 
 extern "C" {
 
@@ -49,3 +57,119 @@ TVM_DLL float __gnu_h2f_ieee(uint16_t a) {
 
 #endif
 }
+
+namespace tvm {
+namespace runtime {
+namespace {
+
+#ifdef TVM_FP16_USE_F16C
+
+__attribute__((target("f16c"))) void HalfToFloatF16C(const uint16_t* src, float* dst, int64_t n) {
+  int64_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+  }
+  for (; i < n; ++i) {
+    dst[i] = __gnu_h2f_ieee(src[i]);
+  }
+}
+
+__attribute__((target("f16c"))) void FloatToHalfF16C(const float* src, uint16_t* dst, int64_t n) {
+  int64_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 f = _mm256_loadu_ps(src + i);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+  }
+  for (; i < n; ++i) {
+    dst[i] = __gnu_f2h_ieee(src[i]);
+  }
+}
+
+bool HasF16C() {
+  static bool has_f16c = __builtin_cpu_supports("f16c");
+  return has_f16c;
+}
+
+#endif
+
+}  // namespace
+
+void Float16ToFloat32Batched(const uint16_t* src, float* dst, int64_t n) {
+#ifdef TVM_FP16_USE_F16C
+  if (HasF16C()) {
+    HalfToFloatF16C(src, dst, n);
+    return;
+  }
+#endif
+#if defined(__aarch64__)
+  // The compiler lowers __fp16 conversions to fcvt and vectorizes the loop.
+  for (int64_t i = 0; i < n; ++i) {
+    dst[i] = static_cast<float>(reinterpret_cast<const __fp16*>(src)[i]);
+  }
+#else
+  for (int64_t i = 0; i < n; ++i) {
+    dst[i] = __gnu_h2f_ieee(src[i]);
+  }
+#endif
+}
+
+void Float32ToFloat16Batched(const float* src, uint16_t* dst, int64_t n) {
+#ifdef TVM_FP16_USE_F16C
+  if (HasF16C()) {
+    FloatToHalfF16C(src, dst, n);
+    return;
+  }
+#endif
+#if defined(__aarch64__)
+  for (int64_t i = 0; i < n; ++i) {
+    reinterpret_cast<__fp16*>(dst)[i] = static_cast<__fp16>(src[i]);
+  }
+#else
+  for (int64_t i = 0; i < n; ++i) {
+    dst[i] = __gnu_f2h_ieee(src[i]);
+  }
+#endif
+}
+
+namespace {
+
+// Batched CPU cast between float16 and float32 NDArrays, dispatching to F16C
+// (x86) or native fp16 converts (aarch64) when available.
+NDArray CastFP16(NDArray src, bool to_fp32) {
+  const DLTensor* tensor = src.operator->();
+  ICHECK_EQ(tensor->device.device_type, kDLCPU) << "runtime.CastFP16 expects CPU tensors";
+  ICHECK(tensor->strides == nullptr) << "runtime.CastFP16 expects compact tensors";
+  ICHECK_EQ(tensor->dtype.lanes, 1);
+  int64_t n = 1;
+  for (int i = 0; i < tensor->ndim; ++i) {
+    n *= tensor->shape[i];
+  }
+  const char* base = static_cast<const char*>(tensor->data) + tensor->byte_offset;
+  if (to_fp32) {
+    ICHECK(tensor->dtype.code == kDLFloat && tensor->dtype.bits == 16);
+    NDArray dst = NDArray::Empty(src.Shape(), DLDataType{kDLFloat, 32, 1}, tensor->device);
+    Float16ToFloat32Batched(reinterpret_cast<const uint16_t*>(base),
+                            static_cast<float*>(dst->data), n);
+    return dst;
+  }
+  ICHECK(tensor->dtype.code == kDLFloat && tensor->dtype.bits == 32);
+  NDArray dst = NDArray::Empty(src.Shape(), DLDataType{kDLFloat, 16, 1}, tensor->device);
+  Float32ToFloat16Batched(reinterpret_cast<const float*>(base),
+                          static_cast<uint16_t*>(dst->data), n);
+  return dst;
+}
+
+}  // namespace
+
+TVM_REGISTER_GLOBAL("runtime.Float16ToFloat32").set_body_typed([](NDArray src) {
+  return CastFP16(src, /*to_fp32=*/true);
+});
+
+TVM_REGISTER_GLOBAL("runtime.Float32ToFloat16").set_body_typed([](NDArray src) {
+  return CastFP16(src, /*to_fp32=*/false);
+});
+
+}  // namespace runtime
+}  // namespace tvm
@@ -596,6 +596,12 @@ int TVMCbArgToReturn(TVMValue* value, int* code) {
   API_END();
 }
 
+int TVMDeviceReleaseUnusedMemory(DLDevice dev) {
+  API_BEGIN();
+  DeviceAPIManager::Get(dev)->ReleaseUnusedMemory(dev);
+  API_END();
+}
+
 int TVMDeviceAllocDataSpace(DLDevice dev, size_t nbytes, size_t alignment, DLDataType type_hint,
                             void** out_data) {
   API_BEGIN();
@@ -658,3 +664,9 @@ TVM_REGISTER_GLOBAL("runtime.GetDeviceAttr").set_body([](TVMArgs args, TVMRetVal
 });
 
 TVM_REGISTER_GLOBAL("runtime.TVMSetStream").set_body_typed(TVMSetStream);
+
+TVM_REGISTER_GLOBAL("runtime.DeviceReleaseUnusedMemory")
+    .set_body_typed([](int device_type, int device_id) {
+      DLDevice dev{static_cast<DLDeviceType>(device_type), device_id};
+      DeviceAPIManager::Get(dev)->ReleaseUnusedMemory(dev);
+    });
@@ -0,0 +1,169 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file canary_dispatch.cc
+ * \brief Measured dual dispatch between a tuned and a fallback kernel.
+ *
+ *  A refreshed tuning database occasionally ships a kernel that is slower
+ *  on specific machines, and today the only remedy is swapping the whole
+ *  artifact back. runtime.CanaryDispatch wraps the tuned and fallback
+ *  versions of a function: the first 2N calls alternate between them while
+ *  accumulating wall time, then the per-machine winner is bound for the
+ *  rest of the process and persisted to a local decision file
+ *  (TVM_CANARY_CACHE_FILE) keyed by the caller's string, so later
+ *  processes skip the measurement phase entirely. Timings are wall clock
+ *  around the call; on stream-ordered devices wrap an entry point that
+ *  synchronizes (e.g. the executor's run) rather than a bare kernel
+ *  launch.
+ */
+#include <tvm/runtime/packed_func.h>
+#include <tvm/runtime/registry.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+namespace tvm {
+namespace runtime {
+
+namespace {
+
+/*! \brief Process-wide view of the persisted canary decisions. */
+class CanaryDecisionFile {
+ public:
+  static CanaryDecisionFile* Global() {
+    static CanaryDecisionFile* inst = new CanaryDecisionFile();
+    return inst;
+  }
+
+  // Returns 0 = undecided, 1 = tuned, 2 = fallback.
+  int Lookup(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = decisions_.find(key);
+    return it == decisions_.end() ? 0 : it->second;
+  }
+
+  void Record(const std::string& key, int winner) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    decisions_[key] = winner;
+    if (path_.empty()) return;
+    std::ofstream out(path_, std::ios::app);
+    if (out) {
+      out << key << " " << winner << "\n";
+    }
+  }
+
+ private:
+  CanaryDecisionFile() {
+    const char* path = std::getenv("TVM_CANARY_CACHE_FILE");
+    if (path == nullptr) return;
+    path_ = path;
+    std::ifstream in(path_);
+    std::string key;
+    int winner;
+    while (in >> key >> winner) {
+      decisions_[key] = winner;
+    }
+  }
+
+  std::mutex mutex_;
+  std::string path_;
+  std::unordered_map<std::string, int> decisions_;
+};
+
+/*! \brief Mutable measurement state shared by the dispatching closure. */
+struct CanaryState {
+  PackedFunc tuned;
+  PackedFunc fallback;
+  std::string key;
+  int trials_per_side;
+  std::mutex mutex;
+  int calls{0};
+  int64_t tuned_ns{0};
+  int64_t fallback_ns{0};
+  int winner{0};  // 0 = measuring, 1 = tuned, 2 = fallback
+};
+
+}  // namespace
+
+PackedFunc CanaryDispatch(PackedFunc tuned, PackedFunc fallback, int trials_per_side,
+                          std::string key) {
+  ICHECK(tuned != nullptr && fallback != nullptr);
+  ICHECK_GT(trials_per_side, 0);
+  auto state = std::make_shared<CanaryState>();
+  state->tuned = tuned;
+  state->fallback = fallback;
+  state->key = key;
+  state->trials_per_side = trials_per_side;
+  state->winner = CanaryDecisionFile::Global()->Lookup(key);
+
+  return PackedFunc([state](TVMArgs args, TVMRetValue* rv) {
+    int winner;
+    int call_index = -1;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      winner = state->winner;
+      if (winner == 0) {
+        call_index = state->calls++;
+      }
+    }
+    if (winner == 1) {
+      state->tuned.CallPacked(args, rv);
+      return;
+    }
+    if (winner == 2) {
+      state->fallback.CallPacked(args, rv);
+      return;
+    }
+    // Measurement phase: alternate sides so drift affects both equally.
+    bool use_tuned = (call_index % 2) == 0;
+    auto begin = std::chrono::steady_clock::now();
+    if (use_tuned) {
+      state->tuned.CallPacked(args, rv);
+    } else {
+      state->fallback.CallPacked(args, rv);
+    }
+    auto end = std::chrono::steady_clock::now();
+    int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (use_tuned) {
+      state->tuned_ns += ns;
+    } else {
+      state->fallback_ns += ns;
+    }
+    if (state->calls >= 2 * state->trials_per_side && state->winner == 0) {
+      state->winner = (state->tuned_ns <= state->fallback_ns) ? 1 : 2;
+      CanaryDecisionFile::Global()->Record(state->key, state->winner);
+    }
+  });
+}
+
+TVM_REGISTER_GLOBAL("runtime.CanaryDispatch")
+    .set_body_typed([](PackedFunc tuned, PackedFunc fallback, int trials_per_side, String key) {
+      return CanaryDispatch(tuned, fallback, trials_per_side, std::string(key));
+    });
+
+}  // namespace runtime
+}  // namespace tvm
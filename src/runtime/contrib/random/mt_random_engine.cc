@@ -24,9 +24,12 @@
 #include <tvm/runtime/device_api.h>
 #include <tvm/runtime/logging.h>
 #include <tvm/runtime/ndarray.h>
+#include <tvm/runtime/registry.h>
+#include <tvm/support/parallel_for.h>
 
 #include <algorithm>
 #include <ctime>
+#include <vector>
 #include <random>
 
 #include "../3rdparty/compiler-rt/builtin_fp16.h"
@@ -124,41 +127,88 @@ class RandomEngine {
     if (data->device.device_type == kDLCPU) {
       FillData(data, size);
     } else {
-      runtime::NDArray local = runtime::NDArray::Empty(
-          std::vector<int64_t>{data->shape, data->shape + data->ndim}, data->dtype, {kDLCPU, 0});
+      // Stage through pooled pinned memory when filling a CUDA device: the
+      // page-locking pass per pageable upload is pure per-trial overhead in
+      // tuning measure loops. The transfer may be stream-asynchronous, so
+      // sync before the staging buffer returns to the pool for reuse.
+      runtime::NDArray local;
+      const runtime::PackedFunc* pinned_empty = nullptr;
+      if (data->device.device_type == kDLCUDA) {
+        pinned_empty = runtime::Registry::Get("runtime.cuda.PinnedWorkspaceEmpty");
+      }
+      if (pinned_empty != nullptr) {
+        local = (*pinned_empty)(
+            runtime::ShapeTuple(data->shape, data->shape + data->ndim),
+            runtime::DataType(data->dtype));
+      } else {
+        local = runtime::NDArray::Empty(
+            std::vector<int64_t>{data->shape, data->shape + data->ndim}, data->dtype, {kDLCPU, 0});
+      }
       DLTensor* tensor = const_cast<DLTensor*>(local.operator->());
       FillData(tensor, size);
       runtime::NDArray::CopyFromTo(tensor, data);
+      if (pinned_empty != nullptr) {
+        runtime::DeviceAPI::Get(data->device)->StreamSync(data->device, nullptr);
+      }
     }
   }
 
  private:
   void FillData(DLTensor* tensor, int64_t size) {
+    // Large fills run as independent chunks, each with its own engine
+    // seeded from the base engine (counter-style), so generation scales
+    // with cores and stays deterministic for a given engine state. Small
+    // fills keep the serial path and the historical stream.
+    constexpr int64_t kParallelGrain = 1 << 18;
+    if (size < kParallelGrain) {
+      FillRange(tensor, 0, size, &rnd_engine_);
+      return;
+    }
+    int num_chunks = static_cast<int>(std::min<int64_t>(size / kParallelGrain + 1, 16));
+    int64_t chunk = (size + num_chunks - 1) / num_chunks;
+    std::vector<unsigned> seeds(num_chunks);
+    for (int c = 0; c < num_chunks; ++c) {
+      seeds[c] = static_cast<unsigned>(rnd_engine_());
+    }
+    support::parallel_for(0, num_chunks, [&](int c) {
+      std::mt19937 engine(seeds[c]);
+      int64_t begin = c * chunk;
+      int64_t end = std::min<int64_t>(begin + chunk, size);
+      if (begin < end) {
+        FillRange(tensor, begin, end - begin, &engine);
+      }
+    });
+  }
+
+  void FillRange(DLTensor* tensor, int64_t offset, int64_t count, std::mt19937* engine) {
     // Make the value be 1.0 - 10.0, not (0.0 - 1.0) so that we could satisfy
     // quantized dtype (uint8 / int8) data non-empty requirement
     std::uniform_real_distribution<> dist(1.0, 10.0);
+    std::mt19937& rnd = *engine;
     // Use float representation could make us work well on float / int type too.
     if (tensor->dtype.bits == 1) {
-      std::generate_n(static_cast<bool*>(tensor->data), size, [&]() { return dist(rnd_engine_); });
+      std::generate_n(static_cast<bool*>(tensor->data) + offset, count,
+                      [&]() { return dist(rnd); });
     } else if (tensor->dtype.bits == 4) {
       // For uint4/int4 we pack two values into a single byte.
       // Thus, to ensure both values are non-zero, we use a distribution of 17 - 30.
       std::uniform_real_distribution<> packed_dist(17.0, 30.0);
-      std::generate_n(reinterpret_cast<uint8_t*>(tensor->data), size,
-                      [&]() { return packed_dist(rnd_engine_); });
+      std::generate_n(reinterpret_cast<uint8_t*>(tensor->data) + offset, count,
+                      [&]() { return packed_dist(rnd); });
     } else if (tensor->dtype.bits == 8) {
-      std::generate_n(static_cast<uint8_t*>(tensor->data), size,
-                      [&]() { return dist(rnd_engine_); });
+      std::generate_n(static_cast<uint8_t*>(tensor->data) + offset, count,
+                      [&]() { return dist(rnd); });
     } else if (tensor->dtype.bits == 16) {
-      std::generate_n(static_cast<uint16_t*>(tensor->data), size, [&]() {
+      std::generate_n(static_cast<uint16_t*>(tensor->data) + offset, count, [&]() {
         return __truncXfYf2__<float, uint32_t, 23, uint16_t, uint16_t, 10>(
-            static_cast<float>(dist(rnd_engine_)));
+            static_cast<float>(dist(rnd)));
       });
     } else if (tensor->dtype.bits == 32) {
-      std::generate_n(static_cast<float*>(tensor->data), size, [&]() { return dist(rnd_engine_); });
+      std::generate_n(static_cast<float*>(tensor->data) + offset, count,
+                      [&]() { return dist(rnd); });
     } else if (tensor->dtype.bits == 64) {
-      std::generate_n(static_cast<double*>(tensor->data), size,
-                      [&]() { return dist(rnd_engine_); });
+      std::generate_n(static_cast<double*>(tensor->data) + offset, count,
+                      [&]() { return dist(rnd); });
     } else {
       LOG(FATAL) << "Doesn't support dtype code " << tensor->dtype.code << " dtype bits "
                  << tensor->dtype.bits;
@@ -24,7 +24,11 @@
 #include <tvm/runtime/device_api.h>
 #include <tvm/runtime/logging.h>
 #include <tvm/runtime/registry.h>
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -53,6 +57,26 @@ class CPUDeviceAPI final : public DeviceAPI {
     ptr = memalign(alignment, nbytes);
     if (ptr == nullptr) throw std::bad_alloc();
 #else
+#if defined(__linux__)
+    // Large tensors run with 4K TLB entries otherwise; above the configured
+    // threshold (TVM_CPU_HUGEPAGE_MIN_BYTES, unset = disabled) align the
+    // allocation to the huge page size and ask the kernel for transparent
+    // huge pages. madvise is advisory, so platforms or pressure states that
+    // cannot supply them degrade to normal pages with no error.
+    static const size_t hugepage_min_bytes = []() -> size_t {
+      const char* val = getenv("TVM_CPU_HUGEPAGE_MIN_BYTES");
+      return val ? static_cast<size_t>(atoll(val)) : 0;
+    }();
+    if (hugepage_min_bytes != 0 && nbytes >= hugepage_min_bytes) {
+      constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+      size_t huge_alignment = std::max(alignment, kHugePageSize);
+      size_t padded = (nbytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+      int ret = posix_memalign(&ptr, huge_alignment, padded);
+      if (ret != 0) throw std::bad_alloc();
+      madvise(ptr, padded, MADV_HUGEPAGE);
+      return ptr;
+    }
+#endif
     // posix_memalign is available in android ndk since __ANDROID_API__ >= 17
     int ret = posix_memalign(&ptr, alignment, nbytes);
     if (ret != 0) throw std::bad_alloc();
@@ -72,6 +96,7 @@ class CPUDeviceAPI final : public DeviceAPI {
 
   void* AllocWorkspace(Device dev, size_t size, DLDataType type_hint) final;
   void FreeWorkspace(Device dev, void* data) final;
+  void ReleaseUnusedMemory(Device dev) final;
 
   static CPUDeviceAPI* Global() {
     // NOTE: explicitly use new to avoid exit-time destruction of global state
@@ -96,6 +121,10 @@ void* CPUDeviceAPI::AllocWorkspace(Device dev, size_t size, DLDataType type_hint
   return dmlc::ThreadLocalStore<CPUWorkspacePool>::Get()->AllocWorkspace(dev, size);
 }
 
+void CPUDeviceAPI::ReleaseUnusedMemory(Device dev) {
+  dmlc::ThreadLocalStore<CPUWorkspacePool>::Get()->ReleaseFreeMemory(dev);
+}
+
 void CPUDeviceAPI::FreeWorkspace(Device dev, void* data) {
   dmlc::ThreadLocalStore<CPUWorkspacePool>::Get()->FreeWorkspace(dev, data);
 }
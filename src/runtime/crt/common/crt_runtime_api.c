@@ -443,6 +443,11 @@ tvm_crt_error_t TVMInitializeRuntime() {
     error = TVMFuncRegisterGlobal("tvm.contrib.random.random_fill", &TVMContribRandomFill, 0);
   }
 
+  if (error == kTvmErrorNoError) {
+    // Resident kernel slot for flashless iterative measurement.
+    error = TVMKernelSlotInit();
+  }
+
   if (error != kTvmErrorNoError) {
     TVMPlatformMemoryFree(registry_backing_memory, dev);
   }
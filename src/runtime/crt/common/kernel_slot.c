@@ -0,0 +1,116 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file kernel_slot.c
+ * \brief Resident kernel slot for flashless iterative measurement.
+ *
+ * Tuning a kernel on a microcontroller pays a reflash or session restart
+ * per measure batch. With a kernel slot, the device instead stays resident
+ * in its RPC measurement loop: the host pushes each candidate as a
+ * position-independent blob over the existing transport, tvm.rpc.kernel_slot_install
+ * copies it into a platform-provided executable RAM region and registers
+ * the entry point as a global function, and the resident time evaluator
+ * measures it like any other function. The platform supplies the region
+ * and the icache maintenance through two hooks (weak no-op defaults cover
+ * hosts with unified, coherent memory); candidate blobs must be linked
+ * position-independent or for the slot's fixed address, which the build
+ * side controls.
+ */
+#include <string.h>
+#include <tvm/runtime/c_backend_api.h>
+#include <tvm/runtime/c_runtime_api.h>
+#include <tvm/runtime/crt/error_codes.h>
+#include <tvm/runtime/crt/platform.h>
+
+/*!
+ * \brief Platform hook: executable memory for the kernel slot.
+ *
+ * The default implementation hands out a static buffer that is executable
+ * on hosts and flat-memory devices; platforms with MPU-protected or
+ * non-unified memory override it (and the flush hook below) with a region
+ * mapped for execution.
+ */
+__attribute__((weak)) tvm_crt_error_t TVMPlatformExecutableMemory(size_t num_bytes,
+                                                                  void** out_ptr) {
+#ifndef TVM_CRT_KERNEL_SLOT_BYTES
+#define TVM_CRT_KERNEL_SLOT_BYTES (16 * 1024)
+#endif
+  static unsigned char __attribute__((aligned(64))) slot[TVM_CRT_KERNEL_SLOT_BYTES];
+  if (num_bytes > sizeof(slot)) {
+    return kTvmErrorPlatformNoMemory;
+  }
+  *out_ptr = slot;
+  return kTvmErrorNoError;
+}
+
+/*! \brief Platform hook: make freshly written code visible to the fetch
+ *  path. No-op default for coherent hosts. */
+__attribute__((weak)) tvm_crt_error_t TVMPlatformFlushICache(void* addr, size_t num_bytes) {
+  (void)addr;
+  (void)num_bytes;
+  return kTvmErrorNoError;
+}
+
+/*!
+ * \brief Install a kernel blob into the slot and register its entry point.
+ *
+ * args: (blob_bytes, entry_offset, name). The entry point must follow the
+ * TVMBackendPackedCFunc convention, like every generated kernel.
+ */
+static int KernelSlotInstall(TVMValue* args, int* type_codes, int num_args, TVMValue* ret_value,
+                             int* ret_type_codes, void* resource_handle) {
+  (void)resource_handle;
+  if (num_args != 3 || type_codes[0] != kTVMBytes || type_codes[2] != kTVMStr) {
+    return kTvmErrorFunctionCallWrongArgType;
+  }
+  TVMByteArray* blob = (TVMByteArray*)args[0].v_handle;
+  int64_t entry_offset = args[1].v_int64;
+  const char* name = args[2].v_str;
+  if (entry_offset < 0 || (size_t)entry_offset >= blob->size) {
+    return kTvmErrorFunctionCallInvalidArg;
+  }
+  void* region = NULL;
+  tvm_crt_error_t err = TVMPlatformExecutableMemory(blob->size, &region);
+  if (err != kTvmErrorNoError) {
+    return err;
+  }
+  memcpy(region, blob->data, blob->size);
+  err = TVMPlatformFlushICache(region, blob->size);
+  if (err != kTvmErrorNoError) {
+    return err;
+  }
+  TVMFunctionHandle entry = (TVMFunctionHandle)((char*)region + entry_offset);
+  // Re-installing under the same name replaces the previous candidate, so
+  // one slot serves the whole tuning session.
+  int reg_err = TVMFuncRegisterGlobal(name, entry, /* override= */ 1);
+  if (reg_err != 0) {
+    return reg_err;
+  }
+  ret_value[0].v_int64 = 0;
+  ret_type_codes[0] = kTVMArgInt;
+  return 0;
+}
+
+/*! \brief Hook the installer into the global registry at startup. */
+tvm_crt_error_t TVMKernelSlotInit(void) {
+  return (tvm_crt_error_t)TVMFuncRegisterGlobal("tvm.rpc.kernel_slot_install",
+                                                (TVMFunctionHandle)&KernelSlotInstall,
+                                                /* override= */ 1);
+}
@@ -943,6 +943,16 @@ int TVMGraphExecutor_SetupStorage(TVMGraphExecutor* executor) {
   for (idx = 0; idx < attrs->dltype_count; idx++) {
     vtype[idx] = String2DLDataType(attrs->dltype + idx * TVM_CRT_MAX_STRLEN_DLTYPE);
   }
+  // The dtype strings exist only to be parsed into vtype above; on
+  // RAM-constrained parts keeping TVM_CRT_MAX_STRLEN_DLTYPE bytes per entry
+  // alive for the executor's lifetime is pure waste. Release clears the
+  // pointer, so the teardown path stays idempotent.
+  err = TVMPlatformMemoryFree(attrs->dltype, alloc_dev);
+  if (err != kTvmErrorNoError) {
+    fprintf(stderr, "memory free error: %08x", err);
+    return -1;
+  }
+  attrs->dltype = 0;
 
   // Size and device type of each storage pool entry.
   TVMGraphExecutorPoolEntry* pool_entry = NULL;
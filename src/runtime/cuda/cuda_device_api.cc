@@ -23,6 +23,11 @@
  */
 #include <cuda.h>
 #include <cuda_runtime.h>
+
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <utility>
 #include <dmlc/thread_local.h>
 #include <tvm/runtime/device_api.h>
 #include <tvm/runtime/profiling.h>
@@ -120,6 +125,15 @@ class CUDADeviceAPI final : public DeviceAPI {
       CUDA_CALL(cudaMemGetInfo(&free_mem, &total_mem));
       VLOG(1) << "allocating " << nbytes << " bytes on device, with " << free_mem
               << " bytes currently free out of " << total_mem << " bytes available";
+#if CUDART_VERSION >= 11020
+      if (UseMallocAsync(dev.device_id)) {
+        // Stream-ordered allocation: no device-wide synchronization, so
+        // dynamic-shape workloads on concurrent streams stop serializing on
+        // cudaMalloc.
+        CUDA_CALL(cudaMallocAsync(&ret, nbytes, GetStream()));
+        return ret;
+      }
+#endif
       CUDA_CALL(cudaMalloc(&ret, nbytes));
     }
     return ret;
@@ -132,6 +146,15 @@ class CUDADeviceAPI final : public DeviceAPI {
     } else {
       CUDA_CALL(cudaSetDevice(dev.device_id));
       VLOG(1) << "freeing device memory";
+#if CUDART_VERSION >= 11020
+      if (UseMallocAsync(dev.device_id)) {
+        // Free on the legacy default stream: it orders after all blocking
+        // streams, so the pages cannot be recycled while a kernel launched
+        // from another thread's stream still reads them.
+        CUDA_CALL(cudaFreeAsync(ptr, nullptr));
+        return;
+      }
+#endif
       CUDA_CALL(cudaFree(ptr));
     }
   }
@@ -163,7 +186,11 @@ class CUDADeviceAPI final : public DeviceAPI {
       if (dev_from.device_id == dev_to.device_id) {
         GPUCopy(from, to, size, cudaMemcpyDeviceToDevice, cu_stream);
       } else {
-        cudaMemcpyPeerAsync(to, dev_to.device_id, from, dev_from.device_id, size, cu_stream);
+        // Without peer access enabled the peer copy silently stages through
+        // host memory, doubling the PCIe hops; enable it lazily per pair.
+        EnablePeerAccess(dev_from.device_id, dev_to.device_id);
+        CUDA_CALL(
+            cudaMemcpyPeerAsync(to, dev_to.device_id, from, dev_from.device_id, size, cu_stream));
       }
     } else if (dev_from.device_type == kDLCUDA && dev_to.device_type == kDLCPU) {
       CUDA_CALL(cudaSetDevice(dev_from.device_id));
@@ -206,6 +233,73 @@ class CUDADeviceAPI final : public DeviceAPI {
     CUDA_CALL(cudaStreamSynchronize(static_cast<cudaStream_t>(stream)));
   }
 
+#if CUDART_VERSION >= 11020
+  /*!
+   * \brief Whether stream-ordered allocation is enabled and supported.
+   *
+   *  Opt in with TVM_CUDA_MALLOC_ASYNC=1; devices (or drivers) without
+   *  memory pool support silently keep the cudaMalloc path. The answer is
+   *  cached per device, and all allocations of a device consistently use one
+   *  path so frees always match.
+   */
+  static bool UseMallocAsync(int device_id) {
+    static bool enabled = []() {
+      const char* val = getenv("TVM_CUDA_MALLOC_ASYNC");
+      return val && atoi(val) != 0;
+    }();
+    if (!enabled) return false;
+    static std::mutex mu;
+    static std::unordered_map<int, bool> supported;
+    std::lock_guard<std::mutex> lock(mu);
+    auto it = supported.find(device_id);
+    if (it == supported.end()) {
+      int value = 0;
+      cudaError_t err =
+          cudaDeviceGetAttribute(&value, cudaDevAttrMemoryPoolsSupported, device_id);
+      if (err != cudaSuccess) {
+        cudaGetLastError();  // clear the error state
+        value = 0;
+      }
+      it = supported.emplace(device_id, value != 0).first;
+    }
+    return it->second;
+  }
+
+  /*! \brief The stream allocations are ordered on (thread-local, may be null
+   * for the legacy default stream). */
+  static cudaStream_t GetStream() { return CUDAThreadEntry::ThreadLocal()->stream; }
+#endif
+
+  /*!
+   * \brief Enable peer access between two devices once, in both directions.
+   *
+   *  Devices without a peer link (e.g. across sockets without NVLink) keep
+   *  the staged path; the enable result is cached per ordered pair.
+   */
+  static void EnablePeerAccess(int from_id, int to_id) {
+    static std::mutex mutex;
+    static std::set<std::pair<int, int>> attempted;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto pair : {std::make_pair(from_id, to_id), std::make_pair(to_id, from_id)}) {
+      if (!attempted.insert(pair).second) continue;
+      int can_access = 0;
+      cudaError_t err = cudaDeviceCanAccessPeer(&can_access, pair.first, pair.second);
+      if (err != cudaSuccess || !can_access) {
+        cudaGetLastError();  // clear the error state
+        continue;
+      }
+      CUDA_CALL(cudaSetDevice(pair.first));
+      err = cudaDeviceEnablePeerAccess(pair.second, 0);
+      if (err != cudaSuccess && err != cudaErrorPeerAccessAlreadyEnabled) {
+        LOG(WARNING) << "Cannot enable peer access from device " << pair.first << " to device "
+                     << pair.second << ": " << cudaGetErrorString(err);
+      }
+      cudaGetLastError();  // clear any already-enabled error state
+    }
+    // Restore the device the caller had selected.
+    CUDA_CALL(cudaSetDevice(from_id));
+  }
+
   void SetStream(Device dev, TVMStreamHandle stream) final {
     CUDAThreadEntry::ThreadLocal()->stream = static_cast<cudaStream_t>(stream);
   }
@@ -218,6 +312,10 @@ class CUDADeviceAPI final : public DeviceAPI {
     CUDAThreadEntry::ThreadLocal()->pool.FreeWorkspace(dev, data);
   }
 
+  void ReleaseUnusedMemory(Device dev) final {
+    CUDAThreadEntry::ThreadLocal()->pool.ReleaseFreeMemory(dev);
+  }
+
   static CUDADeviceAPI* Global() {
     // NOTE: explicitly use new to avoid exit-time destruction of global state
     // Global state will be recycled by OS as the process exits.
@@ -252,6 +350,97 @@ TVM_REGISTER_GLOBAL("device_api.cuda_host").set_body([](TVMArgs args, TVMRetValu
   *rv = static_cast<void*>(ptr);
 });
 
+/*!
+ * \brief Pooled pinned host staging buffers.
+ *
+ *  Tuning measure loops upload fresh inputs every trial; pageable staging
+ *  pays a page-locking pass per copy and forbids async transfers. This pool
+ *  recycles cudaMallocHost blocks the way the device workspace pool
+ *  recycles device blocks, and hands them out as kDLCUDAHost NDArrays whose
+ *  deleter returns the block instead of freeing it.
+ */
+class CUDAPinnedPool {
+ public:
+  static CUDAPinnedPool* Global() {
+    static CUDAPinnedPool* inst = new CUDAPinnedPool();
+    return inst;
+  }
+
+  NDArray Empty(ShapeTuple shape, DLDataType dtype) {
+    Device host{kDLCUDAHost, 0};
+    size_t nbytes = (dtype.bits * dtype.lanes + 7) / 8;
+    for (int64_t dim : shape) {
+      nbytes *= static_cast<size_t>(dim);
+    }
+    void* data;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      data = pool_.AllocWorkspace(host, nbytes);
+    }
+    auto* container = new NDArray::Container(data, shape, dtype, host);
+    container->SetDeleter([](Object* obj) {
+      auto* ptr = static_cast<NDArray::Container*>(obj);
+      CUDAPinnedPool* pool = CUDAPinnedPool::Global();
+      std::lock_guard<std::mutex> lock(pool->mutex_);
+      pool->pool_.FreeWorkspace(Device{kDLCUDAHost, 0}, ptr->dl_tensor.data);
+      delete ptr;
+    });
+    return NDArray(GetObjectPtr<Object>(container));
+  }
+
+ private:
+  CUDAPinnedPool() : pool_(kDLCUDAHost, CUDADeviceAPI::Global()) {}
+  // One process-wide pool: pinned memory is a host-global resource, and a
+  // mutex beats pinning pages once per thread.
+  std::mutex mutex_;
+  WorkspacePool pool_;
+};
+
+TVM_REGISTER_GLOBAL("runtime.cuda.PinnedWorkspaceEmpty")
+    .set_body_typed([](ShapeTuple shape, DataType dtype) {
+      return CUDAPinnedPool::Global()->Empty(shape, dtype);
+    });
+
+/*! \brief Thread-local pool of CUDA events: timers churn two events per
+ * measured op, and cudaEventCreate is costly enough to distort sub-100us
+ * measurements. */
+class CudaEventPool {
+ public:
+  static CudaEventPool* ThreadLocal() {
+    static thread_local CudaEventPool pool;
+    return &pool;
+  }
+
+  cudaEvent_t Acquire() {
+    if (!free_events_.empty()) {
+      cudaEvent_t evt = free_events_.back();
+      free_events_.pop_back();
+      return evt;
+    }
+    cudaEvent_t evt;
+    CUDA_CALL(cudaEventCreate(&evt));
+    return evt;
+  }
+
+  void Release(cudaEvent_t evt) {
+    if (free_events_.size() < kMaxPooled) {
+      free_events_.push_back(evt);
+    } else {
+      CUDA_CALL(cudaEventDestroy(evt));
+    }
+  }
+
+ private:
+  static constexpr size_t kMaxPooled = 64;
+  std::vector<cudaEvent_t> free_events_;
+
+  ~CudaEventPool() {
+    for (cudaEvent_t evt : free_events_) {
+      cudaEventDestroy(evt);  // best effort at thread exit
+    }
+  }
+};
+
 class GPUTimerNode : public TimerNode {
  public:
   virtual void Start() {
@@ -265,12 +454,12 @@ class GPUTimerNode : public TimerNode {
     return milliseconds * 1e6;
   }
   virtual ~GPUTimerNode() {
-    CUDA_CALL(cudaEventDestroy(start_));
-    CUDA_CALL(cudaEventDestroy(stop_));
+    CudaEventPool::ThreadLocal()->Release(start_);
+    CudaEventPool::ThreadLocal()->Release(stop_);
   }
   GPUTimerNode() {
-    CUDA_CALL(cudaEventCreate(&start_));
-    CUDA_CALL(cudaEventCreate(&stop_));
+    start_ = CudaEventPool::ThreadLocal()->Acquire();
+    stop_ = CudaEventPool::ThreadLocal()->Acquire();
   }
 
   static constexpr const char* _type_key = "GPUTimerNode";
@@ -0,0 +1,97 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file density_dispatch.cc
+ * \brief Runtime selection between dense and sparse kernel variants.
+ *
+ *  Pruned models vary sparsity per layer, so a compile-time block-sparse
+ *  conversion either over- or under-commits. A graph that carries both the
+ *  dense and the sparse kernel for a flagged layer can instead measure the
+ *  actual weight density once at load and bind the faster variant:
+ *  runtime.MeasureDensity computes the nonzero fraction of a CPU tensor, and
+ *  runtime.DensityDispatch returns the sparse function when the density is
+ *  at or below the threshold and the dense function otherwise.
+ */
+#include <tvm/runtime/ndarray.h>
+#include <tvm/runtime/packed_func.h>
+#include <tvm/runtime/registry.h>
+
+#include <cmath>
+#include <cstdint>
+
+namespace tvm {
+namespace runtime {
+
+namespace {
+
+template <typename T>
+int64_t CountNonZero(const T* data, int64_t num_elems) {
+  int64_t nonzero = 0;
+  for (int64_t i = 0; i < num_elems; ++i) {
+    nonzero += (data[i] != T(0)) ? 1 : 0;
+  }
+  return nonzero;
+}
+
+}  // namespace
+
+double MeasureDensity(NDArray weights) {
+  const DLTensor* tensor = weights.operator->();
+  CHECK_EQ(tensor->device.device_type, kDLCPU) << "MeasureDensity expects a CPU tensor";
+  CHECK(IsContiguous(*tensor)) << "MeasureDensity expects a compact tensor";
+  CHECK_EQ(tensor->dtype.lanes, 1);
+  int64_t num_elems = 1;
+  for (int i = 0; i < tensor->ndim; ++i) {
+    num_elems *= tensor->shape[i];
+  }
+  if (num_elems == 0) return 0.0;
+  const char* data = static_cast<const char*>(tensor->data) + tensor->byte_offset;
+  int64_t nonzero = 0;
+  if (tensor->dtype.code == kDLFloat && tensor->dtype.bits == 32) {
+    nonzero = CountNonZero(reinterpret_cast<const float*>(data), num_elems);
+  } else if (tensor->dtype.code == kDLFloat && tensor->dtype.bits == 64) {
+    nonzero = CountNonZero(reinterpret_cast<const double*>(data), num_elems);
+  } else if (tensor->dtype.bits == 8) {
+    nonzero = CountNonZero(reinterpret_cast<const int8_t*>(data), num_elems);
+  } else if (tensor->dtype.bits == 16) {
+    // Any nonzero bit pattern counts, which is exact for integers and treats
+    // fp16 negative zero as nonzero - fine for a density heuristic.
+    nonzero = CountNonZero(reinterpret_cast<const uint16_t*>(data), num_elems);
+  } else if (tensor->dtype.bits == 32) {
+    nonzero = CountNonZero(reinterpret_cast<const int32_t*>(data), num_elems);
+  } else if (tensor->dtype.bits == 64) {
+    nonzero = CountNonZero(reinterpret_cast<const int64_t*>(data), num_elems);
+  } else {
+    LOG(FATAL) << "MeasureDensity: unsupported dtype";
+  }
+  return static_cast<double>(nonzero) / static_cast<double>(num_elems);
+}
+
+TVM_REGISTER_GLOBAL("runtime.MeasureDensity").set_body_typed(MeasureDensity);
+
+TVM_REGISTER_GLOBAL("runtime.DensityDispatch")
+    .set_body_typed([](PackedFunc dense_func, PackedFunc sparse_func, NDArray weights,
+                       double density_threshold) {
+      double density = MeasureDensity(weights);
+      return density <= density_threshold ? sparse_func : dense_func;
+    });
+
+}  // namespace runtime
+}  // namespace tvm
@@ -0,0 +1,264 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file dynamic_batcher.cc
+ * \brief Deadline-based request coalescing over a batched executor.
+ *
+ *  Every serving stack in front of TVM rebuilds the same dynamic batcher.
+ *  This module owns an executor compiled for batch B and a worker thread:
+ *  runtime.DynamicBatcherSubmit enqueues one sample's inputs and returns a
+ *  future; the worker flushes when B samples are pending or the oldest
+ *  sample's deadline expires, packing the samples into the batch inputs,
+ *  running once, and slicing each request's rows out of every output.
+ *  Short batches simply leave the tail rows stale - the executor always
+ *  runs its compiled bucket shape, and only valid rows are sliced out -
+ *  trading padded compute for the usual dynamic-batching throughput win.
+ */
+#include <tvm/runtime/device_api.h>
+#include <tvm/runtime/module.h>
+#include <tvm/runtime/ndarray.h>
+#include <tvm/runtime/packed_func.h>
+#include <tvm/runtime/registry.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace tvm {
+namespace runtime {
+
+/*! \brief One in-flight request: its inputs and its eventual outputs. */
+class BatchRequestObj : public Object {
+ public:
+  std::vector<NDArray> inputs;
+  std::chrono::steady_clock::time_point enqueue_time;
+
+  Array<NDArray> Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return done_; });
+    return outputs_;
+  }
+
+  void Complete(Array<NDArray> outputs) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      outputs_ = std::move(outputs);
+      done_ = true;
+    }
+    cv_.notify_all();
+  }
+
+  static constexpr const uint32_t _type_index = TypeIndex::kDynamic;
+  static constexpr const char* _type_key = "runtime.BatchRequest";
+  TVM_DECLARE_FINAL_OBJECT_INFO(BatchRequestObj, Object);
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool done_{false};
+  Array<NDArray> outputs_;
+};
+
+TVM_REGISTER_OBJECT_TYPE(BatchRequestObj);
+
+class BatchRequest : public ObjectRef {
+ public:
+  TVM_DEFINE_MUTABLE_OBJECT_REF_METHODS(BatchRequest, ObjectRef, BatchRequestObj);
+};
+
+class DynamicBatcher : public ModuleNode {
+ public:
+  void Init(Module executor, int num_data_inputs, int64_t deadline_us) {
+    executor_ = executor;
+    num_data_inputs_ = num_data_inputs;
+    deadline_ = std::chrono::microseconds(deadline_us);
+    run_ = executor_.GetFunction("run");
+    get_output_ = executor_.GetFunction("get_output");
+    get_input_ = executor_.GetFunction("get_input");
+    PackedFunc get_num_outputs = executor_.GetFunction("get_num_outputs");
+    ICHECK(run_ != nullptr && get_output_ != nullptr && get_input_ != nullptr &&
+           get_num_outputs != nullptr)
+        << "DynamicBatcher expects a graph-executor-style module";
+    num_outputs_ = get_num_outputs();
+    NDArray first_input = get_input_(0);
+    batch_size_ = first_input.Shape()[0];
+    ICHECK_GT(batch_size_, 0);
+    worker_ = std::thread([this]() { this->WorkerLoop(); });
+  }
+
+  ~DynamicBatcher() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shutdown_ = true;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) worker_.join();
+  }
+
+  const char* type_key() const final { return "DynamicBatcher"; }
+
+  BatchRequest Submit(Array<NDArray> inputs) {
+    ICHECK_EQ(static_cast<int>(inputs.size()), num_data_inputs_)
+        << "Expected one tensor per data input";
+    auto req = make_object<BatchRequestObj>();
+    for (const NDArray& arr : inputs) {
+      ICHECK_EQ(arr.Shape()[0], 1) << "Submissions carry a single sample (leading dim 1)";
+      req->inputs.push_back(arr);
+    }
+    req->enqueue_time = std::chrono::steady_clock::now();
+    BatchRequest ref(req);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ICHECK(!shutdown_);
+      pending_.push_back(ref);
+    }
+    cv_.notify_all();
+    return ref;
+  }
+
+  PackedFunc GetFunction(const std::string& name, const ObjectPtr<Object>& sptr_to_self) final {
+    if (name == "submit") {
+      return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+        Array<NDArray> inputs;
+        for (int i = 0; i < args.size(); ++i) {
+          inputs.push_back(args[i].operator NDArray());
+        }
+        *rv = this->Submit(inputs);
+      });
+    } else if (name == "wait") {
+      return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+        BatchRequest req = args[0];
+        *rv = req->Wait();
+      });
+    }
+    return PackedFunc();
+  }
+
+ private:
+  void WorkerLoop() {
+    for (;;) {
+      std::vector<BatchRequest> batch;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return shutdown_ || !pending_.empty(); });
+        if (shutdown_) {
+          // Unblock any waiters with empty results rather than hanging them.
+          while (!pending_.empty()) {
+            pending_.front()->Complete(Array<NDArray>());
+            pending_.pop_front();
+          }
+          return;
+        }
+        // Flush on a full bucket, or once the oldest sample's deadline
+        // expires; until then wait out the remaining slack for stragglers.
+        if (static_cast<int64_t>(pending_.size()) < batch_size_) {
+          auto flush_at = pending_.front()->enqueue_time + deadline_;
+          cv_.wait_until(lock, flush_at, [this] {
+            return shutdown_ || static_cast<int64_t>(pending_.size()) >= batch_size_;
+          });
+          if (shutdown_) continue;  // drain via the branch above
+        }
+        int64_t take = std::min<int64_t>(pending_.size(), batch_size_);
+        for (int64_t i = 0; i < take; ++i) {
+          batch.push_back(pending_.front());
+          pending_.pop_front();
+        }
+      }
+      if (batch.empty()) continue;
+      RunBatch(batch);
+    }
+  }
+
+  void RunBatch(const std::vector<BatchRequest>& batch) {
+    // Pack each request's sample rows into the batch inputs.
+    for (int input = 0; input < num_data_inputs_; ++input) {
+      NDArray staging = get_input_(input);
+      const DLTensor* ref = staging.operator->();
+      int64_t row_bytes = GetDataSize(*ref) / batch_size_;
+      for (size_t i = 0; i < batch.size(); ++i) {
+        const NDArray& sample = batch[i]->inputs[input];
+        DLTensor dst = *ref;
+        dst.data = static_cast<char*>(dst.data) + dst.byte_offset +
+                   static_cast<int64_t>(i) * row_bytes;
+        dst.byte_offset = 0;
+        dst.ndim = sample->ndim;
+        dst.shape = const_cast<int64_t*>(sample.operator->()->shape);
+        NDArray::CopyFromTo(sample.operator->(), &dst);
+      }
+    }
+    run_();
+    // Slice each request's rows out of every output, through the host.
+    std::vector<Array<NDArray>> results(batch.size());
+    for (int out = 0; out < num_outputs_; ++out) {
+      NDArray device_out = get_output_(out);
+      const DLTensor* ref = device_out.operator->();
+      std::vector<int64_t> row_shape(ref->shape, ref->shape + ref->ndim);
+      ICHECK(!row_shape.empty());
+      row_shape[0] = 1;
+      int64_t row_bytes = GetDataSize(*ref) / batch_size_;
+      for (size_t i = 0; i < batch.size(); ++i) {
+        NDArray row = NDArray::Empty(ShapeTuple(row_shape), ref->dtype, Device{kDLCPU, 0});
+        DLTensor src = *ref;
+        src.data = static_cast<char*>(src.data) + src.byte_offset +
+                   static_cast<int64_t>(i) * row_bytes;
+        src.byte_offset = 0;
+        src.ndim = row.operator->()->ndim;
+        src.shape = const_cast<int64_t*>(row.Shape().data());
+        NDArray::CopyFromTo(&src, const_cast<DLTensor*>(row.operator->()));
+        results[i].push_back(row);
+      }
+      DeviceAPI::Get(ref->device)->StreamSync(ref->device, nullptr);
+    }
+    for (size_t i = 0; i < batch.size(); ++i) {
+      batch[i]->Complete(std::move(results[i]));
+    }
+  }
+
+  Module executor_;
+  PackedFunc run_;
+  PackedFunc get_output_;
+  PackedFunc get_input_;
+  int num_data_inputs_{0};
+  int num_outputs_{0};
+  int64_t batch_size_{0};
+  std::chrono::microseconds deadline_{0};
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<BatchRequest> pending_;
+  bool shutdown_{false};
+  std::thread worker_;
+};
+
+TVM_REGISTER_GLOBAL("runtime.DynamicBatcherCreate")
+    .set_body_typed([](Module executor, int num_data_inputs, int64_t deadline_us) {
+      auto batcher = make_object<DynamicBatcher>();
+      batcher->Init(executor, num_data_inputs, deadline_us);
+      return Module(batcher);
+    });
+
+}  // namespace runtime
+}  // namespace tvm
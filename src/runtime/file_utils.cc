@@ -28,10 +28,20 @@
 #include <tvm/runtime/registry.h>
 #include <tvm/runtime/serializer.h>
 
+#include <cstring>
 #include <fstream>
+#include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace tvm {
 namespace runtime {
 
@@ -216,6 +226,204 @@ std::string SaveParams(const Map<String, NDArray>& params) {
   return bytes;
 }
 
+
+namespace {
+
+// Payload alignment of the aligned parameter format; matches the allocator
+// alignment so mapped tensors satisfy the same contract as AllocDataSpace.
+constexpr uint64_t kParamAlignment = kAllocAlignment;
+
+inline uint64_t AlignUp(uint64_t offset) {
+  return (offset + kParamAlignment - 1) / kParamAlignment * kParamAlignment;
+}
+
+// Owns the bytes that mmap-loaded NDArrays alias: either a file mapping or,
+// on platforms without mmap, a plain heap buffer holding the file contents.
+struct ParamsFileBuffer {
+  char* base{nullptr};
+  size_t size{0};
+  bool is_mmap{false};
+
+  ~ParamsFileBuffer() {
+#ifndef _WIN32
+    if (is_mmap) {
+      munmap(base, size);
+      return;
+    }
+#endif
+    delete[] base;
+  }
+};
+
+// Deleter for containers whose data aliases a ParamsFileBuffer.
+void ParamsFileBufferDeleter(Object* obj) {
+  auto* ptr = static_cast<NDArray::Container*>(obj);
+  delete static_cast<std::shared_ptr<ParamsFileBuffer>*>(ptr->manager_ctx);
+  delete ptr;
+}
+
+}  // namespace
+
+void SaveParamsAligned(const std::string& file_name, const Map<String, NDArray>& params) {
+  std::vector<std::string> names;
+  std::vector<const DLTensor*> arrays;
+  for (auto& p : params) {
+    const DLTensor* tensor = p.second.operator->();
+    ICHECK_EQ(tensor->device.device_type, kDLCPU)
+        << "SaveParamsAligned requires CPU-resident parameters";
+    ICHECK(tensor->strides == nullptr) << "SaveParamsAligned requires compact parameters";
+    names.push_back(p.first);
+    arrays.push_back(tensor);
+  }
+  // First pass over the metadata to learn where the payload section starts.
+  std::string header;
+  {
+    dmlc::MemoryStringStream hstrm(&header);
+    dmlc::Stream* strm = &hstrm;
+    uint64_t magic = kTVMNDArrayAlignedListMagic, reserved = 0;
+    strm->Write(magic);
+    strm->Write(reserved);
+    strm->Write(names);
+    uint64_t sz = arrays.size();
+    strm->Write(sz);
+    uint64_t offset = 0;  // patched on the second pass
+    for (const DLTensor* tensor : arrays) {
+      strm->Write(tensor->dtype);
+      uint64_t ndim = tensor->ndim;
+      strm->Write(ndim);
+      strm->WriteArray(tensor->shape, tensor->ndim);
+      strm->Write(offset);
+      uint64_t nbytes = GetDataSize(*tensor);
+      strm->Write(nbytes);
+    }
+  }
+  // Content-addressed payload layout: identical tensor payloads (shared
+  // embeddings across ensemble members) are stored once, with every
+  // duplicate's metadata pointing at the same offset. The mmap loader then
+  // aliases them onto the same pages automatically.
+  std::vector<uint64_t> payload_offset(arrays.size());
+  std::vector<bool> is_duplicate(arrays.size(), false);
+  {
+    std::unordered_map<size_t, std::vector<size_t>> content_index;
+    uint64_t offset = AlignUp(header.size());
+    for (size_t i = 0; i < arrays.size(); ++i) {
+      const char* data_i = static_cast<const char*>(arrays[i]->data) + arrays[i]->byte_offset;
+      uint64_t nbytes_i = GetDataSize(*arrays[i]);
+      size_t hash = runtime::String::HashBytes(data_i, nbytes_i);
+      bool found = false;
+      for (size_t j : content_index[hash]) {
+        const char* data_j = static_cast<const char*>(arrays[j]->data) + arrays[j]->byte_offset;
+        if (GetDataSize(*arrays[j]) == nbytes_i && std::memcmp(data_i, data_j, nbytes_i) == 0) {
+          payload_offset[i] = payload_offset[j];
+          is_duplicate[i] = true;
+          found = true;
+          break;
+        }
+      }
+      if (!found) {
+        content_index[hash].push_back(i);
+        payload_offset[i] = offset;
+        offset = AlignUp(offset + nbytes_i);
+      }
+    }
+  }
+
+  // Second pass with real offsets, now that the header size is known.
+  std::string bytes;
+  {
+    dmlc::MemoryStringStream bstrm(&bytes);
+    dmlc::Stream* strm = &bstrm;
+    uint64_t magic = kTVMNDArrayAlignedListMagic, reserved = 0;
+    strm->Write(magic);
+    strm->Write(reserved);
+    strm->Write(names);
+    uint64_t sz = arrays.size();
+    strm->Write(sz);
+    for (size_t i = 0; i < arrays.size(); ++i) {
+      const DLTensor* tensor = arrays[i];
+      strm->Write(tensor->dtype);
+      uint64_t ndim = tensor->ndim;
+      strm->Write(ndim);
+      strm->WriteArray(tensor->shape, tensor->ndim);
+      strm->Write(payload_offset[i]);
+      uint64_t nbytes = GetDataSize(*tensor);
+      strm->Write(nbytes);
+    }
+    ICHECK_EQ(bytes.size(), header.size());
+    for (size_t i = 0; i < arrays.size(); ++i) {
+      if (is_duplicate[i]) continue;
+      bytes.resize(AlignUp(bytes.size()), '\0');
+      ICHECK_EQ(bytes.size(), payload_offset[i]);
+      uint64_t nbytes = GetDataSize(*arrays[i]);
+      bytes.append(static_cast<const char*>(arrays[i]->data) + arrays[i]->byte_offset, nbytes);
+    }
+  }
+  SaveBinaryToFile(file_name, bytes);
+}
+
+Map<String, NDArray> LoadParamsMmap(const std::string& file_name) {
+  auto buffer = std::make_shared<ParamsFileBuffer>();
+#ifndef _WIN32
+  {
+    int fd = open(file_name.c_str(), O_RDONLY);
+    ICHECK_GE(fd, 0) << "Cannot open parameter file " << file_name;
+    struct stat st;
+    ICHECK_EQ(fstat(fd, &st), 0) << "Cannot stat parameter file " << file_name;
+    buffer->size = static_cast<size_t>(st.st_size);
+    // Copy-on-write mapping: reads alias the file pages, while a later
+    // in-place write (e.g. SetInput on a rebound parameter) faults in a
+    // private page instead of trapping on a read-only one.
+    void* base = mmap(nullptr, buffer->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    ICHECK(base != MAP_FAILED) << "Cannot mmap parameter file " << file_name;
+    buffer->base = static_cast<char*>(base);
+    buffer->is_mmap = true;
+  }
+#else
+  {
+    std::string bytes;
+    LoadBinaryFromFile(file_name, &bytes);
+    buffer->size = bytes.size();
+    buffer->base = new char[buffer->size];
+    std::memcpy(buffer->base, bytes.data(), buffer->size);
+  }
+#endif
+  dmlc::MemoryFixedSizeStream mstrm(buffer->base, buffer->size);
+  dmlc::Stream* strm = &mstrm;
+  uint64_t header, reserved;
+  ICHECK(strm->Read(&header)) << "Invalid aligned parameters file format";
+  ICHECK(header == kTVMNDArrayAlignedListMagic) << "Invalid aligned parameters file format";
+  ICHECK(strm->Read(&reserved)) << "Invalid aligned parameters file format";
+  std::vector<std::string> names;
+  ICHECK(strm->Read(&names)) << "Invalid aligned parameters file format";
+  uint64_t sz;
+  ICHECK(strm->Read(&sz)) << "Invalid aligned parameters file format";
+  ICHECK_EQ(sz, names.size()) << "Invalid aligned parameters file format";
+
+  Map<String, NDArray> params;
+  Device cpu_dev{kDLCPU, 0};
+  for (size_t i = 0; i < sz; ++i) {
+    DLDataType dtype;
+    uint64_t ndim, offset, nbytes;
+    ICHECK(strm->Read(&dtype)) << "Invalid aligned parameters file format";
+    ICHECK(strm->Read(&ndim)) << "Invalid aligned parameters file format";
+    std::vector<ShapeTuple::index_type> shape(ndim);
+    ICHECK(strm->ReadArray(shape.data(), ndim)) << "Invalid aligned parameters file format";
+    ICHECK(strm->Read(&offset)) << "Invalid aligned parameters file format";
+    ICHECK(strm->Read(&nbytes)) << "Invalid aligned parameters file format";
+    ICHECK_EQ(offset % kParamAlignment, 0) << "Misaligned payload in parameter file";
+    ICHECK_LE(offset + nbytes, buffer->size) << "Truncated parameter file";
+    auto* container =
+        new NDArray::Container(buffer->base + offset, ShapeTuple(shape), dtype, cpu_dev);
+    container->SetDeleter(ParamsFileBufferDeleter);
+    container->manager_ctx = new std::shared_ptr<ParamsFileBuffer>(buffer);
+    NDArray array(GetObjectPtr<Object>(container));
+    ICHECK_EQ(GetDataSize(*array.operator->()), nbytes) << "Corrupted parameter file";
+    params.Set(names[i], array);
+  }
+  return params;
+}
+
 TVM_REGISTER_GLOBAL("runtime.SaveParams").set_body_typed([](const Map<String, NDArray>& params) {
   std::string s = ::tvm::runtime::SaveParams(params);
   // copy return array so it is owned by the ret value
@@ -226,6 +434,13 @@ TVM_REGISTER_GLOBAL("runtime.SaveParams").set_body_typed([](const Map<String, ND
 TVM_REGISTER_GLOBAL("runtime.LoadParams").set_body_typed([](const String& s) {
   return ::tvm::runtime::LoadParams(s);
 });
+TVM_REGISTER_GLOBAL("runtime.SaveParamsAligned")
+    .set_body_typed([](const String& file_name, const Map<String, NDArray>& params) {
+      ::tvm::runtime::SaveParamsAligned(file_name, params);
+    });
+TVM_REGISTER_GLOBAL("runtime.LoadParamsMmap").set_body_typed([](const String& file_name) {
+  return ::tvm::runtime::LoadParamsMmap(file_name);
+});
 
 }  // namespace runtime
 }  // namespace tvm
@@ -121,6 +121,28 @@ std::string SaveParams(const Map<String, NDArray>& params);
  * \param params Parameters to save.
  */
 void SaveParams(dmlc::Stream* strm, const Map<String, NDArray>& params);
+
+/*! \brief Magic number for the aligned, mmap-able parameter file format. */
+constexpr uint64_t kTVMNDArrayAlignedListMagic = 0xF7E58D4F05049CB8;
+/*!
+ * \brief Save parameters into an aligned file that LoadParamsMmap can map.
+ *
+ *  Unlike SaveParams, every tensor payload is padded to kAllocAlignment so a
+ *  memory-mapped load can alias the file pages directly without copying.
+ * \param file_name Path of the file to write.
+ * \param params Parameters to save.
+ */
+void SaveParamsAligned(const std::string& file_name, const Map<String, NDArray>& params);
+/*!
+ * \brief Load parameters from an aligned parameter file without copying.
+ *
+ *  The returned CPU NDArrays alias the mapped file pages; the mapping is
+ *  unmapped once the last of them is destructed. Falls back to a single
+ *  read of the file on platforms without mmap.
+ * \param file_name Path of a file written by SaveParamsAligned.
+ * \return Map of parameter name to parameter value.
+ */
+Map<String, NDArray> LoadParamsMmap(const std::string& file_name);
 }  // namespace runtime
 }  // namespace tvm
 #endif  // TVM_RUNTIME_FILE_UTILS_H_
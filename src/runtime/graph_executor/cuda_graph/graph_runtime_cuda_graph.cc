@@ -41,14 +41,51 @@ namespace runtime {
  */
 class GraphExecutorCudaGraph : public GraphExecutor {
  public:
+  /*!
+   * \brief Run the whole graph as a single CUDA graph launch.
+   *
+   *  The first call captures the op sequence on a dedicated stream and
+   *  instantiates the executable graph; subsequent calls replay it with one
+   *  cudaGraphLaunch. The capture is invalidated whenever an input is rebound
+   *  through SetInputZeroCopy, since the captured kernels bake in the old
+   *  device addresses.
+   */
+  void Run() override {
+    if (!captured_) {
+      StartCapture();
+      GraphExecutor::Run();
+      EndCapture();
+      captured_ = true;
+    }
+    RunCudaGraph();
+  }
+
+  void SetInputZeroCopy(int index, DLTensor* data_ref) override {
+    InvalidateCapture();
+    GraphExecutor::SetInputZeroCopy(index, data_ref);
+  }
+
+  void SetOutputZeroCopy(int index, DLTensor* data_ref) override {
+    // Output rebinding rewrites the same op-argument pointers the captured
+    // kernels baked in; without invalidation the instantiated graph keeps
+    // writing to the old output address.
+    InvalidateCapture();
+    GraphExecutor::SetOutputZeroCopy(index, data_ref);
+  }
+
+  ~GraphExecutorCudaGraph() { InvalidateCapture(); }
+
   /*!
    * \brief Begin CUDA graph capture on stream, the stream enters capture mode.
    */
   void StartCapture() {
     const Device& dev = data_entry_[entry_id(0, 0)]->device;
 
-    TVMStreamCreate(dev.device_type, dev.device_id, &capture_stream_);
-    TVMSetStream(dev.device_type, dev.device_id, capture_stream_);
+    // A re-capture after invalidation reuses the stream created the first time.
+    if (capture_stream_ == nullptr) {
+      TVMStreamCreate(dev.device_type, dev.device_id, &capture_stream_);
+      TVMSetStream(dev.device_type, dev.device_id, capture_stream_);
+    }
 
     CUDA_CALL(cudaStreamBeginCapture(static_cast<cudaStream_t>(capture_stream_),
                                      cudaStreamCaptureModeGlobal));
@@ -77,6 +114,17 @@ class GraphExecutorCudaGraph : public GraphExecutor {
     LOG(INFO) << "Num of nodes in the cuda graph created using stream capture API = " << numNodes;
 
     CUDA_CALL(cudaGraphInstantiate(&cuda_graph_exec_, graph, NULL, NULL, 0));
+    CUDA_CALL(cudaGraphDestroy(graph));
+  }
+
+  /*!
+   * \brief Drop the instantiated graph so the next Run() re-captures.
+   */
+  void InvalidateCapture() {
+    if (captured_) {
+      CUDA_CALL(cudaGraphExecDestroy(cuda_graph_exec_));
+      captured_ = false;
+    }
   }
 
   /*!
@@ -88,9 +136,11 @@ class GraphExecutorCudaGraph : public GraphExecutor {
 
  private:
   /*! \brief The Cuda stream on which to capture a CUDA graph. */
-  TVMStreamHandle capture_stream_;
+  TVMStreamHandle capture_stream_{nullptr};
   /*! \brief The captured CUDA graph will be instantiated to this. */
   cudaGraphExec_t cuda_graph_exec_;
+  /*! \brief Whether cuda_graph_exec_ holds a live capture. */
+  bool captured_{false};
 };
 
 PackedFunc GraphExecutorCudaGraph::GetFunction(const std::string& name,
@@ -0,0 +1,181 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file data_parallel_executor.cc
+ * \brief Batch-sharding wrapper over per-device GraphExecutor replicas.
+ *
+ *  Sharding a batch across devices from Python costs GIL round trips and
+ *  per-replica orchestration on every inference. This wrapper owns one
+ *  GraphExecutor replica per device and exposes the usual executor
+ *  interface: set_input scatters along the batch dimension (inputs whose
+ *  leading dimension matches a single replica - weights, broadcast inputs -
+ *  are set on every replica instead), run launches all replicas back to
+ *  back so their kernels overlap across devices, and get_output gathers the
+ *  shards into one host tensor, synchronizing each device only at the
+ *  gather. Parameters load once per device through the regular param path.
+ */
+#include <tvm/runtime/device_api.h>
+#include <tvm/runtime/ndarray.h>
+#include <tvm/runtime/packed_func.h>
+#include <tvm/runtime/registry.h>
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph_executor.h"
+
+namespace tvm {
+namespace runtime {
+
+class DataParallelExecutor : public ModuleNode {
+ public:
+  void Init(const std::string& graph_json, tvm::runtime::Module module,
+            const std::vector<Device>& devices) {
+    ICHECK(!devices.empty());
+    for (const Device& dev : devices) {
+      auto exec = make_object<GraphExecutor>();
+      exec->Init(graph_json, module, {dev});
+      replicas_.push_back(Module(exec));
+      executors_.push_back(static_cast<GraphExecutor*>(replicas_.back().operator->()));
+    }
+  }
+
+  const char* type_key() const final { return "DataParallelExecutor"; }
+
+  void SetInput(int index, DLTensor* data_in) {
+    const size_t num = executors_.size();
+    NDArray replica_shape_ref = executors_[0]->GetInput(index);
+    const DLTensor* ref = replica_shape_ref.operator->();
+    bool scatter = ref->ndim > 0 && data_in->ndim == ref->ndim &&
+                   data_in->shape[0] == ref->shape[0] * static_cast<int64_t>(num);
+    if (!scatter) {
+      for (GraphExecutor* exec : executors_) {
+        exec->SetInput(index, data_in);
+      }
+      return;
+    }
+    // Scatter contiguous batch shards: adjust the data pointer per replica.
+    ICHECK(IsContiguous(*data_in)) << "Scattered inputs must be compact";
+    int64_t shard_elems = 1;
+    for (int i = 1; i < data_in->ndim; ++i) {
+      shard_elems *= data_in->shape[i];
+    }
+    int64_t shard_bytes = ref->shape[0] * shard_elems *
+                          ((data_in->dtype.bits * data_in->dtype.lanes + 7) / 8);
+    DLTensor shard = *data_in;
+    shard.shape = const_cast<int64_t*>(ref->shape);
+    for (size_t i = 0; i < num; ++i) {
+      shard.data = static_cast<char*>(data_in->data) + data_in->byte_offset +
+                   static_cast<int64_t>(i) * shard_bytes;
+      shard.byte_offset = 0;
+      executors_[i]->SetInput(index, &shard);
+    }
+  }
+
+  void Run() {
+    // Launches are asynchronous on stream-ordered devices, so issuing the
+    // replicas back to back from one thread already overlaps their compute.
+    for (GraphExecutor* exec : executors_) {
+      exec->Run();
+    }
+  }
+
+  NDArray GetOutput(int index) {
+    const size_t num = executors_.size();
+    NDArray first = executors_[0]->GetOutput(index);
+    const DLTensor* ref = first.operator->();
+    std::vector<int64_t> shape(ref->shape, ref->shape + ref->ndim);
+    ICHECK(!shape.empty()) << "Cannot gather a scalar output";
+    shape[0] *= static_cast<int64_t>(num);
+    NDArray out = NDArray::Empty(ShapeTuple(shape), ref->dtype, Device{kDLCPU, 0});
+    int64_t shard_bytes = GetDataSize(*ref);
+    for (size_t i = 0; i < num; ++i) {
+      NDArray shard = executors_[i]->GetOutput(index);
+      const DLTensor* src = shard.operator->();
+      DLTensor dst = *out.operator->();
+      dst.data = static_cast<char*>(dst.data) + static_cast<int64_t>(i) * shard_bytes;
+      dst.shape = const_cast<int64_t*>(src->shape);
+      dst.ndim = src->ndim;
+      NDArray::CopyFromTo(src, &dst);
+    }
+    for (size_t i = 0; i < num; ++i) {
+      Device dev = executors_[i]->GetOutput(index).operator->()->device;
+      DeviceAPI::Get(dev)->StreamSync(dev, nullptr);
+    }
+    return out;
+  }
+
+  void LoadParams(const std::string& param_blob) {
+    for (GraphExecutor* exec : executors_) {
+      exec->LoadParams(param_blob);
+    }
+  }
+
+  PackedFunc GetFunction(const std::string& name, const ObjectPtr<Object>& sptr_to_self) final {
+    if (name == "set_input") {
+      return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+        int index = String::CanConvertFrom(args[0])
+                        ? executors_[0]->GetInputIndex(args[0].operator String())
+                        : static_cast<int>(args[0]);
+        if (index >= 0) this->SetInput(index, args[1]);
+      });
+    } else if (name == "run") {
+      return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) { this->Run(); });
+    } else if (name == "get_output") {
+      return PackedFunc(
+          [sptr_to_self, this](TVMArgs args, TVMRetValue* rv) { *rv = this->GetOutput(args[0]); });
+    } else if (name == "load_params") {
+      return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+        this->LoadParams(args[0].operator std::string());
+      });
+    } else if (name == "get_num_outputs") {
+      return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+        *rv = executors_[0]->NumOutputs();
+      });
+    }
+    return PackedFunc();
+  }
+
+ private:
+  /*! \brief Keeps the replicas alive. */
+  std::vector<Module> replicas_;
+  /*! \brief Borrowed typed views of the replicas, in device order. */
+  std::vector<GraphExecutor*> executors_;
+};
+
+TVM_REGISTER_GLOBAL("tvm.graph_executor.create_data_parallel")
+    .set_body([](TVMArgs args, TVMRetValue* rv) {
+      ICHECK_GE(args.num_args, 4) << "Expect graph_json, module, and at least one device pair";
+      std::vector<Device> devices;
+      for (int i = 2; i + 1 < args.num_args; i += 2) {
+        Device dev;
+        dev.device_type = static_cast<DLDeviceType>(args[i].operator int());
+        dev.device_id = args[i + 1];
+        devices.push_back(dev);
+      }
+      auto exec = make_object<DataParallelExecutor>();
+      exec->Init(args[0], args[1], devices);
+      *rv = Module(exec);
+    });
+
+}  // namespace runtime
+}  // namespace tvm
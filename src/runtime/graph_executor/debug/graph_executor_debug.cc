@@ -316,6 +316,22 @@ class GraphExecutorDebug : public GraphExecutor {
           metrics["Hash"] = Downcast<String>(nodes_[i].param.attrs.at("hash"));
         }
         metrics["Argument Shapes"] = profiling::ShapeString(shapes);
+        // Tensor footprints from the storage plan: the minimum traffic the
+        // node must read and write. Divided by the measured duration this
+        // bounds achieved bandwidth, which is how layout problems show up
+        // without external tooling (actual DRAM traffic additionally needs a
+        // MetricCollector such as the perf_event one).
+        int64_t bytes_read = 0;
+        for (const auto& e : nodes_[i].inputs) {
+          bytes_read += static_cast<int64_t>(GetDataSize(*data_entry_[entry_id(e)].operator->()));
+        }
+        int64_t bytes_written = 0;
+        for (uint32_t j = 0; j < nodes_[i].param.num_outputs; ++j) {
+          bytes_written +=
+              static_cast<int64_t>(GetDataSize(*data_entry_[entry_id(i, j)].operator->()));
+        }
+        metrics["Bytes Read"] = ObjectRef(make_object<profiling::CountNode>(bytes_read));
+        metrics["Bytes Written"] = ObjectRef(make_object<profiling::CountNode>(bytes_written));
         prof.StartCall(nodes_[i].param.func_name, dev, metrics);
         op_execs_[i]();
         prof.StopCall();
@@ -33,7 +33,12 @@
 #include <tvm/runtime/serializer.h>
 
 #include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <functional>
+#include <mutex>
+#include <thread>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -57,12 +62,109 @@ inline size_t GetDataAlignment(const DLTensor& arr) {
  * \brief Run all the operations one by one.
  */
 void GraphExecutor::Run() {
-  // setup the array and requirements.
-  for (size_t i = 0; i < op_execs_.size(); ++i) {
-    if (op_execs_[i]) op_execs_[i]();
+  if (!state_links_.empty()) {
+    this->BindStateLinks();
+  }
+  // While a streaming load is in flight, fall back to the ordered loop: its
+  // per-op gating is what lets compute overlap the loader safely.
+  if (async_exec_enabled_ && !streaming_active_.load(std::memory_order_acquire)) {
+    this->RunAsync();
+  } else {
+    // setup the array and requirements.
+    for (size_t i = 0; i < op_execs_.size(); ++i) {
+      if (!op_execs_[i]) continue;
+      if (streaming_active_.load(std::memory_order_acquire)) {
+        WaitForStreamingInputs(i);
+      }
+      if (!prefetch_next_.empty()) {
+        PrefetchWeights(prefetch_next_[i]);
+      }
+      op_execs_[i]();
+    }
+  }
+  for (auto& link : state_links_) {
+    link.flip ^= 1;
   }
 }
 
+void GraphExecutor::RunAsync() {
+  // One issue thread per device type keeps each device's stream order equal
+  // to topological order while letting branches on different devices overlap;
+  // synchronization only happens at true data dependencies.
+  const size_t num_nodes = this->GetNumOfNodes();
+  std::vector<int> indegree = op_indegree_;
+  std::unordered_map<int, std::deque<uint32_t>> ready;
+  std::mutex mu;
+  std::condition_variable cv;
+  size_t remaining = 0;
+  std::exception_ptr error;
+
+  auto device_of = [this](uint32_t nid) {
+    return static_cast<int>(data_entry_[this->entry_id(nid, 0)]->device.device_type);
+  };
+  std::unordered_set<int> device_types;
+  for (uint32_t nid = 0; nid < num_nodes; ++nid) {
+    if (!op_execs_[nid]) continue;
+    ++remaining;
+    device_types.insert(device_of(nid));
+    if (indegree[nid] == 0) {
+      ready[device_of(nid)].push_back(nid);
+    }
+  }
+  if (device_types.size() <= 1) {
+    // Single-device graphs gain nothing from the scheduler.
+    for (size_t i = 0; i < op_execs_.size(); ++i) {
+      if (op_execs_[i]) op_execs_[i]();
+    }
+    return;
+  }
+
+  auto worker = [&](int device_type) {
+    for (;;) {
+      uint32_t nid;
+      {
+        std::unique_lock<std::mutex> lock(mu);
+        cv.wait(lock, [&]() {
+          return error || remaining == 0 || !ready[device_type].empty();
+        });
+        if (error || remaining == 0) return;
+        nid = ready[device_type].front();
+        ready[device_type].pop_front();
+      }
+      try {
+        op_execs_[nid]();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mu);
+        error = std::current_exception();
+        cv.notify_all();
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(mu);
+        --remaining;
+        for (uint32_t consumer : op_consumers_[nid]) {
+          if (--indegree[consumer] == 0) {
+            ready[device_of(consumer)].push_back(consumer);
+          }
+        }
+      }
+      cv.notify_all();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  auto it = device_types.begin();
+  int main_device_type = *it;
+  for (++it; it != device_types.end(); ++it) {
+    workers.emplace_back(worker, *it);
+  }
+  worker(main_device_type);
+  for (std::thread& thread : workers) {
+    thread.join();
+  }
+  if (error) std::rethrow_exception(error);
+}
+
 /*!
  * \brief Initialize the graph executor with graph and device.
  * \param graph_json The execution graph.
@@ -72,12 +174,137 @@ void GraphExecutor::Run() {
  * executed on.
  * \param lookup_linked_param_func Linked parameter lookup function. Default is nullptr.
  */
+/*! \brief Magic prefix of the binary graph format. */
+static constexpr const char kGraphBinaryMagic[8] = {'T', 'V', 'M', 'G', 'R', 'P', 'H', '0'};
+
+std::string GraphExecutor::GraphJSONToBinary(const std::string& graph_json) {
+  // Parse once with the JSON loader, then dump the parsed structures.
+  GraphExecutor parsed;
+  std::istringstream is(graph_json);
+  dmlc::JSONReader reader(&is);
+  parsed.Load(&reader);
+
+  std::string blob(kGraphBinaryMagic, sizeof(kGraphBinaryMagic));
+  dmlc::MemoryStringStream mstrm(&blob);
+  mstrm.Seek(sizeof(kGraphBinaryMagic));
+  dmlc::Stream* strm = &mstrm;
+  uint64_t num_nodes = parsed.nodes_.size();
+  strm->Write(num_nodes);
+  for (const Node& node : parsed.nodes_) {
+    strm->Write(node.op_type);
+    strm->Write(node.name);
+    strm->Write(node.param.func_name);
+    strm->Write(node.param.num_inputs);
+    strm->Write(node.param.num_outputs);
+    strm->Write(node.param.flatten_data);
+    uint64_t num_attrs = node.param.attrs.size();
+    strm->Write(num_attrs);
+    for (const auto& kv : node.param.attrs) {
+      strm->Write(kv.first);
+      strm->Write(Downcast<String>(kv.second).operator std::string());
+    }
+    uint64_t num_inputs = node.inputs.size();
+    strm->Write(num_inputs);
+    for (const NodeEntry& e : node.inputs) {
+      strm->Write(e.node_id);
+      strm->Write(e.index);
+      strm->Write(e.version);
+    }
+    strm->Write(node.control_deps);
+  }
+  strm->Write(parsed.input_nodes_);
+  strm->Write(parsed.node_row_ptr_);
+  uint64_t num_outputs = parsed.outputs_.size();
+  strm->Write(num_outputs);
+  for (const NodeEntry& e : parsed.outputs_) {
+    strm->Write(e.node_id);
+    strm->Write(e.index);
+    strm->Write(e.version);
+  }
+  strm->Write(parsed.attrs_.storage_id);
+  strm->Write(parsed.attrs_.device_index);
+  strm->Write(parsed.attrs_.dltype);
+  uint64_t num_shapes = parsed.attrs_.shape.size();
+  strm->Write(num_shapes);
+  for (const auto& shape : parsed.attrs_.shape) {
+    strm->Write(shape);
+  }
+  return blob;
+}
+
+void GraphExecutor::LoadBinaryGraph(const std::string& blob) {
+  dmlc::MemoryStringStream mstrm(const_cast<std::string*>(&blob));
+  mstrm.Seek(sizeof(kGraphBinaryMagic));
+  dmlc::Stream* strm = &mstrm;
+  uint64_t num_nodes = 0;
+  ICHECK(strm->Read(&num_nodes)) << "Invalid binary graph";
+  nodes_.resize(num_nodes);
+  for (Node& node : nodes_) {
+    ICHECK(strm->Read(&node.op_type));
+    ICHECK(strm->Read(&node.name));
+    ICHECK(strm->Read(&node.param.func_name));
+    ICHECK(strm->Read(&node.param.num_inputs));
+    ICHECK(strm->Read(&node.param.num_outputs));
+    ICHECK(strm->Read(&node.param.flatten_data));
+    uint64_t num_attrs = 0;
+    ICHECK(strm->Read(&num_attrs));
+    for (uint64_t i = 0; i < num_attrs; ++i) {
+      std::string key, value;
+      ICHECK(strm->Read(&key));
+      ICHECK(strm->Read(&value));
+      node.param.attrs[key] = String(value);
+    }
+    uint64_t num_inputs = 0;
+    ICHECK(strm->Read(&num_inputs));
+    node.inputs.resize(num_inputs);
+    for (NodeEntry& e : node.inputs) {
+      ICHECK(strm->Read(&e.node_id));
+      ICHECK(strm->Read(&e.index));
+      ICHECK(strm->Read(&e.version));
+    }
+    ICHECK(strm->Read(&node.control_deps));
+  }
+  ICHECK(strm->Read(&input_nodes_));
+  ICHECK(strm->Read(&node_row_ptr_));
+  uint64_t num_outputs = 0;
+  ICHECK(strm->Read(&num_outputs));
+  outputs_.resize(num_outputs);
+  for (NodeEntry& e : outputs_) {
+    ICHECK(strm->Read(&e.node_id));
+    ICHECK(strm->Read(&e.index));
+    ICHECK(strm->Read(&e.version));
+  }
+  ICHECK(strm->Read(&attrs_.storage_id));
+  ICHECK(strm->Read(&attrs_.device_index));
+  ICHECK(strm->Read(&attrs_.dltype));
+  uint64_t num_shapes = 0;
+  ICHECK(strm->Read(&num_shapes));
+  attrs_.shape.resize(num_shapes);
+  for (auto& shape : attrs_.shape) {
+    ICHECK(strm->Read(&shape));
+  }
+}
+
+TVM_REGISTER_GLOBAL("runtime.GraphJSONToBinary").set_body([](TVMArgs args, TVMRetValue* rv) {
+  std::string blob = GraphExecutor::GraphJSONToBinary(args[0].operator std::string());
+  // copy so the bytes are owned by the return value
+  *rv = TVMByteArray{blob.data(), blob.size()};
+});
+
 void GraphExecutor::Init(const std::string& graph_json, tvm::runtime::Module module,
                          const std::vector<Device>& devs,
                          const PackedFunc lookup_linked_param_func) {
-  std::istringstream is(graph_json);
-  dmlc::JSONReader reader(&is);
-  this->Load(&reader);
+  // The "json" may be the binary graph produced by GraphJSONToBinary, which
+  // skips the dominant JSON parse on large unrolled graphs.
+  if (graph_json.size() > sizeof(kGraphBinaryMagic) &&
+      std::memcmp(graph_json.data(), kGraphBinaryMagic, sizeof(kGraphBinaryMagic)) == 0) {
+    this->LoadBinaryGraph(graph_json);
+  } else {
+    std::istringstream is(graph_json);
+    dmlc::JSONReader reader(&is);
+    this->Load(&reader);
+  }
+  graph_json_ = graph_json;
   module_ = module;
   devices_ = devs;
   lookup_linked_param_ = lookup_linked_param_func;
@@ -154,6 +381,18 @@ int GraphExecutor::GetOutputIndex(const std::string& name) {
 void GraphExecutor::SetInput(int index, DLTensor* data_in) {
   ICHECK_LT(static_cast<size_t>(index), input_nodes_.size());
   uint32_t eid = this->entry_id(input_nodes_[index], 0);
+  if (eid < input_staging_.size() && input_staging_[eid][0].defined()) {
+    // Stage through a pinned buffer: the call returns once the async H2D
+    // transfer is enqueued, and stream ordering makes the next Run() wait for
+    // it without a host synchronization. The two buffers alternate so writing
+    // the next input cannot race with a transfer still in flight from the
+    // previous one.
+    NDArray& staging = input_staging_[eid][input_staging_turn_[eid]];
+    input_staging_turn_[eid] ^= 1;
+    staging.CopyFrom(data_in);
+    data_entry_[eid].CopyFrom(staging);
+    return;
+  }
   data_entry_[eid].CopyFrom(data_in);
 }
 /*!
@@ -212,6 +451,93 @@ void GraphExecutor::SetOutputZeroCopy(int index, DLTensor* data_ref) {
     t->data = data_ref->data;
   }
 }
+
+/*!
+ * \brief Pull the leading cache lines of the next op's weights toward L2.
+ *
+ *  Only a bounded head per tensor is touched: it hides the cold first
+ *  accesses that stall the next op's ramp-up, after which the hardware
+ *  prefetchers track its streaming reads, and it keeps the instruction
+ *  overhead of the hint loop negligible.
+ */
+void GraphExecutor::PrefetchWeights(const std::vector<const DLTensor*>& tensors) {
+#if defined(__GNUC__) || defined(__clang__)
+  constexpr size_t kLineBytes = 64;
+  constexpr size_t kMaxBytesPerTensor = 64 * 1024;
+  for (const DLTensor* t : tensors) {
+    const char* base = static_cast<const char*>(t->data) + t->byte_offset;
+    size_t bytes = std::min(GetDataSize(*t), kMaxBytesPerTensor);
+    for (size_t off = 0; off < bytes; off += kLineBytes) {
+      __builtin_prefetch(base + off, /*rw=*/0, /*locality=*/2);
+    }
+  }
+#else
+  (void)tensors;
+#endif
+}
+
+namespace {
+/*! \brief Zero a tensor of any device through a host staging buffer. */
+void ZeroNDArray(NDArray* array) {
+  NDArray staging = NDArray::Empty((*array).Shape(), (*array)->dtype, Device{kDLCPU, 0});
+  std::memset(staging->data, 0, GetDataSize(*staging.operator->()));
+  array->CopyFrom(staging);
+}
+}  // namespace
+
+/*!
+ * \brief Link a recurrent state output back to an input with no copies.
+ * \param input_index The input fed by the state.
+ * \param output_index The output producing the next state.
+ */
+void GraphExecutor::LinkState(int input_index, int output_index) {
+  ICHECK_LT(static_cast<size_t>(input_index), input_nodes_.size());
+  ICHECK_LT(static_cast<size_t>(output_index), outputs_.size());
+  uint32_t in_eid = this->entry_id(input_nodes_[input_index], 0);
+  uint32_t out_eid = this->entry_id(outputs_[output_index]);
+  const NDArray& in = data_entry_[in_eid];
+  const NDArray& out = data_entry_[out_eid];
+  ICHECK_EQ(in.Shape().size(), out.Shape().size())
+      << "State input " << input_index << " and output " << output_index << " ranks differ";
+  for (size_t i = 0; i < in.Shape().size(); ++i) {
+    ICHECK_EQ(in.Shape()[i], out.Shape()[i])
+        << "State input " << input_index << " and output " << output_index << " shapes differ";
+  }
+  ICHECK_EQ(in.DataType(), out.DataType())
+      << "State input " << input_index << " and output " << output_index << " dtypes differ";
+  StateLink link;
+  link.input_index = input_index;
+  link.output_index = output_index;
+  for (NDArray& buffer : link.buffers) {
+    buffer = NDArray::Empty(in.Shape(), in->dtype, in->device);
+    ZeroNDArray(&buffer);
+  }
+  state_links_.push_back(std::move(link));
+}
+/*!
+ * \brief Zero all linked state buffers, restarting the sequence.
+ */
+void GraphExecutor::ResetState() {
+  for (StateLink& link : state_links_) {
+    for (NDArray& buffer : link.buffers) {
+      ZeroNDArray(&buffer);
+    }
+    link.flip = 0;
+  }
+}
+/*!
+ * \brief Rebind every state link's buffers for the coming Run.
+ */
+void GraphExecutor::BindStateLinks() {
+  for (StateLink& link : state_links_) {
+    // This Run reads the state the previous Run wrote and produces the next
+    // one into the other buffer; Run flips the roles afterwards.
+    this->SetInputZeroCopy(link.input_index,
+                           const_cast<DLTensor*>(link.buffers[link.flip].operator->()));
+    this->SetOutputZeroCopy(link.output_index,
+                            const_cast<DLTensor*>(link.buffers[1 - link.flip].operator->()));
+  }
+}
 /*!
  * \brief Get the number of outputs
  *
@@ -285,6 +611,474 @@ void GraphExecutor::LoadParams(dmlc::Stream* strm) {
   }
 }
 
+namespace {
+
+/*!
+ * \brief Cross-executor store of uploaded parameter tensors.
+ *
+ *  Keyed by device and content hash and verified against the retained host
+ *  source, so loading several fine-tuned variants of one base model uploads
+ *  each shared layer once and every executor aliases the same device
+ *  allocation. Entries whose device tensor is no longer referenced by any
+ *  executor are evicted lazily on access.
+ */
+class DeviceWeightStore {
+ public:
+  static DeviceWeightStore* Global() {
+    static DeviceWeightStore* inst = new DeviceWeightStore();
+    return inst;
+  }
+
+  NDArray GetOrUpload(const NDArray& host_param, Device dev) {
+    const DLTensor* tensor = host_param.operator->();
+    size_t nbytes = GetDataSize(*tensor);
+    const char* data = static_cast<const char*>(tensor->data) + tensor->byte_offset;
+    uint64_t key = String::HashBytes(data, nbytes);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto range = entries_.equal_range(key);
+    for (auto it = range.first; it != range.second;) {
+      Entry& entry = it->second;
+      if (entry.device_copy.use_count() == 1) {
+        // No executor references it anymore; let the device memory go.
+        it = entries_.erase(it);
+        continue;
+      }
+      const DLTensor* cached = entry.host_source.operator->();
+      if (entry.device_copy->device.device_type == dev.device_type &&
+          entry.device_copy->device.device_id == dev.device_id &&
+          GetDataSize(*cached) == nbytes &&
+          std::memcmp(static_cast<const char*>(cached->data) + cached->byte_offset, data,
+                      nbytes) == 0) {
+        return entry.device_copy;
+      }
+      ++it;
+    }
+    NDArray device_copy = host_param.CopyTo(dev);
+    entries_.emplace(key, Entry{host_param, device_copy});
+    return device_copy;
+  }
+
+ private:
+  struct Entry {
+    /*! \brief Host source kept for content verification on hits. */
+    NDArray host_source;
+    /*! \brief The shared device-resident tensor. */
+    NDArray device_copy;
+  };
+  std::mutex mutex_;
+  std::unordered_multimap<uint64_t, Entry> entries_;
+};
+
+}  // namespace
+
+bool GraphExecutor::ShareParam(int index, const NDArray& host_param) {
+  ICHECK_LT(static_cast<size_t>(index), input_nodes_.size());
+  uint32_t eid = this->entry_id(input_nodes_[index], 0);
+  Device dev = data_entry_[eid]->device;
+  // CPU-resident weights dedup through the mmap parameter path instead.
+  if (dev.device_type == kDLCPU || host_param->device.device_type != kDLCPU) {
+    return false;
+  }
+  // Only storage used exclusively by this entry may be rebound.
+  int sid = attrs_.storage_id[eid];
+  for (size_t other = 0; other < data_entry_.size(); ++other) {
+    if (other != eid && attrs_.storage_id[other] == sid) {
+      return false;
+    }
+  }
+  const DLTensor* expected = data_entry_[eid].operator->();
+  if (host_param->ndim != expected->ndim) {
+    return false;
+  }
+  for (int dim = 0; dim < expected->ndim; ++dim) {
+    if (host_param->shape[dim] != expected->shape[dim]) {
+      return false;
+    }
+  }
+  if (GetDataSize(*host_param.operator->()) != GetDataSize(*expected)) {
+    return false;
+  }
+  NDArray shared = DeviceWeightStore::Global()->GetOrUpload(host_param, dev);
+  storage_pool_[sid] = shared;
+  data_entry_[eid] = shared.CreateView(data_entry_[eid].Shape(), expected->dtype);
+  data_alignment_[eid] = details::GetDataAlignment(*data_entry_[eid].operator->());
+  shared_params_pending_ = true;
+  return true;
+}
+
+void GraphExecutor::FinalizeSharedParams() {
+  if (shared_params_pending_) {
+    shared_params_pending_ = false;
+    this->SetupOpExecs();
+  }
+}
+
+void GraphExecutor::LoadParamsFromFile(const std::string& file_name) {
+  Map<String, NDArray> params = ::tvm::runtime::LoadParamsMmap(file_name);
+  bool rebound = false;
+  for (auto& p : params) {
+    param_names_.insert(p.first);
+    int in_idx = GetInputIndex(p.first);
+    if (in_idx < 0) continue;
+    uint32_t eid = this->entry_id(input_nodes_[in_idx], 0);
+    ICHECK_LT(eid, data_entry_.size());
+    if (data_entry_[eid]->device.device_type == kDLCPU) {
+      // CPU-resident weights alias the mapped file pages directly.
+      data_entry_[eid] = p.second;
+      data_alignment_[eid] = details::GetDataAlignment(*p.second.operator->());
+      rebound = true;
+    } else {
+      data_entry_[eid].CopyFrom(p.second);
+    }
+  }
+  if (rebound) {
+    // Rebuild the op closures so they see the rebound storage.
+    this->SetupOpExecs();
+  }
+}
+
+/*!
+ * \brief Export the static execution schedule as JSON for external replay.
+ *
+ *  Everything a replay engine needs that is static in the graph: the
+ *  storage pool (id, bytes, device), and per executed node its kernel
+ *  symbol and argument bindings as (storage id, byte size) in call order,
+ *  plus the input and output entry bindings. Kernel symbols resolve
+ *  against the exported library; launch dimensions live inside the
+ *  compiled kernels' metadata and are applied by the kernel wrappers, so
+ *  they are not repeated here.
+ */
+std::string GraphExecutor::ExportExecutionTrace() const {
+  std::ostringstream os;
+  dmlc::JSONWriter writer(&os);
+  writer.BeginObject();
+  writer.WriteObjectKeyValue("version", std::string("tvm_exec_trace_v1"));
+
+  // Parallel arrays of plain types keep the format trivially parseable by
+  // replay runtimes without a structured JSON layer.
+  std::vector<int64_t> storage_bytes;
+  std::vector<int64_t> storage_device_types;
+  std::vector<int64_t> storage_device_ids;
+  for (size_t sid = 0; sid < storage_pool_.size(); ++sid) {
+    const DLTensor* t = storage_pool_[sid].operator->();
+    storage_bytes.push_back(static_cast<int64_t>(GetDataSize(*t)));
+    storage_device_types.push_back(t->device.device_type);
+    storage_device_ids.push_back(t->device.device_id);
+  }
+  writer.WriteObjectKeyValue("storage_bytes", storage_bytes);
+  writer.WriteObjectKeyValue("storage_device_types", storage_device_types);
+  writer.WriteObjectKeyValue("storage_device_ids", storage_device_ids);
+
+  std::vector<std::string> node_names;
+  std::vector<std::string> node_func_names;
+  std::vector<std::vector<int64_t>> node_arg_storage_ids;
+  std::vector<std::vector<int64_t>> node_arg_bytes;
+  for (uint32_t nid = 0; nid < nodes_.size(); ++nid) {
+    const auto& inode = nodes_[nid];
+    if (inode.op_type == "null") continue;
+    node_names.push_back(inode.name);
+    node_func_names.push_back(inode.param.func_name);
+    std::vector<int64_t> arg_sids;
+    std::vector<int64_t> arg_bytes;
+    auto push_entry = [&](uint32_t eid) {
+      const DLTensor* t = data_entry_[eid].operator->();
+      arg_sids.push_back(static_cast<int64_t>(attrs_.storage_id[eid]));
+      arg_bytes.push_back(static_cast<int64_t>(GetDataSize(*t)));
+    };
+    for (const auto& e : inode.inputs) {
+      push_entry(this->entry_id(e));
+    }
+    for (uint32_t i = 0; i < inode.param.num_outputs; ++i) {
+      push_entry(this->entry_id(nid, i));
+    }
+    node_arg_storage_ids.push_back(std::move(arg_sids));
+    node_arg_bytes.push_back(std::move(arg_bytes));
+  }
+  writer.WriteObjectKeyValue("node_names", node_names);
+  writer.WriteObjectKeyValue("node_func_names", node_func_names);
+  writer.WriteObjectKeyValue("node_arg_storage_ids", node_arg_storage_ids);
+  writer.WriteObjectKeyValue("node_arg_bytes", node_arg_bytes);
+
+  std::vector<int64_t> input_sids;
+  for (uint32_t nid : input_nodes_) {
+    input_sids.push_back(static_cast<int64_t>(attrs_.storage_id[this->entry_id(nid, 0)]));
+  }
+  writer.WriteObjectKeyValue("input_storage_ids", input_sids);
+  std::vector<int64_t> output_sids;
+  for (const auto& out : outputs_) {
+    output_sids.push_back(static_cast<int64_t>(attrs_.storage_id[this->entry_id(out)]));
+  }
+  writer.WriteObjectKeyValue("output_storage_ids", output_sids);
+  writer.EndObject();
+  return os.str();
+}
+
+void GraphExecutor::SetOutputAsync(int index, DLTensor* data_out) {
+  ICHECK_LT(static_cast<size_t>(index), outputs_.size());
+  uint32_t out_nid = outputs_[index].node_id;
+  uint32_t eid = this->entry_id(outputs_[index]);
+  ICHECK(op_execs_[out_nid] != nullptr) << "Output " << index << " has no producing op";
+  const DLTensor* src = data_entry_[eid].operator->();
+  ICHECK_EQ(GetDataSize(*src), GetDataSize(*data_out)) << "Output size mismatch";
+  Device dev = src->device;
+  TVMStreamHandle copy_stream = nullptr;
+  auto it = async_copy_streams_.find(static_cast<int>(dev.device_type) * 256 + dev.device_id);
+  if (it != async_copy_streams_.end()) {
+    copy_stream = it->second;
+  } else {
+    copy_stream = DeviceAPI::Get(dev)->CreateStream(dev);
+    async_copy_streams_[static_cast<int>(dev.device_type) * 256 + dev.device_id] = copy_stream;
+  }
+  // Chain the readback right behind the producing op: the copy stream waits
+  // on everything the execution stream issued so far (which ends with this
+  // producer), then the D2H copy runs concurrently with the remaining ops.
+  auto base_exec = op_execs_[out_nid];
+  DLTensor* dst = data_out;
+  NDArray src_arr = data_entry_[eid];
+  op_execs_[out_nid] = [base_exec, src_arr, dst, dev, copy_stream]() {
+    base_exec();
+    DeviceAPI* api = DeviceAPI::Get(dev);
+    api->SyncStreamFromTo(dev, nullptr, copy_stream);
+    const DLTensor* src_tensor = src_arr.operator->();
+    api->CopyDataFromTo(src_tensor->data, src_tensor->byte_offset, dst->data, dst->byte_offset,
+                        GetDataSize(*src_tensor), dev, dst->device, src_tensor->dtype, copy_stream);
+  };
+}
+
+void GraphExecutor::SyncAsyncOutputs() {
+  for (const auto& kv : async_copy_streams_) {
+    Device dev;
+    dev.device_type = static_cast<DLDeviceType>(kv.first / 256);
+    dev.device_id = kv.first % 256;
+    DeviceAPI::Get(dev)->StreamSync(dev, kv.second);
+  }
+}
+
+namespace {
+
+/*! \brief Minimal read-only dmlc stream over a file, for sequential loads. */
+class BinaryFileReadStream : public dmlc::Stream {
+ public:
+  explicit BinaryFileReadStream(const std::string& path) : fp_(std::fopen(path.c_str(), "rb")) {
+    ICHECK(fp_ != nullptr) << "Cannot open parameter file " << path;
+  }
+  ~BinaryFileReadStream() {
+    if (fp_ != nullptr) std::fclose(fp_);
+  }
+  size_t Read(void* ptr, size_t size) final { return std::fread(ptr, 1, size, fp_); }
+  void Write(const void* ptr, size_t size) final { LOG(FATAL) << "Read-only stream"; }
+
+ private:
+  std::FILE* fp_;
+};
+
+}  // namespace
+
+void GraphExecutor::LoadParamsStreaming(const std::string& file_name) {
+  if (streaming_thread_.joinable()) {
+    streaming_thread_.join();
+  }
+  auto strm = std::make_shared<BinaryFileReadStream>(file_name);
+  // Parse the header synchronously: it decides which entries the first Run
+  // must gate on. The tensor payloads stream in on the loader thread.
+  uint64_t header = 0, reserved = 0;
+  ICHECK(strm->Read(&header) && header == kTVMNDArrayListMagic &&
+         strm->Read(&reserved))
+      << "Invalid parameters file format";
+  std::vector<std::string> names;
+  ICHECK(strm->Read(&names)) << "Invalid parameters file format";
+  uint64_t sz = 0;
+  ICHECK(strm->Read(&sz) && sz == names.size()) << "Invalid parameters file format";
+
+  std::vector<int64_t> eids(names.size(), -1);
+  {
+    std::lock_guard<std::mutex> lock(streaming_mutex_);
+    streaming_error_ = nullptr;
+    for (size_t i = 0; i < names.size(); ++i) {
+      param_names_.insert(names[i]);
+      int in_idx = GetInputIndex(names[i]);
+      if (in_idx < 0) continue;
+      eids[i] = this->entry_id(input_nodes_[in_idx], 0);
+      streaming_pending_eids_.insert(static_cast<uint32_t>(eids[i]));
+    }
+  }
+  streaming_active_.store(true, std::memory_order_release);
+
+  streaming_thread_ = std::thread([this, strm, eids]() {
+    size_t count = eids.size();
+    for (size_t i = 0; i < count; ++i) {
+      NDArray host;
+      try {
+        ICHECK(host.Load(strm.get())) << "Truncated parameters file";
+        if (eids[i] >= 0) {
+          data_entry_[static_cast<uint32_t>(eids[i])].CopyFrom(host);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(streaming_mutex_);
+        streaming_error_ = std::current_exception();
+        streaming_pending_eids_.clear();
+        streaming_cv_.notify_all();
+        return;
+      }
+      if (eids[i] >= 0) {
+        std::lock_guard<std::mutex> lock(streaming_mutex_);
+        streaming_pending_eids_.erase(static_cast<uint32_t>(eids[i]));
+        streaming_cv_.notify_all();
+      }
+    }
+    streaming_active_.store(false, std::memory_order_release);
+  });
+}
+
+void GraphExecutor::WaitForStreamingInputs(size_t nid) {
+  const auto& inode = nodes_[nid];
+  std::unique_lock<std::mutex> lock(streaming_mutex_);
+  for (const auto& e : inode.inputs) {
+    uint32_t eid = this->entry_id(e);
+    streaming_cv_.wait(lock, [this, eid] {
+      return streaming_error_ != nullptr || streaming_pending_eids_.count(eid) == 0;
+    });
+    if (streaming_error_ != nullptr) {
+      std::exception_ptr err = streaming_error_;
+      streaming_error_ = nullptr;
+      lock.unlock();
+      if (streaming_thread_.joinable()) streaming_thread_.join();
+      streaming_active_.store(false, std::memory_order_release);
+      std::rethrow_exception(err);
+    }
+  }
+}
+
+/*!
+ * \brief Load new parameter values into shadow device buffers.
+ *
+ *  Runs on any thread while serving continues against the live set: each
+ *  parameter is uploaded into a freshly allocated shadow tensor, and the
+ *  staged set becomes visible to CommitStagedParams only after every
+ *  device copy has completed. Memory doubles only for the staged
+ *  parameters during the transition window.
+ * \param param_blob The serialized parameter dictionary.
+ */
+void GraphExecutor::StageParams(const std::string& param_blob) {
+  dmlc::MemoryFixedSizeStream strm(const_cast<char*>(param_blob.data()), param_blob.length());
+  Map<String, NDArray> params = ::tvm::runtime::LoadParams(&strm);
+  std::vector<std::pair<int, NDArray>> staged;
+  std::unordered_set<int> devices_touched;
+  for (auto& p : params) {
+    int in_idx = GetInputIndex(p.first);
+    if (in_idx < 0) continue;
+    uint32_t eid = this->entry_id(input_nodes_[in_idx], 0);
+    const DLTensor* live = data_entry_[eid].operator->();
+    NDArray shadow = NDArray::Empty(data_entry_[eid].Shape(), live->dtype, live->device);
+    shadow.CopyFrom(p.second);
+    devices_touched.insert(static_cast<int>(live->device.device_type) * 256 +
+                           live->device.device_id);
+    staged.emplace_back(in_idx, shadow);
+  }
+  // The copies above may be stream-asynchronous; the flip must not expose a
+  // half-written shadow, so sync every touched device before publishing.
+  for (int key : devices_touched) {
+    Device dev;
+    dev.device_type = static_cast<DLDeviceType>(key / 256);
+    dev.device_id = key % 256;
+    if (dev.device_type != kDLCPU) {
+      DeviceAPI::Get(dev)->StreamSync(dev, nullptr);
+    }
+  }
+  std::lock_guard<std::mutex> lock(staged_params_mutex_);
+  staged_params_ = std::move(staged);
+}
+
+/*!
+ * \brief Flip the live parameters to the staged set, if one is ready.
+ *
+ *  Called from the serving thread between inferences: the flip rewrites the
+ *  op closures' argument pointers in place (the zero-copy rebinding path)
+ *  and rebinds data_entry_, so the previous shadows release through
+ *  reference counting. Costs pointer stores, never copies.
+ * \return Whether a staged set was committed.
+ */
+bool GraphExecutor::CommitStagedParams() {
+  std::vector<std::pair<int, NDArray>> staged;
+  {
+    std::lock_guard<std::mutex> lock(staged_params_mutex_);
+    if (staged_params_.empty()) return false;
+    staged = std::move(staged_params_);
+    staged_params_.clear();
+  }
+  for (auto& kv : staged) {
+    uint32_t eid = this->entry_id(input_nodes_[kv.first], 0);
+    this->SetInputZeroCopy(kv.first, const_cast<DLTensor*>(kv.second.operator->()));
+    data_entry_[eid] = kv.second;
+  }
+  return true;
+}
+
+void GraphExecutor::Warmup() {
+  // Pre-touch CPU-resident activation pages so the first real inference
+  // faults nothing in; parameter storages are skipped since they already
+  // hold loaded weights.
+  std::unordered_set<int> param_sids;
+  for (const std::string& name : param_names_) {
+    int in_idx = GetInputIndex(name);
+    if (in_idx >= 0) {
+      param_sids.insert(attrs_.storage_id[this->entry_id(input_nodes_[in_idx], 0)]);
+    }
+  }
+  for (size_t sid = 0; sid < storage_pool_.size(); ++sid) {
+    if (param_sids.count(static_cast<int>(sid))) continue;
+    if (linked_param_sids_.count(static_cast<int>(sid))) continue;
+    const DLTensor* storage = storage_pool_[sid].operator->();
+    if (storage->device.device_type != kDLCPU) continue;
+    std::memset(static_cast<char*>(storage->data) + storage->byte_offset, 0,
+                GetDataSize(*storage));
+  }
+  // One throwaway run loads every lazily-initialized device module
+  // (cuModuleLoad on first kernel use), primes the workspace pools to their
+  // high-water mark, and warms instruction caches; the sync drains it so
+  // warmup cost never bleeds into the first measured request.
+  this->Run();
+  for (const Device& dev : devices_) {
+    DeviceAPI::Get(dev)->StreamSync(dev, nullptr);
+  }
+}
+
+Module GraphExecutor::CreateExecutionContext() {
+  auto exec = make_object<GraphExecutor>();
+  exec->Init(graph_json_, module_, devices_, lookup_linked_param_);
+
+  // Rebind the new context's parameter entries to this executor's storage so
+  // only the activation pool is duplicated. A parameter storage is shared
+  // only when no activation aliases it (memory planning normally gives
+  // graph inputs dedicated storage, but stay defensive).
+  std::unordered_map<uint32_t, std::string> param_eids;
+  std::unordered_set<int> param_sids;
+  for (const std::string& name : param_names_) {
+    int in_idx = GetInputIndex(name);
+    if (in_idx < 0) continue;
+    uint32_t eid = this->entry_id(input_nodes_[in_idx], 0);
+    param_eids.emplace(eid, name);
+    param_sids.insert(attrs_.storage_id[eid]);
+  }
+  for (size_t eid = 0; eid < data_entry_.size(); ++eid) {
+    if (!param_eids.count(eid)) {
+      param_sids.erase(attrs_.storage_id[eid]);
+    }
+  }
+  for (const auto& kv : param_eids) {
+    uint32_t eid = kv.first;
+    int sid = attrs_.storage_id[eid];
+    if (!param_sids.count(sid)) continue;
+    exec->param_names_.insert(kv.second);
+    exec->storage_pool_[sid] = storage_pool_[sid];
+    exec->data_entry_[eid] = data_entry_[eid];
+    exec->data_alignment_[eid] = data_alignment_[eid];
+  }
+  // Rebuild the op closures over the shared parameter storage.
+  exec->SetupOpExecs();
+  return Module(exec);
+}
+
 void GraphExecutor::ShareParams(const GraphExecutor& other, dmlc::Stream* strm) {
   uint64_t header, reserved;
   ICHECK(strm->Read(&header)) << "Invalid parameters file format";
@@ -406,6 +1200,7 @@ void GraphExecutor::SetupStorage() {
     });
     Device dev = cit == devices_.end() ? devices_[0] : *cit;
     if (pit.linked_param.defined()) {
+      linked_param_sids_.insert(static_cast<int>(storage_pool_.size()));
       storage_pool_.push_back(pit.linked_param);
     } else {
       std::vector<int64_t> shape;
@@ -427,6 +1222,25 @@ void GraphExecutor::SetupStorage() {
     const DLTensor* tmp = data_entry_[i].operator->();
     data_alignment_[i] = details::GetDataAlignment(*tmp);
   }
+
+  // Optionally stage CUDA inputs through pinned host buffers
+  // (TVM_GRAPH_EXECUTOR_PINNED_INPUT=1): SetInput then issues an async H2D
+  // copy that the stream orders before the kernels of the next Run(),
+  // overlapping input transfer with the inference still in flight.
+  const char* pinned_input = getenv("TVM_GRAPH_EXECUTOR_PINNED_INPUT");
+  if (pinned_input && atoi(pinned_input) != 0) {
+    input_staging_.resize(num_node_entries());
+    input_staging_turn_.assign(num_node_entries(), 0);
+    for (uint32_t nid : input_nodes_) {
+      uint32_t eid = this->entry_id(nid, 0);
+      if (data_entry_[eid]->device.device_type == kDLCUDA) {
+        for (int turn = 0; turn < 2; ++turn) {
+          input_staging_[eid][turn] =
+              NDArray::Empty(attrs_.shape[eid], vtype[eid], Device{kDLCUDAHost, 0});
+        }
+      }
+    }
+  }
 }
 
 void GraphExecutor::SetupOpExecs() {
@@ -485,6 +1299,84 @@ void GraphExecutor::SetupOpExecs() {
       }
     }
   }
+  // Optional weight prefetching (TVM_GRAPH_EXECUTOR_PREFETCH=1): while op k
+  // executes, the leading cache lines of op k+1's parameter buffers are
+  // software-prefetched, so memory-bound CPU models do not stall on the cold
+  // first touches of each layer's weights. The recorded DLTensor handles are
+  // the op-argument tensors that zero-copy rebinding updates in place, so
+  // prefetches always chase the currently bound buffers.
+  const char* prefetch = getenv("TVM_GRAPH_EXECUTOR_PREFETCH");
+  if (prefetch && atoi(prefetch) != 0) {
+    std::vector<std::vector<const DLTensor*>> own_weights(this->GetNumOfNodes());
+    for (uint32_t nid = 0; nid < this->GetNumOfNodes(); ++nid) {
+      const auto& inode = nodes_[nid];
+      if (!op_execs_[nid]) continue;
+      for (size_t i = 0; i < inode.inputs.size(); i++) {
+        uint32_t input_eid = this->entry_id(inode.inputs[i]);
+        if (input_node_eids.count(input_eid) == 0) continue;
+        // Every handle bound to this entry shares the underlying buffer;
+        // one per entry is enough to chase rebindings.
+        if (input_dltensors_[input_eid].empty()) continue;
+        const DLTensor* t = input_dltensors_[input_eid].front();
+        if (t->device.device_type == kDLCPU) {
+          own_weights[nid].push_back(t);
+        }
+      }
+    }
+    prefetch_next_.assign(this->GetNumOfNodes(), {});
+    for (uint32_t nid = 0; nid < this->GetNumOfNodes(); ++nid) {
+      if (!op_execs_[nid]) continue;
+      for (uint32_t next = nid + 1; next < this->GetNumOfNodes(); ++next) {
+        if (op_execs_[next]) {
+          prefetch_next_[nid] = own_weights[next];
+          break;
+        }
+      }
+    }
+  }
+
+  // Optional sampling profiler (TVM_GRAPH_EXECUTOR_SAMPLING=1): each op exec
+  // is wrapped with a device timer whose event lands in the global
+  // EventRecorder ring. No sync happens on the execution path, so the hook is
+  // cheap enough for production; runtime.profiling.GetSampledReport resolves
+  // and aggregates the ring on demand.
+  const char* sampling = getenv("TVM_GRAPH_EXECUTOR_SAMPLING");
+  if (sampling && atoi(sampling) != 0) {
+    for (uint32_t nid = 0; nid < this->GetNumOfNodes(); ++nid) {
+      if (!op_execs_[nid]) continue;
+      String name(nodes_[nid].name);
+      Device dev = data_entry_[this->entry_id(nid, 0)]->device;
+      auto base_exec = op_execs_[nid];
+      op_execs_[nid] = [base_exec, name, dev]() {
+        profiling::Timer timer = profiling::Timer::Start(dev);
+        base_exec();
+        timer->Stop();
+        profiling::EventRecorder::Global()->Record(name, dev, timer);
+      };
+    }
+  }
+
+  // Optional dependency-counted async execution (TVM_GRAPH_EXECUTOR_ASYNC=1):
+  // record, per op, its consumer ops and dependency count so Run() can launch
+  // ready nodes per device instead of walking topological order serially.
+  const char* async_exec = getenv("TVM_GRAPH_EXECUTOR_ASYNC");
+  async_exec_enabled_ = async_exec && atoi(async_exec) != 0;
+  if (async_exec_enabled_) {
+    op_consumers_.assign(this->GetNumOfNodes(), {});
+    op_indegree_.assign(this->GetNumOfNodes(), 0);
+    for (uint32_t nid = 0; nid < this->GetNumOfNodes(); ++nid) {
+      const auto& inode = nodes_[nid];
+      if (inode.op_type == "null") continue;
+      std::unordered_set<uint32_t> producers;
+      for (const auto& e : inode.inputs) {
+        if (op_execs_[e.node_id]) producers.insert(e.node_id);
+      }
+      for (uint32_t producer : producers) {
+        op_consumers_[producer].push_back(nid);
+      }
+      op_indegree_[nid] = static_cast<int>(producers.size());
+    }
+  }
 }
 
 std::pair<std::function<void()>, std::shared_ptr<GraphExecutor::OpArgs> >
@@ -528,6 +1420,32 @@ GraphExecutor::CreateTVMOp(const TVMOpParam& param, const std::vector<DLTensor>&
   tvm::runtime::PackedFunc pf = module_.GetFunction(param.func_name, true);
   ICHECK(pf != nullptr) << "no such function in module: " << param.func_name;
 
+  // Steady-state fast path: when the function lives in a library-backed
+  // module, call its raw TVMBackendPackedCFunc with the frozen argument
+  // buffers directly, skipping the PackedFunc marshalling and per-call
+  // return-value handling (kernels return nothing).
+  // Only a plain library module answers the lookup authoritatively; proxy
+  // modules (e.g. RPC) would hand back addresses that are not local.
+  tvm::runtime::PackedFunc lookup;
+  if (std::strcmp(module_.operator->()->type_key(), "library") == 0) {
+    lookup = module_.GetFunction(tvm::runtime::symbol::tvm_lookup_packed_c_func, false);
+  }
+  if (lookup != nullptr) {
+    void* sym = lookup(param.func_name);
+    if (sym != nullptr) {
+      auto* faddr = reinterpret_cast<TVMBackendPackedCFunc>(sym);
+      auto fexec = [arg_ptr, faddr]() {
+        TVMValue ret_value;
+        int ret_tcode = kTVMNullptr;
+        int ret =
+            (*faddr)(arg_ptr->arg_values.data(), arg_ptr->arg_tcodes.data(),
+                     static_cast<int>(arg_ptr->arg_values.size()), &ret_value, &ret_tcode, nullptr);
+        ICHECK_EQ(ret, 0) << TVMGetLastError();
+      };
+      return {fexec, arg_ptr};
+    }
+  }
+
   auto fexec = [arg_ptr, pf]() {
     TVMRetValue rv;
     TVMArgs targs(arg_ptr->arg_values.data(), arg_ptr->arg_tcodes.data(),
@@ -567,6 +1485,32 @@ PackedFunc GraphExecutor::GetFunction(const std::string& name,
         this->SetOutputZeroCopy(args[0], args[1]);
       }
     });
+  } else if (name == "export_execution_trace") {
+    return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+      *rv = this->ExportExecutionTrace();
+    });
+  } else if (name == "set_output_async") {
+    return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+      NDArray dst = args[1];
+      // Retain the destination: the op closure keeps a raw view of it.
+      async_output_holds_.push_back(dst);
+      this->SetOutputAsync(args[0], const_cast<DLTensor*>(dst.operator->()));
+    });
+  } else if (name == "sync_async_outputs") {
+    return PackedFunc(
+        [sptr_to_self, this](TVMArgs args, TVMRetValue* rv) { this->SyncAsyncOutputs(); });
+  } else if (name == "link_state") {
+    return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+      if (String::CanConvertFrom(args[0])) {
+        int in_idx = this->GetInputIndex(args[0].operator String());
+        if (in_idx >= 0) this->LinkState(in_idx, args[1]);
+      } else {
+        this->LinkState(args[0], args[1]);
+      }
+    });
+  } else if (name == "reset_state") {
+    return PackedFunc(
+        [sptr_to_self, this](TVMArgs args, TVMRetValue* rv) { this->ResetState(); });
   } else if (name == "get_output") {
     return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
       if (args.num_args == 2) {
@@ -623,6 +1567,22 @@ PackedFunc GraphExecutor::GetFunction(const std::string& name,
           }
           *rv = outputs;
         });
+  } else if (name == "load_params_from_file") {
+    return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+      this->LoadParamsFromFile(args[0].operator std::string());
+    });
+  } else if (name == "stage_params") {
+    return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+      this->StageParams(args[0].operator std::string());
+    });
+  } else if (name == "commit_staged_params") {
+    return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+      *rv = this->CommitStagedParams();
+    });
+  } else if (name == "load_params_streaming") {
+    return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+      this->LoadParamsStreaming(args[0].operator std::string());
+    });
   } else if (name == "load_params") {
     return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
       this->LoadParams(args[0].operator std::string());
@@ -640,6 +1600,12 @@ PackedFunc GraphExecutor::GetFunction(const std::string& name,
       CHECK(String::CanConvertFrom(args[0])) << "Input key is not a string";
       *rv = this->GetInputIndex(args[0].operator String());
     });
+  } else if (name == "warmup") {
+    return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) { this->Warmup(); });
+  } else if (name == "create_execution_context") {
+    return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+      *rv = this->CreateExecutionContext();
+    });
   } else if (name == "get_input_info") {
     return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
       GraphExecutor::ShapeInfo shape_info;
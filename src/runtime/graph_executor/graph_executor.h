@@ -31,8 +31,13 @@
 #include <tvm/runtime/ndarray.h>
 #include <tvm/runtime/packed_func.h>
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -73,6 +78,11 @@ class TVM_DLL GraphExecutor : public ModuleNode {
   };
 
  public:
+  ~GraphExecutor() {
+    if (streaming_thread_.joinable()) {
+      streaming_thread_.join();
+    }
+  }
   using ShapeInfo = Map<String, ObjectRef>;
   using DtypeInfo = Map<String, ObjectRef>;
   /*!
@@ -87,7 +97,13 @@ class TVM_DLL GraphExecutor : public ModuleNode {
    * \return The type key of the executor.
    */
   const char* type_key() const final { return "GraphExecutor"; }
-  void Run();
+  virtual void Run();
+
+  /*!
+   * \brief Run the graph with the dependency-counted async scheduler,
+   * overlapping branches placed on different devices.
+   */
+  void RunAsync();
 
   /*!
    * \brief Initialize the graph executor with graph and device.
@@ -104,6 +120,50 @@ class TVM_DLL GraphExecutor : public ModuleNode {
   void Init(const std::string& graph_json, tvm::runtime::Module module,
             const std::vector<Device>& devs, const PackedFunc lookup_linked_param_func = nullptr);
 
+  /*!
+   * \brief Convert a graph JSON into the binary graph format that Init
+   * loads without the JSON parse (the dominant cost on huge unrolled
+   * graphs). The result is passed anywhere graph json is accepted.
+   * \param graph_json The graph in JSON form.
+   * \return The binary graph blob.
+   */
+  static std::string GraphJSONToBinary(const std::string& graph_json);
+
+  /*!
+   * \brief Make cold-start latency predictable: pre-touch activation pages,
+   * run one throwaway inference to force lazy device-module loading and
+   * workspace pool growth, and drain the device streams.
+   */
+  void Warmup();
+
+  /*!
+   * \brief Bind a parameter to a cross-executor shared device tensor.
+   *
+   *  Identical parameter contents (keyed by content hash, verified against
+   *  the host source) upload once per device and alias one allocation across
+   *  executors. Falls back (returns false) for CPU entries, non-exclusive
+   *  storage, or mismatched shapes; call FinalizeSharedParams after the last
+   *  ShareParam so the op closures see the rebound storage.
+   * \param index The input index of the parameter.
+   * \param host_param The CPU-resident parameter value.
+   * \return Whether the parameter was bound to shared storage.
+   */
+  bool ShareParam(int index, const NDArray& host_param);
+
+  /*! \brief Rebuild op closures if any parameter was rebound by ShareParam. */
+  void FinalizeSharedParams();
+
+  /*!
+   * \brief Create a new execution context sharing this executor's weights.
+   *
+   *  The returned executor clones the storage plan but rebinds every
+   *  parameter entry to this instance's (immutable) storage, so only the
+   *  activation pool is duplicated. N contexts can then Run concurrently on
+   *  their own threads against one copy of the parameters.
+   * \return The new executor module.
+   */
+  Module CreateExecutionContext();
+
   /*!
    * \brief Get the input index given the name of input.
    * \param name The name of the input.
@@ -135,13 +195,53 @@ class TVM_DLL GraphExecutor : public ModuleNode {
    * \param index The input index.
    * \param data_ref The input data that is referred.
    */
-  void SetInputZeroCopy(int index, DLTensor* data_ref);
+  virtual void SetInputZeroCopy(int index, DLTensor* data_ref);
   /*!
    * \brief set index-th output to the graph without copying the data.
    * \param index The output index.
    * \param data_ref The output data that is referred.
    */
-  void SetOutputZeroCopy(int index, DLTensor* data_ref);
+  virtual void SetOutputZeroCopy(int index, DLTensor* data_ref);
+  /*!
+   * \brief Link a recurrent state output back to an input with no copies.
+   *
+   *  The pair is backed by two ping-pong buffers: each Run reads the state
+   *  the previous Run wrote and writes the other buffer, and the roles swap
+   *  afterwards, so streaming models carry state across steps without the
+   *  SetInput/GetOutput copies. Both buffers start zeroed. A linked output
+   *  is written to the internal buffers and is no longer observable through
+   *  GetOutput; read other outputs as usual.
+   *
+   * \param input_index The input fed by the state.
+   * \param output_index The output producing the next state.
+   */
+  void LinkState(int input_index, int output_index);
+  /*! \brief Zero all linked state buffers, restarting the sequence. */
+  void ResetState();
+  /*!
+   * \brief Enqueue an asynchronous readback of an output right behind its
+   *  producing op.
+   *
+   *  The destination is filled on a dedicated copy stream that waits only
+   *  on the producer, so readback of early outputs overlaps the remaining
+   *  graph execution. Call SyncAsyncOutputs before consuming the
+   *  destinations. The registration persists across runs.
+   * \param index The output index.
+   * \param data_out The destination tensor (host memory; pin it for true
+   *  overlap on CUDA).
+   */
+  void SetOutputAsync(int index, DLTensor* data_out);
+  /*! \brief Block until every registered async readback of the last Run
+   *  has landed. */
+  void SyncAsyncOutputs();
+  /*!
+   * \brief Export the static execution schedule as JSON for replay
+   *  engines that dispatch the exported library without the module
+   *  machinery: storage pool, per-node kernel symbols with argument
+   *  storage bindings in call order, and input/output bindings.
+   * \return The serialized trace.
+   */
+  std::string ExportExecutionTrace() const;
   /*!
    * \brief Get the number of outputs
    *
@@ -179,6 +279,24 @@ class TVM_DLL GraphExecutor : public ModuleNode {
    * \param strm The input stream.
    */
   void LoadParams(dmlc::Stream* strm);
+  /*!
+   * \brief Load parameters from an aligned parameter file written by
+   *  runtime::SaveParamsAligned, memory-mapping CPU-resident weights in
+   *  place of copying them.
+   * \param file_name Path of the parameter file.
+   */
+  void LoadParamsFromFile(const std::string& file_name);
+
+  /*!
+   * \brief Stream parameters from file on a background thread.
+   *
+   *  Returns once the header is parsed; tensor payloads load while the
+   *  first Run executes, each op gating on its own weights, so peak
+   *  startup memory stays near steady state plus one in-flight layer and
+   *  load overlaps compute.
+   * \param file_name The parameter file written by save_param_dict.
+   */
+  void LoadParamsStreaming(const std::string& file_name);
   /*!
    * \brief Load parameters from parameter blob.
    * \param param_blob A binary blob of parameter.
@@ -439,12 +557,55 @@ class TVM_DLL GraphExecutor : public ModuleNode {
   std::vector<std::vector<DLTensor*>> output_dltensors_;
   /*! \brief Used for quick node(both model output and op input) DLTensor* lookup given an eid. */
   std::vector<std::vector<DLTensor*>> both_output_opinput_dltensors_;
+  /*! \brief A linked recurrent state: the output lands in the buffer bound as
+   *   the input of the following Run. */
+  struct StateLink {
+    int input_index;
+    int output_index;
+    NDArray buffers[2];
+    int flip{0};
+  };
+  /*! \brief Rebind every state link's buffers for the coming Run. */
+  void BindStateLinks();
+  /*! \brief Linked recurrent states, bound around each Run. */
+  std::vector<StateLink> state_links_;
+  /*! \brief Copy streams for async output readback, keyed by device. */
+  std::unordered_map<int, TVMStreamHandle> async_copy_streams_;
+  /*! \brief Keeps async readback destinations alive for the op closures. */
+  std::vector<NDArray> async_output_holds_;
+  /*! \brief Guards staged_params_. */
+  std::mutex staged_params_mutex_;
+  /*! \brief Uploaded shadow parameters awaiting the inter-inference flip. */
+  std::vector<std::pair<int, NDArray>> staged_params_;
+  /*! \brief Issue software prefetches for the given weight tensors. */
+  static void PrefetchWeights(const std::vector<const DLTensor*>& tensors);
+  /*! \brief Block until the streaming loader delivered this op's inputs. */
+  void WaitForStreamingInputs(size_t nid);
+  /*! \brief Guards the streaming-load bookkeeping below. */
+  std::mutex streaming_mutex_;
+  /*! \brief Signals entries turning ready during a streaming load. */
+  std::condition_variable streaming_cv_;
+  /*! \brief Entries whose weights the loader has not delivered yet. */
+  std::unordered_set<uint32_t> streaming_pending_eids_;
+  /*! \brief Error raised on the loader thread, rethrown on the run thread. */
+  std::exception_ptr streaming_error_{nullptr};
+  /*! \brief Whether a streaming load is in flight (gates Run). */
+  std::atomic<bool> streaming_active_{false};
+  /*! \brief The background parameter loader. */
+  std::thread streaming_thread_;
+  /*! \brief Per op, the next op's weight tensors to prefetch while it runs
+   *   (TVM_GRAPH_EXECUTOR_PREFETCH=1); empty when disabled. */
+  std::vector<std::vector<const DLTensor*>> prefetch_next_;
   /*! \brief Used for quick entry indexing. */
   std::vector<uint32_t> node_row_ptr_;
   /*! \brief Output entries. */
   std::vector<NodeEntry> outputs_;
   /*! \brief Additional graph attributes. */
   GraphAttr attrs_;
+  /*! \brief Load the parsed graph structures from the binary format. */
+  void LoadBinaryGraph(const std::string& blob);
+  /*! \brief The graph json this executor was initialized from. */
+  std::string graph_json_;
   /*! \brief The code module that contains both host and device code. */
   tvm::runtime::Module module_;
   /*! \brief Execution context of all devices including the host. */
@@ -455,8 +616,22 @@ class TVM_DLL GraphExecutor : public ModuleNode {
   std::vector<NDArray> data_entry_;
   /*! \brief Data alignment of each node. */
   std::vector<size_t> data_alignment_;
+  /*! \brief Double-buffered pinned host staging for device inputs, by eid. */
+  std::vector<std::array<NDArray, 2>> input_staging_;
+  /*! \brief Which staging buffer the next SetInput writes, by eid. */
+  std::vector<uint8_t> input_staging_turn_;
+  /*! \brief Whether ShareParam rebound storage since the last op setup. */
+  bool shared_params_pending_{false};
+  /*! \brief Storage ids backed by linked parameters; never scribbled on. */
+  std::unordered_set<int> linked_param_sids_;
   /*! \brief Operator on each node. */
   std::vector<std::function<void()>> op_execs_;
+  /*! \brief Whether Run() uses the dependency-counted async scheduler. */
+  bool async_exec_enabled_{false};
+  /*! \brief Consumer ops of each op, for the async scheduler. */
+  std::vector<std::vector<uint32_t>> op_consumers_;
+  /*! \brief Number of producer ops of each op, for the async scheduler. */
+  std::vector<int> op_indegree_;
   /*! \brief Linked parameter lookup function. */
   PackedFunc lookup_linked_param_;
   /*! \brief Module's _lookup_linked_param function, used by DefaultLookupLinkedParam. */
@@ -29,6 +29,8 @@
 #include <tvm/runtime/device_api.h>
 #include <tvm/runtime/registry.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <iterator>
 #include <vector>
 
@@ -117,6 +119,20 @@ void GraphExecutorFactory::SaveToBinary(dmlc::Stream* stream) {
 }
 
 Module GraphExecutorFactory::ExecutorCreate(const std::vector<Device>& devs) {
+  // Transparently upgrade the default executor to the CUDA graph capturing
+  // one when it is built in, a CUDA device is used, and the user opted in via
+  // TVM_USE_CUDA_GRAPH=1: Run() then auto-captures on first call and replays
+  // the whole graph with a single cudaGraphLaunch afterwards.
+  const char* use_cuda_graph = getenv("TVM_USE_CUDA_GRAPH");
+  if (use_cuda_graph && atoi(use_cuda_graph) != 0 &&
+      tvm::runtime::Registry::Get("tvm.graph_executor_cuda_graph.create") != nullptr) {
+    bool has_cuda_dev = std::any_of(devs.begin(), devs.end(), [](const Device& dev) {
+      return dev.device_type == kDLCUDA;
+    });
+    if (has_cuda_dev) {
+      return CudaGraphExecutorCreate(devs);
+    }
+  }
   auto exec = make_object<GraphExecutor>();
   exec->Init(this->graph_json_, this->imports_[0], devs, PackedFunc());
   // set params
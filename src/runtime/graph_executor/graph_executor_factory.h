@@ -116,12 +116,23 @@ class TVM_DLL GraphExecutorFactory : public runtime::ModuleNode {
                 auto rhs_size = GetDataSize(*value[rhs].operator->());
                 return lhs_size > rhs_size;
               });
+    // With TVM_GRAPH_EXECUTOR_SHARED_WEIGHTS=1, identical device-resident
+    // parameters are uploaded once process-wide and aliased across factories
+    // (LoRA-style variants of one base model share every unchanged layer).
+    static const bool shared_weights = []() {
+      const char* val = getenv("TVM_GRAPH_EXECUTOR_SHARED_WEIGHTS");
+      return val && atoi(val) != 0;
+    }();
     for (const auto& key : keys) {
       int in_idx = graph_executor->GetInputIndex(key);
       if (in_idx >= 0) {
+        if (shared_weights && graph_executor->ShareParam(in_idx, value[key])) {
+          continue;
+        }
         graph_executor->SetInput(in_idx, const_cast<DLTensor*>(value[key].operator->()));
       }
     }
+    graph_executor->FinalizeSharedParams();
   }
 
  protected:
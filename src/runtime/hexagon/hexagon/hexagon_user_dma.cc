@@ -113,6 +113,109 @@ int hexagon_user_dma_1d_sync(void* dst, void* src, uint32_t length) {
 #endif
 }
 
+namespace {
+
+/*! \brief Fill a 1-D transfer descriptor; returns nullptr on failure. */
+void* MakeDma1DDescriptor(void* dst, void* src, uint32_t length) {
+  uint64_t src64 = reinterpret_cast<uint64_t>(src);
+  uint64_t dst64 = reinterpret_cast<uint64_t>(dst);
+  if (src64 > DESC_SRC_MASK || dst64 > DESC_DST_MASK || length > DESC_LENGTH_MASK) {
+    return nullptr;
+  }
+  void* dma_desc = nullptr;
+#ifdef _WIN32
+  dma_desc = _aligned_malloc(DMA_DESC_2D_SIZE, DMA_DESC_2D_SIZE);
+#else
+  if (posix_memalign(&dma_desc, DMA_DESC_2D_SIZE, DMA_DESC_2D_SIZE)) {
+    return nullptr;
+  }
+#endif
+  if (!dma_desc) return nullptr;
+  dma_desc_set_next(dma_desc, DMA_NULL_PTR);
+  dma_desc_set_length(dma_desc, length);
+  dma_desc_set_desctype(dma_desc, DESC_DESCTYPE_1D);
+  dma_desc_set_dstcomp(dma_desc, DESC_COMP_NONE);
+  dma_desc_set_srccomp(dma_desc, DESC_COMP_NONE);
+  dma_desc_set_bypassdst(dma_desc, DESC_BYPASS_OFF);
+  dma_desc_set_bypasssrc(dma_desc, DESC_BYPASS_OFF);
+  dma_desc_set_order(dma_desc, DESC_ORDER_ORDER);
+  dma_desc_set_dstate(dma_desc, DESC_DSTATE_INCOMPLETE);
+  dma_desc_set_src(dma_desc, static_cast<uint32_t>(src64 & DESC_SRC_MASK));
+  dma_desc_set_dst(dma_desc, static_cast<uint32_t>(dst64 & DESC_DST_MASK));
+  return dma_desc;
+}
+
+/*! \brief The descriptor of the in-flight async transfer, one per thread. */
+thread_local void* async_dma_desc = nullptr;
+
+void FreeDmaDescriptor(void* dma_desc) {
+#ifdef _WIN32
+  _aligned_free(dma_desc);
+#else
+  free(dma_desc);
+#endif
+}
+
+}  // namespace
+
 }  // namespace hexagon
 }  // namespace runtime
 }  // namespace tvm
+
+/*!
+ * \brief Wait for the thread's in-flight async DMA transfer, if any.
+ *
+ *  Exposed with C linkage so schedules reach it via call_extern; pairs with
+ *  hexagon_user_dma_1d_async below for ping-pong compute/copy overlap.
+ * \return 0 on success (or when nothing was in flight).
+ */
+extern "C" int hexagon_user_dma_wait() {
+  using namespace tvm::runtime::hexagon;
+  if (async_dma_desc == nullptr) return DMA_SUCCESS;
+#if defined(__hexagon__)
+  unsigned int status = dmwait() & DM0_STATUS_MASK;
+  unsigned int done = dma_desc_get_dstate(async_dma_desc);
+  FreeDmaDescriptor(async_dma_desc);
+  async_dma_desc = nullptr;
+  if (status == DM0_STATUS_IDLE && done == DESC_DSTATE_COMPLETE) {
+    return DMA_SUCCESS;
+  }
+  return DMA_FAILURE;
+#else
+  FreeDmaDescriptor(async_dma_desc);
+  async_dma_desc = nullptr;
+  return DMA_SUCCESS;
+#endif
+}
+
+/*!
+ * \brief Start a 1-D DMA transfer and return immediately.
+ *
+ *  One transfer may be in flight per thread - exactly the ping-pong pattern:
+ *  start the next tile's copy, run this tile's compute, then
+ *  hexagon_user_dma_wait before touching the destination. Submitting while a
+ *  transfer is in flight drains the previous one first.
+ * \return 0 when the transfer was started (or completed, off target).
+ */
+extern "C" int hexagon_user_dma_1d_async(void* dst, void* src, uint32_t length) {
+  using namespace tvm::runtime::hexagon;
+#if defined(__hexagon__)
+  static int config_dma = init_hexagon_user_dma();
+  if (config_dma != DMA_SUCCESS) {
+    return DMA_FAILURE;
+  }
+  if (async_dma_desc != nullptr && hexagon_user_dma_wait() != DMA_SUCCESS) {
+    return DMA_FAILURE;
+  }
+  void* dma_desc = MakeDma1DDescriptor(dst, src, length);
+  if (dma_desc == nullptr) {
+    return DMA_FAILURE;
+  }
+  async_dma_desc = dma_desc;
+  dmstart(dma_desc);
+  return DMA_SUCCESS;
+#else
+  memcpy(dst, src, length);
+  return DMA_SUCCESS;
+#endif
+}
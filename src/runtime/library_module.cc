@@ -27,13 +27,46 @@
 #include <tvm/runtime/module.h>
 #include <tvm/runtime/registry.h>
 
+#include <cstring>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "../support/compression.h"
+
 namespace tvm {
 namespace runtime {
 
+/*!
+ * \brief Resolve a symbol, preferring a variant built for the running CPU.
+ *
+ *  An artifact may carry several builds of one kernel as "<name>.<feature>"
+ *  symbols (e.g. "fused_conv2d.avx512f"), produced by compiling the kernel
+ *  at several -mcpu levels with suffixed global symbols and linking them
+ *  into one library. Resolution walks the features the running CPU supports
+ *  from widest vectors down and takes the first variant present, falling
+ *  back to the plain symbol - glibc-ifunc-style dispatch that replaces
+ *  shipping one artifact per ISA level. Lookups happen once per function
+ *  (callers cache the PackedFunc), so the extra probes are load-time cost.
+ */
+static void* LookupMultiVersionSymbol(Library* lib, const std::string& name) {
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+  static const std::vector<const char*> supported = []() {
+    std::vector<const char*> feats;
+    if (__builtin_cpu_supports("avx512f")) feats.push_back("avx512f");
+    if (__builtin_cpu_supports("avx2")) feats.push_back("avx2");
+    if (__builtin_cpu_supports("sse4.2")) feats.push_back("sse4.2");
+    return feats;
+  }();
+  for (const char* feat : supported) {
+    if (void* addr = lib->GetSymbol((name + "." + feat).c_str())) {
+      return addr;
+    }
+  }
+#endif
+  return lib->GetSymbol(name.c_str());
+}
+
 // Library module that exposes symbols from a library.
 class LibraryModuleNode final : public ModuleNode {
  public:
@@ -44,6 +77,14 @@ class LibraryModuleNode final : public ModuleNode {
 
   PackedFunc GetFunction(const std::string& name, const ObjectPtr<Object>& sptr_to_self) final {
     TVMBackendPackedCFunc faddr;
+    if (name == runtime::symbol::tvm_lookup_packed_c_func) {
+      // Hand out raw symbol addresses so hot dispatch paths (e.g. the graph
+      // executor's frozen call frames) can bypass PackedFunc marshalling.
+      ObjectPtr<Library> lib = lib_;
+      return PackedFunc([lib, sptr_to_self](TVMArgs args, TVMRetValue* rv) {
+        *rv = LookupMultiVersionSymbol(lib.get(), args[0].operator std::string());
+      });
+    }
     if (name == runtime::symbol::tvm_module_main) {
       const char* entry_name =
           reinterpret_cast<const char*>(lib_->GetSymbol(runtime::symbol::tvm_module_main));
@@ -51,7 +92,7 @@ class LibraryModuleNode final : public ModuleNode {
           << "Symbol " << runtime::symbol::tvm_module_main << " is not presented";
       faddr = reinterpret_cast<TVMBackendPackedCFunc>(lib_->GetSymbol(entry_name));
     } else {
-      faddr = reinterpret_cast<TVMBackendPackedCFunc>(lib_->GetSymbol(name.c_str()));
+      faddr = reinterpret_cast<TVMBackendPackedCFunc>(LookupMultiVersionSymbol(lib_.get(), name));
     }
     if (faddr == nullptr) return PackedFunc();
     return packed_func_wrapper_(faddr, sptr_to_self);
@@ -139,8 +180,27 @@ void ProcessModuleBlob(const char* mblob, ObjectPtr<Library> lib,
     uint64_t c = mblob[i];
     nbytes |= (c & 0xffUL) << (i * 8);
   }
-  dmlc::MemoryFixedSizeStream fs(const_cast<char*>(mblob + sizeof(nbytes)),
-                                 static_cast<size_t>(nbytes));
+  const char* payload = mblob + sizeof(nbytes);
+  // Blobs exported with TVM_EXPORT_COMPRESS carry a magic prefix and the raw
+  // size; decompress into a local buffer the module loads then copy from.
+  std::string decompressed;
+  const size_t magic_len = std::strlen(symbol::tvm_dev_mblob_compressed_magic);
+  if (nbytes >= magic_len + sizeof(uint64_t) &&
+      std::memcmp(payload, symbol::tvm_dev_mblob_compressed_magic, magic_len) == 0) {
+    uint64_t raw_size = 0;
+    for (size_t i = 0; i < sizeof(raw_size); ++i) {
+      uint64_t c = static_cast<unsigned char>(payload[magic_len + i]);
+      raw_size |= c << (i * 8);
+    }
+    size_t packed_offset = magic_len + sizeof(raw_size);
+    ICHECK(support::DecompressBytes(payload + packed_offset,
+                                    static_cast<size_t>(nbytes) - packed_offset,
+                                    static_cast<size_t>(raw_size), &decompressed))
+        << "Corrupted compressed device blob";
+    payload = decompressed.data();
+    nbytes = raw_size;
+  }
+  dmlc::MemoryFixedSizeStream fs(const_cast<char*>(payload), static_cast<size_t>(nbytes));
   dmlc::Stream* stream = &fs;
   uint64_t size;
   ICHECK(stream->Read(&size));
@@ -205,7 +205,10 @@ class MetalWrappedFunc {
       int blockSize = wl.block_dim(0) * wl.block_dim(1) * wl.block_dim(2);
       auto maxTotalThreadsPerThreadgroup = scache_[device_id].maxTotalThreadsPerThreadgroup;
       CHECK_LE(blockSize, maxTotalThreadsPerThreadgroup);
-      id<MTLCommandBuffer> cb = stream->GetCommandBuffer();
+      // In batched mode the encoder appends to the stream's open command
+      // buffer; otherwise each launch commits its own buffer as before.
+      id<MTLCommandBuffer> batch_cb = stream->GetBatchCommandBuffer();
+      id<MTLCommandBuffer> cb = batch_cb != nil ? batch_cb : stream->GetCommandBuffer();
       id<MTLComputeCommandEncoder> encoder = [cb computeCommandEncoder];
       [encoder setComputePipelineState:scache_[device_id]];
       for (size_t i = 0; i < num_buffer_args_; ++i) {
@@ -222,7 +225,9 @@ class MetalWrappedFunc {
       MTLSize dimBlock = MTLSizeMake(wl.block_dim(0), wl.block_dim(1), wl.block_dim(2));
       [encoder dispatchThreadgroups:dimGrid threadsPerThreadgroup:dimBlock];
       [encoder endEncoding];
-      [cb commit];
+      if (batch_cb == nil) {
+        [cb commit];
+      }
     };
   }
 
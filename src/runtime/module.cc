@@ -59,6 +59,31 @@ void ModuleNode::Import(Module other) {
   }
   ICHECK(!visited.count(this)) << "Cyclic dependency detected during import";
   this->imports_.emplace_back(std::move(other));
+  this->flattened_imports_.clear();
+  this->last_resolver_ = nullptr;
+}
+
+void ModuleNode::EnsureFlattenedImports() {
+  // Flatten the import DAG once: a miss then queries every reachable module
+  // exactly once, where the recursive walk re-visited shared subtrees via
+  // every diamond path and paid per-level dispatch.
+  if (!flattened_imports_.empty() || imports_.empty()) return;
+  std::unordered_set<const ModuleNode*> visited;
+  std::vector<ModuleNode*> stack;
+  // Push in reverse so the pop order preserves the original depth-first
+  // preorder, which decides who wins when two modules export one name.
+  for (auto it = imports_.rbegin(); it != imports_.rend(); ++it) {
+    stack.push_back(it->operator->());
+  }
+  while (!stack.empty()) {
+    ModuleNode* node = stack.back();
+    stack.pop_back();
+    if (!visited.insert(node).second) continue;
+    flattened_imports_.push_back(node);
+    for (auto it = node->imports_.rbegin(); it != node->imports_.rend(); ++it) {
+      stack.push_back(it->operator->());
+    }
+  }
 }
 
 PackedFunc ModuleNode::GetFunction(const std::string& name, bool query_imports) {
@@ -66,9 +91,20 @@ PackedFunc ModuleNode::GetFunction(const std::string& name, bool query_imports)
   PackedFunc pf = self->GetFunction(name, GetObjectPtr<Object>(this));
   if (pf != nullptr) return pf;
   if (query_imports) {
-    for (Module& m : self->imports_) {
-      pf = m.operator->()->GetFunction(name, query_imports);
+    EnsureFlattenedImports();
+    // Consecutive executor-setup lookups overwhelmingly resolve in one
+    // device module; probing the previous resolver first makes those O(1).
+    // Codegen uniquifies symbols across the modules of one artifact, so
+    // probing out of preorder cannot change which definition wins.
+    if (last_resolver_ != nullptr) {
+      pf = last_resolver_->GetFunction(name, GetObjectPtr<Object>(last_resolver_));
+      if (pf != nullptr) return pf;
+    }
+    for (ModuleNode* m : self->flattened_imports_) {
+      if (m == last_resolver_) continue;
+      pf = m->GetFunction(name, GetObjectPtr<Object>(m));
       if (pf != nullptr) {
+        last_resolver_ = m;
         return pf;
       }
     }
@@ -108,9 +144,10 @@ std::string ModuleNode::GetSource(const std::string& format) {
 const PackedFunc* ModuleNode::GetFuncFromEnv(const std::string& name) {
   auto it = import_cache_.find(name);
   if (it != import_cache_.end()) return it->second.get();
+  EnsureFlattenedImports();
   PackedFunc pf;
-  for (Module& m : this->imports_) {
-    pf = m.GetFunction(name, true);
+  for (ModuleNode* m : this->flattened_imports_) {
+    pf = m->GetFunction(name, GetObjectPtr<Object>(m));
     if (pf != nullptr) break;
   }
   if (pf == nullptr) {
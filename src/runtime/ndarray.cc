@@ -121,6 +121,11 @@ struct NDArray::Internal {
     }
     delete ptr;
   }
+  // Deleter for borrowed DLPack views: the caller keeps ownership of the
+  // external tensor, so only the container goes away.
+  static void BorrowedDLPackDeleter(Object* ptr_obj) {
+    delete static_cast<NDArray::Container*>(ptr_obj);
+  }
   // Local create function which allocates tensor metadata
   // but does not allocate space for the data.
   static NDArray Create(ShapeTuple shape, DLDataType dtype, Device dev) {
@@ -172,6 +177,60 @@ struct NDArray::Internal {
   }
 };
 
+namespace {
+
+// Thread-cached freelist backing NDArray::Container allocation. Entries are
+// uniformly sizeof(Container), so blocks may be freed from a different thread
+// than the one that allocated them; each cache is bounded and hands surplus
+// blocks back to the system allocator.
+// The sentinel is trivially destructible, so unlike the freelist itself it
+// stays readable during late (post-TLS-destruction) frees at thread exit.
+thread_local bool container_free_list_destroyed = false;
+
+struct ContainerFreeList {
+  static constexpr size_t kMaxCached = 1024;
+  std::vector<void*> blocks;
+
+  ~ContainerFreeList() {
+    for (void* block : blocks) {
+      ::operator delete(block);
+    }
+    container_free_list_destroyed = true;
+  }
+};
+
+thread_local ContainerFreeList container_free_list;
+
+}  // namespace
+
+void* NDArray::Container::operator new(size_t size) {
+  if (size != sizeof(NDArray::Container) || container_free_list_destroyed) {
+    // A differently sized (sub)class cannot use the uniform freelist, and
+    // allocations after thread teardown must not revive it.
+    return ::operator new(size);
+  }
+  ContainerFreeList& cache = container_free_list;
+  if (!cache.blocks.empty()) {
+    void* block = cache.blocks.back();
+    cache.blocks.pop_back();
+    return block;
+  }
+  return ::operator new(size);
+}
+
+void NDArray::Container::operator delete(void* ptr, size_t size) {
+  if (size != sizeof(NDArray::Container) || container_free_list_destroyed) {
+    ::operator delete(ptr);
+    return;
+  }
+  ContainerFreeList& cache = container_free_list;
+  if (cache.blocks.size() < ContainerFreeList::kMaxCached) {
+    cache.blocks.push_back(ptr);
+    return;
+  }
+  ::operator delete(ptr);
+}
+
 NDArray NDArray::CreateView(ShapeTuple shape, DLDataType dtype) {
   ICHECK(data_ != nullptr);
   ICHECK(get_mutable()->dl_tensor.strides == nullptr) << "Can only create view for compact tensor";
@@ -214,6 +273,21 @@ NDArray NDArray::FromDLPack(DLManagedTensor* tensor) {
   return NDArray(GetObjectPtr<Object>(data));
 }
 
+NDArray NDArray::FromDLPackBorrowed(const DLTensor* tensor) {
+  // Call-scoped interop: no ownership transfer and no deleter round trip
+  // into the producing framework. The caller guarantees the external tensor
+  // outlives the returned view; with the container freelist this path does
+  // no heap allocation in steady state beyond the cached block.
+  NDArray::Container* data = new NDArray::Container();
+  data->SetDeleter(Internal::BorrowedDLPackDeleter);
+  data->manager_ctx = nullptr;
+  data->dl_tensor = *tensor;
+  std::vector<ShapeTuple::index_type> shape(tensor->shape, tensor->shape + tensor->ndim);
+  data->shape_ = ShapeTuple(shape);
+  data->dl_tensor.shape = const_cast<ShapeTuple::index_type*>(data->shape_.data());
+  return NDArray(GetObjectPtr<Object>(data));
+}
+
 void NDArray::CopyToBytes(void* data, size_t nbytes) const {
   ICHECK(data != nullptr);
   ICHECK(data_ != nullptr);
@@ -311,6 +385,12 @@ int TVMArrayFromDLPack(DLManagedTensor* from, TVMArrayHandle* out) {
   API_END();
 }
 
+int TVMArrayFromDLPackBorrowed(DLTensor* from, TVMArrayHandle* out) {
+  API_BEGIN();
+  *out = NDArray::Internal::MoveToFFIHandle(NDArray::FromDLPackBorrowed(from));
+  API_END();
+}
+
 int TVMArrayToDLPack(TVMArrayHandle from, DLManagedTensor** out) {
   API_BEGIN();
   *out = NDArray::Internal::ToDLPack(from);
@@ -0,0 +1,254 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file ndarray_layout.cc
+ * \brief Native host-side layout conversion between CPU tensors.
+ *
+ *  Feeding an NHWC user input into an NCHWc model (and reading results back)
+ *  used to relayout in Python per request. runtime.NDArrayConvertLayout
+ *  converts directly in the runtime for any layout pair expressible as a
+ *  permutation with axis splits or merges ("NCHW", "NHWC", "NCHW16c",
+ *  "OIHW4i4o", ...): destination dimensions resolve to constant source
+ *  strides where possible, and the copy walks the destination in row-major
+ *  order so writes stream while the innermost gather vectorizes.
+ */
+#include <tvm/runtime/ndarray.h>
+#include <tvm/runtime/packed_func.h>
+#include <tvm/runtime/registry.h>
+
+#include <cctype>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace tvm {
+namespace runtime {
+
+namespace {
+
+/*! \brief One dimension of a layout: a primitive axis and this part's size
+ * (-1 for the unsplit / major part whose size comes from the tensor). */
+struct LayoutPart {
+  char axis;
+  int64_t size;
+};
+
+std::vector<LayoutPart> ParseLayout(const std::string& layout) {
+  std::vector<LayoutPart> parts;
+  int64_t factor = 0;
+  for (char c : layout) {
+    if (std::isdigit(c)) {
+      factor = factor * 10 + (c - '0');
+    } else if (std::isupper(c)) {
+      CHECK_EQ(factor, 0) << "Invalid layout " << layout;
+      parts.push_back(LayoutPart{c, -1});
+    } else if (std::islower(c)) {
+      CHECK_GT(factor, 0) << "Invalid layout " << layout << ": sub-dimension needs a size";
+      parts.push_back(LayoutPart{static_cast<char>(std::toupper(c)), factor});
+      factor = 0;
+    } else {
+      LOG(FATAL) << "Invalid layout character in " << layout;
+    }
+  }
+  CHECK_EQ(factor, 0) << "Invalid layout " << layout;
+  return parts;
+}
+
+/*! \brief Per primitive axis: its parts in layout order with their extents,
+ * weights (in axis-value space), and tensor strides. */
+struct AxisParts {
+  std::vector<int64_t> extents;
+  std::vector<int64_t> weights;
+  std::vector<int64_t> strides;
+  int64_t total_extent{1};
+};
+
+std::unordered_map<char, AxisParts> ResolveAxes(const std::vector<LayoutPart>& parts,
+                                                const int64_t* shape, int ndim) {
+  CHECK_EQ(static_cast<int>(parts.size()), ndim) << "Layout rank does not match tensor rank";
+  // Tensor strides, row-major compact.
+  std::vector<int64_t> strides(ndim);
+  int64_t acc = 1;
+  for (int i = ndim - 1; i >= 0; --i) {
+    strides[i] = acc;
+    acc *= shape[i];
+  }
+  std::unordered_map<char, AxisParts> axes;
+  for (int i = 0; i < ndim; ++i) {
+    AxisParts& axis = axes[parts[i].axis];
+    axis.extents.push_back(shape[i]);
+    axis.strides.push_back(strides[i]);
+    if (parts[i].size >= 0) {
+      CHECK_EQ(parts[i].size, shape[i]) << "Layout sub-dimension size mismatch";
+    }
+    axis.total_extent *= shape[i];
+  }
+  // Weights: product of the extents of all more-minor parts of the axis.
+  for (auto& kv : axes) {
+    AxisParts& axis = kv.second;
+    int64_t weight = 1;
+    axis.weights.resize(axis.extents.size());
+    for (int i = static_cast<int>(axis.extents.size()) - 1; i >= 0; --i) {
+      axis.weights[i] = weight;
+      weight *= axis.extents[i];
+    }
+  }
+  return axes;
+}
+
+}  // namespace
+
+NDArray NDArrayConvertLayout(NDArray src, String src_layout, String dst_layout) {
+  const DLTensor* tensor = src.operator->();
+  CHECK_EQ(tensor->device.device_type, kDLCPU) << "ConvertLayout expects CPU tensors";
+  CHECK(IsContiguous(*tensor)) << "ConvertLayout expects compact tensors";
+
+  std::vector<LayoutPart> src_parts = ParseLayout(src_layout);
+  std::vector<LayoutPart> dst_parts = ParseLayout(dst_layout);
+  auto src_axes = ResolveAxes(src_parts, tensor->shape, tensor->ndim);
+
+  // Destination shape: split sizes are explicit; the major part of each axis
+  // receives the remainder of the axis extent.
+  int dst_ndim = static_cast<int>(dst_parts.size());
+  std::vector<int64_t> dst_shape(dst_ndim);
+  std::unordered_map<char, int64_t> remaining;
+  for (const auto& kv : src_axes) {
+    remaining[kv.first] = kv.second.total_extent;
+  }
+  for (int i = 0; i < dst_ndim; ++i) {
+    CHECK(src_axes.count(dst_parts[i].axis))
+        << "Axis " << dst_parts[i].axis << " missing from source layout";
+    if (dst_parts[i].size >= 0) {
+      dst_shape[i] = dst_parts[i].size;
+      CHECK_EQ(remaining[dst_parts[i].axis] % dst_parts[i].size, 0)
+          << "Axis " << dst_parts[i].axis << " not divisible by sub-dimension";
+      remaining[dst_parts[i].axis] /= dst_parts[i].size;
+    }
+  }
+  for (int i = 0; i < dst_ndim; ++i) {
+    if (dst_parts[i].size < 0) {
+      dst_shape[i] = remaining[dst_parts[i].axis];
+      remaining[dst_parts[i].axis] = 1;  // consumed
+    }
+  }
+  for (const auto& kv : remaining) {
+    CHECK_EQ(kv.second, 1) << "Destination layout does not cover axis " << kv.first;
+  }
+
+  // Each destination dimension maps to the source either affinely (its
+  // value range lies inside one source part: constant stride) or through the
+  // axis's part decomposition (merge directions like NCHW16c -> NHWC, where
+  // one destination value spans both source parts).
+  struct DimMap {
+    int64_t stride;  // nonzero: affine fast path
+    const AxisParts* axis;
+    int64_t weight;
+  };
+  std::vector<DimMap> dim_map(dst_ndim);
+  {
+    std::unordered_map<char, int64_t> weight;
+    for (int i = dst_ndim - 1; i >= 0; --i) {
+      char axis = dst_parts[i].axis;
+      int64_t w = weight.count(axis) ? weight[axis] : 1;
+      const AxisParts& sa = src_axes[axis];
+      int64_t src_stride = 0;
+      for (size_t p = 0; p < sa.weights.size(); ++p) {
+        if (w >= sa.weights[p] && (dst_shape[i] * w) <= sa.weights[p] * sa.extents[p] &&
+            w % sa.weights[p] == 0) {
+          src_stride = sa.strides[p] * (w / sa.weights[p]);
+          break;
+        }
+      }
+      dim_map[i] = DimMap{src_stride, &sa, w};
+      weight[axis] = w * dst_shape[i];
+    }
+  }
+  auto offset_of = [&](int i, int64_t c) -> int64_t {
+    const DimMap& m = dim_map[i];
+    if (m.stride) return c * m.stride;
+    int64_t v = c * m.weight;
+    int64_t off = 0;
+    for (size_t p = 0; p < m.axis->weights.size(); ++p) {
+      off += ((v / m.axis->weights[p]) % m.axis->extents[p]) * m.axis->strides[p];
+    }
+    return off;
+  };
+
+  NDArray dst = NDArray::Empty(dst_shape, tensor->dtype, tensor->device);
+  const char* in = static_cast<const char*>(tensor->data) + tensor->byte_offset;
+  char* out = static_cast<char*>(dst->data);
+  int64_t elem_bytes = (tensor->dtype.bits * tensor->dtype.lanes + 7) / 8;
+
+  // Row-major walk of the destination: writes stream, and an affine
+  // innermost dimension is a constant-stride gather (memcpy when unit).
+  int64_t total = 1;
+  for (int i = 0; i < dst_ndim; ++i) total *= dst_shape[i];
+  std::vector<int64_t> coord(dst_ndim, 0);
+  int64_t inner_extent = dst_shape[dst_ndim - 1];
+  const DimMap& inner = dim_map[dst_ndim - 1];
+
+  auto copy_rows = [&](auto type_tag) {
+    using T = decltype(type_tag);
+    const T* tin = reinterpret_cast<const T*>(in);
+    T* tout = reinterpret_cast<T*>(out);
+    for (int64_t base = 0; base < total; base += inner_extent) {
+      int64_t src_base = 0;
+      for (int i = 0; i < dst_ndim - 1; ++i) src_base += offset_of(i, coord[i]);
+      if (inner.stride == 1) {
+        std::memcpy(tout + base, tin + src_base, inner_extent * sizeof(T));
+      } else if (inner.stride != 0) {
+        for (int64_t j = 0; j < inner_extent; ++j) {
+          tout[base + j] = tin[src_base + j * inner.stride];
+        }
+      } else {
+        for (int64_t j = 0; j < inner_extent; ++j) {
+          tout[base + j] = tin[src_base + offset_of(dst_ndim - 1, j)];
+        }
+      }
+      for (int i = dst_ndim - 2; i >= 0; --i) {
+        if (++coord[i] < dst_shape[i]) break;
+        coord[i] = 0;
+      }
+    }
+  };
+  switch (elem_bytes) {
+    case 1:
+      copy_rows(uint8_t{});
+      break;
+    case 2:
+      copy_rows(uint16_t{});
+      break;
+    case 4:
+      copy_rows(uint32_t{});
+      break;
+    case 8:
+      copy_rows(uint64_t{});
+      break;
+    default:
+      LOG(FATAL) << "Unsupported element size " << elem_bytes;
+  }
+  return dst;
+}
+
+TVM_REGISTER_GLOBAL("runtime.NDArrayConvertLayout").set_body_typed(NDArrayConvertLayout);
+
+}  // namespace runtime
+}  // namespace tvm
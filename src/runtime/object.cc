@@ -24,9 +24,11 @@
 #include <tvm/runtime/object.h>
 #include <tvm/runtime/registry.h>
 
+#include <condition_variable>
 #include <iostream>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -228,6 +230,63 @@ TVM_REGISTER_GLOBAL("runtime.ObjectPtrHash").set_body_typed([](ObjectRef obj) {
 TVM_REGISTER_GLOBAL("runtime.DumpTypeTable").set_body_typed([](int min_child_count) {
   TypeContext::Global()->Dump(min_child_count);
 });
+
+/*!
+ * \brief Background destruction of large object graphs.
+ *
+ *  Dropping the last reference to a big IRModule cascades millions of
+ *  decrefs and deleter calls through the graph, stalling the releasing
+ *  thread for seconds. ReleaseAsync moves that final release onto a single
+ *  background worker: the caller hands over its reference and returns
+ *  immediately, and the cascade runs off the critical path. The worker is a
+ *  leaked singleton so releases queued during process teardown are simply
+ *  abandoned to the OS rather than racing static destruction.
+ *
+ *  The call adds a reference of its own, so the caller must drop theirs
+ *  right after handing the object over; the worker's release - strictly
+ *  later than the enqueue - is then the last one and runs the cascade.
+ */
+class BackgroundReleaser {
+ public:
+  static BackgroundReleaser* Global() {
+    static BackgroundReleaser* inst = new BackgroundReleaser();
+    return inst;
+  }
+
+  void Release(ObjectRef obj) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push_back(std::move(obj));
+    }
+    cv_.notify_one();
+  }
+
+ private:
+  BackgroundReleaser() {
+    worker_ = std::thread([this]() {
+      for (;;) {
+        std::vector<ObjectRef> batch;
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          cv_.wait(lock, [this]() { return !queue_.empty(); });
+          batch.swap(queue_);
+        }
+        batch.clear();  // the destruction cascades run here
+      }
+    });
+    worker_.detach();
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<ObjectRef> queue_;
+  std::thread worker_;
+};
+
+TVM_REGISTER_GLOBAL("runtime.ReleaseAsync").set_body([](TVMArgs args, TVMRetValue* rv) {
+  ObjectRef obj = args[0];
+  BackgroundReleaser::Global()->Release(std::move(obj));
+});
 }  // namespace runtime
 }  // namespace tvm
 
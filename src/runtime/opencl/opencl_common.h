@@ -235,6 +235,9 @@ class OpenCLWorkspace : public DeviceAPI {
   std::vector<cl_device_id> devices;
   // the queues
   std::vector<cl_command_queue> queues;
+  // per-device transfer queues for staging copies (event-deps mode only;
+  // entries are null and staging uses the compute queue otherwise)
+  std::vector<cl_command_queue> transfer_queues;
   // the events
   std::vector<std::vector<cl_event>> events;
   // Number of registered kernels
@@ -266,6 +269,47 @@ class OpenCLWorkspace : public DeviceAPI {
         << "Invalid OpenCL device_id=" << dev.device_id;
     return queues[dev.device_id];
   }
+  /*! \brief The staging queue for host-to-device uploads; equals the
+   *  compute queue unless event-dependency mode provides the cross-queue
+   *  ordering that makes a separate queue safe. */
+  cl_command_queue GetTransferQueue(Device dev) {
+    ICHECK(IsOpenCLDevice(dev));
+    this->Init();
+    ICHECK(dev.device_id >= 0 && static_cast<size_t>(dev.device_id) < transfer_queues.size())
+        << "Invalid OpenCL device_id=" << dev.device_id;
+    cl_command_queue queue = transfer_queues[dev.device_id];
+    return queue != nullptr ? queue : queues[dev.device_id];
+  }
+  /*! \brief Whether out-of-order queues with event dependencies are used. */
+  bool event_deps_enabled{false};
+  /*! \brief Dependency state of one buffer in the event graph. */
+  struct BufferDeps {
+    cl_event last_write{nullptr};
+    std::vector<cl_event> reads_since_write;
+  };
+  /*! \brief Per-buffer event-dependency state (event_deps_enabled mode). */
+  std::unordered_map<cl_mem, BufferDeps> buffer_deps;
+  /*! \brief Guards buffer_deps. */
+  std::mutex buffer_deps_mutex;
+  /*!
+   * \brief Gather the events an op touching the given buffers must wait on:
+   * the last writer of every read buffer, and additionally every reader
+   * since the last write for buffers the op writes.
+   */
+  void CollectDepEvents(const std::vector<cl_mem>& reads, const std::vector<cl_mem>& writes,
+                        std::vector<cl_event>* wait_list);
+  /*!
+   * \brief Record an enqueued op's event against the buffers it touched.
+   * Takes its own references on \p event; the caller keeps ownership of its
+   * reference.
+   */
+  void RecordDepEvent(const std::vector<cl_mem>& reads, const std::vector<cl_mem>& writes,
+                      cl_event event);
+  /*! \brief Release the references CollectDepEvents took on a wait list. */
+  void ReleaseDepEvents(const std::vector<cl_event>& wait_list);
+  /*! \brief Drop (and release) the dependency state of a freed buffer. */
+  void ReleaseDepState(cl_mem mem);
+
   // get the event queue of the context
   std::vector<cl_event>& GetEventQueue(Device dev) {
     ICHECK(IsOpenCLDevice(dev));
@@ -228,12 +228,112 @@ void* OpenCLWorkspace::AllocDataSpace(Device dev, int ndim, const int64_t* shape
   return desc;
 }
 
+namespace {
+
+// Completed events need not be waited on; used to bound reader lists.
+bool EventCompleted(cl_event event) {
+  cl_int status = CL_QUEUED;
+  cl_int err =
+      clGetEventInfo(event, CL_EVENT_COMMAND_EXECUTION_STATUS, sizeof(status), &status, nullptr);
+  return err == CL_SUCCESS && status == CL_COMPLETE;
+}
+
+}  // namespace
+
+void OpenCLWorkspace::CollectDepEvents(const std::vector<cl_mem>& reads,
+                                       const std::vector<cl_mem>& writes,
+                                       std::vector<cl_event>* wait_list) {
+  std::lock_guard<std::mutex> lock(buffer_deps_mutex);
+  // Each collected event is retained: a concurrent RecordDepEvent may release
+  // the tracker's reference before the caller's enqueue consumes the list.
+  // Callers hand the list to ReleaseDepEvents once the enqueue returns.
+  auto add_event = [&](cl_event event) {
+    OPENCL_CALL(clRetainEvent(event));
+    wait_list->push_back(event);
+  };
+  auto add_last_write = [&](cl_mem mem) {
+    auto it = buffer_deps.find(mem);
+    if (it != buffer_deps.end() && it->second.last_write != nullptr) {
+      add_event(it->second.last_write);
+    }
+  };
+  for (cl_mem mem : reads) {
+    add_last_write(mem);
+  }
+  for (cl_mem mem : writes) {
+    add_last_write(mem);
+    auto it = buffer_deps.find(mem);
+    if (it != buffer_deps.end()) {
+      for (cl_event reader : it->second.reads_since_write) {
+        add_event(reader);
+      }
+    }
+  }
+}
+
+void OpenCLWorkspace::ReleaseDepEvents(const std::vector<cl_event>& wait_list) {
+  for (cl_event event : wait_list) {
+    OPENCL_CALL(clReleaseEvent(event));
+  }
+}
+
+void OpenCLWorkspace::RecordDepEvent(const std::vector<cl_mem>& reads,
+                                     const std::vector<cl_mem>& writes, cl_event event) {
+  std::lock_guard<std::mutex> lock(buffer_deps_mutex);
+  for (cl_mem mem : writes) {
+    BufferDeps& deps = buffer_deps[mem];
+    if (deps.last_write != nullptr) {
+      OPENCL_CALL(clReleaseEvent(deps.last_write));
+    }
+    for (cl_event reader : deps.reads_since_write) {
+      OPENCL_CALL(clReleaseEvent(reader));
+    }
+    deps.reads_since_write.clear();
+    OPENCL_CALL(clRetainEvent(event));
+    deps.last_write = event;
+  }
+  for (cl_mem mem : reads) {
+    BufferDeps& deps = buffer_deps[mem];
+    // Read-often buffers (weights) would otherwise accumulate readers until
+    // the next write that never comes; prune completed ones past a bound.
+    if (deps.reads_since_write.size() > 16) {
+      auto keep_end = std::remove_if(deps.reads_since_write.begin(), deps.reads_since_write.end(),
+                                     [](cl_event reader) {
+                                       if (EventCompleted(reader)) {
+                                         clReleaseEvent(reader);
+                                         return true;
+                                       }
+                                       return false;
+                                     });
+      deps.reads_since_write.erase(keep_end, deps.reads_since_write.end());
+    }
+    OPENCL_CALL(clRetainEvent(event));
+    deps.reads_since_write.push_back(event);
+  }
+}
+
+void OpenCLWorkspace::ReleaseDepState(cl_mem mem) {
+  std::lock_guard<std::mutex> lock(buffer_deps_mutex);
+  auto it = buffer_deps.find(mem);
+  if (it == buffer_deps.end()) return;
+  if (it->second.last_write != nullptr) {
+    OPENCL_CALL(clReleaseEvent(it->second.last_write));
+  }
+  for (cl_event reader : it->second.reads_since_write) {
+    OPENCL_CALL(clReleaseEvent(reader));
+  }
+  buffer_deps.erase(it);
+}
+
 void OpenCLWorkspace::FreeDataSpace(Device dev, void* ptr) {
   // We have to make sure that the memory object is not in the command queue
   // for some OpenCL platforms.
   OPENCL_CALL(clFinish(this->GetQueue(dev)));
 
   cl::BufferDescriptor* desc = static_cast<cl::BufferDescriptor*>(ptr);
+  if (event_deps_enabled) {
+    ReleaseDepState(desc->buffer);
+  }
   OPENCL_CALL(clReleaseMemObject(desc->buffer));
   delete desc;
 }
@@ -272,23 +372,55 @@ void OpenCLWorkspace::CopyDataFromTo(DLTensor* from, DLTensor* to, TVMStreamHand
     ICHECK(from_desc->layout == cl::BufferDescriptor::MemoryLayout::kBuffer1D)
         << "Device to device copying is currently only implemented for OpenCL buffer storage";
     auto* to_desc = static_cast<cl::BufferDescriptor*>(to->data);
-    OPENCL_CALL(clEnqueueCopyBuffer(this->GetQueue(to->device), from_desc->buffer, to_desc->buffer,
+    if (event_deps_enabled) {
+      std::vector<cl_event> wait_list;
+      CollectDepEvents({from_desc->buffer}, {to_desc->buffer}, &wait_list);
+      cl_event copy_event = nullptr;
+      OPENCL_CALL(clEnqueueCopyBuffer(this->GetQueue(to->device), from_desc->buffer,
+                                      to_desc->buffer, from->byte_offset, to->byte_offset, nbytes,
+                                      wait_list.size(), wait_list.empty() ? nullptr : wait_list.data(),
+                                      &copy_event));
+      RecordDepEvent({from_desc->buffer}, {to_desc->buffer}, copy_event);
+      OPENCL_CALL(clReleaseEvent(copy_event));
+      ReleaseDepEvents(wait_list);
+    } else {
+        OPENCL_CALL(clEnqueueCopyBuffer(this->GetQueue(to->device), from_desc->buffer, to_desc->buffer,
                                     from->byte_offset, to->byte_offset, nbytes, 0, nullptr,
                                     nullptr));
+    }
   } else if (IsOpenCLDevice(from->device) && to->device.device_type == kDLCPU) {
     const auto* from_desc = static_cast<const cl::BufferDescriptor*>(from->data);
     switch (from_desc->layout) {
-      case cl::BufferDescriptor::MemoryLayout::kBuffer1D:
+      case cl::BufferDescriptor::MemoryLayout::kBuffer1D: {
+        // Out-of-order queues need the explicit dependency; the clFinish
+        // below then completes everything, so no event is recorded.
+        std::vector<cl_event> wait_list;
+        if (event_deps_enabled) {
+          CollectDepEvents({from_desc->buffer}, {}, &wait_list);
+        }
         OPENCL_CALL(clEnqueueReadBuffer(
             this->GetQueue(from->device), from_desc->buffer, CL_FALSE, from->byte_offset, nbytes,
-            static_cast<char*>(to->data) + to->byte_offset, 0, nullptr, nullptr));
+            static_cast<char*>(to->data) + to->byte_offset, wait_list.size(),
+            wait_list.empty() ? nullptr : wait_list.data(), nullptr));
+        ReleaseDepEvents(wait_list);
         break;
+      }
       case cl::BufferDescriptor::MemoryLayout::kImage2DActivation:
       case cl::BufferDescriptor::MemoryLayout::kImage2DWeight:
         auto image_info = GetImageInfo(from_desc, from);
         // TODO(csullivan): Support calculating row_pitch correctly in the case of reuse.
         // Note that when utilizing texture pools for memory reuse, the allocated image
         // size can be larger than the size to be read.
+        {
+          std::vector<cl_event> image_wait;
+          if (event_deps_enabled) {
+            CollectDepEvents({from_desc->buffer}, {}, &image_wait);
+            if (!image_wait.empty()) {
+              OPENCL_CALL(clWaitForEvents(image_wait.size(), image_wait.data()));
+            }
+            ReleaseDepEvents(image_wait);
+          }
+        }
         OPENCL_CALL(clEnqueueReadImage(
             this->GetQueue(from->device), from_desc->buffer, CL_FALSE, image_info.origin,
             image_info.region, image_info.row_pitch, image_info.slice_pitch,
@@ -298,6 +430,39 @@ void OpenCLWorkspace::CopyDataFromTo(DLTensor* from, DLTensor* to, TVMStreamHand
     OPENCL_CALL(clFinish(this->GetQueue(from->device)));
   } else if (from->device.device_type == kDLCPU && IsOpenCLDevice(to->device)) {
     auto* to_desc = static_cast<cl::BufferDescriptor*>(to->data);
+    if (event_deps_enabled) {
+      // Staging pipeline: the upload runs on the dedicated transfer queue,
+      // ordered against users of the destination purely through events, so
+      // it proceeds while the compute queue's kernels execute instead of
+      // serializing behind them. The blocking write preserves the
+      // host-buffer contract of this API without fencing the compute queue.
+      std::vector<cl_event> wait_list;
+      CollectDepEvents({}, {to_desc->buffer}, &wait_list);
+      cl_event upload_event = nullptr;
+      cl_command_queue staging = this->GetTransferQueue(to->device);
+      switch (to_desc->layout) {
+        case cl::BufferDescriptor::MemoryLayout::kBuffer1D:
+          OPENCL_CALL(clEnqueueWriteBuffer(
+              staging, to_desc->buffer, CL_TRUE, to->byte_offset, nbytes,
+              static_cast<const char*>(from->data) + from->byte_offset, wait_list.size(),
+              wait_list.empty() ? nullptr : wait_list.data(), &upload_event));
+          break;
+        case cl::BufferDescriptor::MemoryLayout::kImage2DActivation:
+        case cl::BufferDescriptor::MemoryLayout::kImage2DWeight: {
+          auto image_info = GetImageInfo(to_desc, to);
+          OPENCL_CALL(clEnqueueWriteImage(
+              staging, to_desc->buffer, CL_TRUE, image_info.origin, image_info.region,
+              image_info.row_pitch, image_info.slice_pitch,
+              static_cast<const char*>(from->data) + from->byte_offset, wait_list.size(),
+              wait_list.empty() ? nullptr : wait_list.data(), &upload_event));
+          break;
+        }
+      }
+      RecordDepEvent({}, {to_desc->buffer}, upload_event);
+      OPENCL_CALL(clReleaseEvent(upload_event));
+      ReleaseDepEvents(wait_list);
+      return;
+    }
     switch (to_desc->layout) {
       case cl::BufferDescriptor::MemoryLayout::kBuffer1D:
         OPENCL_CALL(clEnqueueWriteBuffer(
@@ -426,13 +591,36 @@ void OpenCLWorkspace::Init(const std::string& type_key, const std::string& devic
   ICHECK_EQ(this->queues.size(), 0U);
   for (size_t i = 0; i < this->devices.size(); ++i) {
     cl_device_id did = this->devices[i];
+    cl_command_queue_properties properties = 0;
 #ifdef USE_PROFILER
-    this->queues.push_back(
-        clCreateCommandQueue(this->context, did, CL_QUEUE_PROFILING_ENABLE, &err_code));
-#else
-    this->queues.push_back(clCreateCommandQueue(this->context, did, 0, &err_code));
+    properties |= CL_QUEUE_PROFILING_ENABLE;
 #endif
+    // Event-graph mode (TVM_OPENCL_EVENT_DEPS=1): out-of-order queues with
+    // per-op event chaining derived from buffer access, so independent
+    // kernels overlap on devices with multiple compute queues.
+#ifndef USE_PROFILER
+    // The profiler launch path records its own events without chaining, so
+    // the mode stays off in profiler builds.
+    const char* event_deps = getenv("TVM_OPENCL_EVENT_DEPS");
+    if (event_deps && atoi(event_deps) != 0) {
+      this->event_deps_enabled = true;
+      properties |= CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE;
+    }
+#endif
+    this->queues.push_back(clCreateCommandQueue(this->context, did, properties, &err_code));
     OPENCL_CHECK_ERROR(err_code);
+    if (this->event_deps_enabled) {
+      // A dedicated transfer queue per device: host-to-device staging
+      // (notably the Adreno buffer-to-image uploads) runs there and only
+      // event dependencies order it against compute, so layer k+1's
+      // texture upload overlaps layer k's kernels instead of serializing
+      // inline on the compute queue.
+      this->transfer_queues.push_back(clCreateCommandQueue(this->context, did, properties,
+                                                           &err_code));
+      OPENCL_CHECK_ERROR(err_code);
+    } else {
+      this->transfer_queues.push_back(nullptr);
+    }
   }
   this->events.resize(this->devices.size());
   initialized_ = true;
@@ -63,10 +63,13 @@ class OpenCLWrappedFunc {
       kernel = m_->InstallKernel(w_, t, func_name_, entry_);
     }
     // setup arguments.
+    std::vector<cl_mem> touched_buffers;
     for (cl_uint i = 0; i < arg_size_.size(); ++i) {
       void* arg = nullptr;
       if (args.type_codes[i] == DLDataTypeCode::kDLOpaqueHandle) {
-        arg = static_cast<cl::BufferDescriptor*>(void_args[i])->buffer;
+        cl_mem mem = static_cast<cl::BufferDescriptor*>(void_args[i])->buffer;
+        touched_buffers.push_back(mem);
+        arg = mem;
       } else {
         arg = void_args[i];
       }
@@ -85,8 +88,24 @@ class OpenCLWrappedFunc {
                                        wl.work_size + 3, 0, nullptr,
                                        &(w_->GetEventQueue(t->device).back())));
 #else
-    OPENCL_CALL(clEnqueueNDRangeKernel(queue, kernel, work_dim, nullptr, wl.work_size,
-                                       wl.work_size + 3, 0, nullptr, nullptr));
+    if (w_->event_deps_enabled) {
+      // The kernel's read/write split is unknown, so every buffer argument is
+      // treated as read+write; kernels touching disjoint buffers still
+      // overlap, which is where branchy graphs idle today.
+      std::vector<cl_event> wait_list;
+      w_->CollectDepEvents(touched_buffers, touched_buffers, &wait_list);
+      cl_event kernel_event = nullptr;
+      OPENCL_CALL(clEnqueueNDRangeKernel(queue, kernel, work_dim, nullptr, wl.work_size,
+                                         wl.work_size + 3, wait_list.size(),
+                                         wait_list.empty() ? nullptr : wait_list.data(),
+                                         &kernel_event));
+      w_->RecordDepEvent({}, touched_buffers, kernel_event);
+      OPENCL_CALL(clReleaseEvent(kernel_event));
+      w_->ReleaseDepEvents(wait_list);
+    } else {
+      OPENCL_CALL(clEnqueueNDRangeKernel(queue, kernel, work_dim, nullptr, wl.work_size,
+                                         wl.work_size + 3, 0, nullptr, nullptr));
+    }
 #endif
   }
 
@@ -0,0 +1,166 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file paged_param_cache.cc
+ * \brief LRU device cache over host-resident parameter rows.
+ *
+ *  Embedding tables dwarf device memory but each request touches a sliver of
+ *  their rows. The cache keeps the table host-resident (combine with the
+ *  mmap parameter loader for zero-copy cold storage) and pages individual
+ *  rows onto the device on demand: Fetch ensures a batch of row ids is
+ *  device-resident, uploading only the misses, evicting least-recently-used
+ *  rows, and returning the cache slot of each requested row. The model's
+ *  gather then indexes the device cache through those slots, so serving
+ *  works at near-resident speed for any table larger than device memory.
+ */
+#include <tvm/runtime/device_api.h>
+#include <tvm/runtime/ndarray.h>
+#include <tvm/runtime/packed_func.h>
+#include <tvm/runtime/registry.h>
+
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace tvm {
+namespace runtime {
+
+/*! \brief LRU row cache of one host-resident 2-D parameter table. */
+class PagedParamCacheObj : public Object {
+ public:
+  /*! \brief The host-resident table, shape (num_rows, row_elems). */
+  NDArray host_table;
+  /*! \brief The device-resident cache, shape (capacity, row_elems). */
+  NDArray device_cache;
+
+  void Init(NDArray table, Device device, int64_t capacity_rows) {
+    const DLTensor* tensor = table.operator->();
+    CHECK_EQ(tensor->ndim, 2) << "Paged parameters expect a 2-D (rows, elems) table";
+    CHECK_EQ(tensor->device.device_type, kDLCPU) << "The table must be host-resident";
+    CHECK(IsContiguous(*tensor)) << "The table must be compact";
+    CHECK_GT(capacity_rows, 0);
+    host_table = table;
+    num_rows_ = tensor->shape[0];
+    row_elems_ = tensor->shape[1];
+    row_bytes_ = row_elems_ * ((tensor->dtype.bits * tensor->dtype.lanes + 7) / 8);
+    capacity_ = std::min(capacity_rows, num_rows_);
+    device_cache = NDArray::Empty({capacity_, row_elems_}, tensor->dtype, device);
+  }
+
+  /*!
+   * \brief Ensure every requested row is device-resident and return slots.
+   * \param row_ids Host int64 tensor of row ids, any shape.
+   * \return Host int64 tensor of the same size: the cache slot per row.
+   */
+  NDArray Fetch(NDArray row_ids) {
+    const DLTensor* ids = row_ids.operator->();
+    CHECK_EQ(ids->device.device_type, kDLCPU) << "Row ids must be host-resident";
+    CHECK(ids->dtype.code == kDLInt && ids->dtype.bits == 64) << "Row ids must be int64";
+    int64_t count = 1;
+    for (int i = 0; i < ids->ndim; ++i) count *= ids->shape[i];
+    const int64_t* id_data =
+        reinterpret_cast<const int64_t*>(static_cast<const char*>(ids->data) + ids->byte_offset);
+
+    NDArray slots = NDArray::Empty({count}, {kDLInt, 64, 1}, {kDLCPU, 0});
+    int64_t* slot_data = static_cast<int64_t*>(slots->data);
+    for (int64_t i = 0; i < count; ++i) {
+      slot_data[i] = EnsureResident(id_data[i]);
+    }
+    return slots;
+  }
+
+  static constexpr const uint32_t _type_index = TypeIndex::kDynamic;
+  static constexpr const char* _type_key = "runtime.PagedParamCache";
+  TVM_DECLARE_FINAL_OBJECT_INFO(PagedParamCacheObj, Object);
+
+ private:
+  /*! \brief Upload the row if absent; returns its cache slot. */
+  int64_t EnsureResident(int64_t row) {
+    CHECK_GE(row, 0);
+    CHECK_LT(row, num_rows_);
+    auto it = resident_.find(row);
+    if (it != resident_.end()) {
+      // Refresh LRU position.
+      lru_.splice(lru_.end(), lru_, it->second.lru_it);
+      return it->second.slot;
+    }
+    int64_t slot;
+    if (static_cast<int64_t>(resident_.size()) < capacity_) {
+      slot = static_cast<int64_t>(resident_.size());
+    } else {
+      // Evict the least recently used row.
+      int64_t victim = lru_.front();
+      lru_.pop_front();
+      auto victim_it = resident_.find(victim);
+      slot = victim_it->second.slot;
+      resident_.erase(victim_it);
+    }
+    CopyRow(row, slot);
+    lru_.push_back(row);
+    resident_[row] = Entry{slot, std::prev(lru_.end())};
+    return slot;
+  }
+
+  void CopyRow(int64_t row, int64_t slot) {
+    const DLTensor* src = host_table.operator->();
+    const DLTensor* dst = device_cache.operator->();
+    DeviceAPI::Get(dst->device)
+        ->CopyDataFromTo(src->data, src->byte_offset + row * row_bytes_, dst->data,
+                         dst->byte_offset + slot * row_bytes_, row_bytes_, src->device, dst->device,
+                         src->dtype, nullptr);
+  }
+
+  struct Entry {
+    int64_t slot;
+    std::list<int64_t>::iterator lru_it;
+  };
+  int64_t num_rows_{0};
+  int64_t row_elems_{0};
+  int64_t row_bytes_{0};
+  int64_t capacity_{0};
+  std::unordered_map<int64_t, Entry> resident_;
+  /*! \brief Row ids from least to most recently used. */
+  std::list<int64_t> lru_;
+};
+
+TVM_REGISTER_OBJECT_TYPE(PagedParamCacheObj);
+
+class PagedParamCache : public ObjectRef {
+ public:
+  TVM_DEFINE_MUTABLE_OBJECT_REF_METHODS(PagedParamCache, ObjectRef, PagedParamCacheObj);
+};
+
+TVM_REGISTER_GLOBAL("runtime.PagedParamCacheCreate")
+    .set_body_typed([](NDArray table, int device_type, int device_id, int64_t capacity_rows) {
+      auto cache = make_object<PagedParamCacheObj>();
+      cache->Init(table, Device{static_cast<DLDeviceType>(device_type), device_id}, capacity_rows);
+      return PagedParamCache(cache);
+    });
+
+TVM_REGISTER_GLOBAL("runtime.PagedParamCacheFetch")
+    .set_body_typed([](PagedParamCache cache, NDArray row_ids) { return cache->Fetch(row_ids); });
+
+TVM_REGISTER_GLOBAL("runtime.PagedParamCacheTable").set_body_typed([](PagedParamCache cache) {
+  return cache->device_cache;
+});
+
+}  // namespace runtime
+}  // namespace tvm
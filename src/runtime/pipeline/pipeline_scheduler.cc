@@ -18,6 +18,9 @@
  */
 #include "pipeline_scheduler.h"
 
+#include <algorithm>
+#include <deque>
+
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -101,21 +104,211 @@ void PipelineScheduler::PipelineRunSequential(
 void PipelineScheduler::PipelineRun(const std::vector<std::shared_ptr<BackendRuntime>>& runtimes,
                                     ConfigPipelineExecution pipeline_config, bool sequential_mode) {
   if (!sequential_mode) {
-    // TODO(huajsj) remove this check after all of pipeline features in.
-    LOG(FATAL) << "Currently only supports sequential mode.";
+    PipelineRunParallel(runtimes, pipeline_config);
   } else {
     PipelineRunSequential(runtimes, pipeline_config);
   }
 }
+/*!
+ * \brief Launch one worker thread per stage the first time the parallel mode
+ * runs; the threads stay up until PipelineStop.
+ * \param runtimes A list of backend runtime modules.
+ * \param pipeline_config The dependent configuration of each runtime module.
+ */
+void PipelineScheduler::EnsureParallelWorkers(
+    const std::vector<std::shared_ptr<BackendRuntime>>& runtimes,
+    const ConfigPipelineExecution& pipeline_config) {
+  if (!stage_threads_.empty()) return;
+  parallel_runtimes_ = runtimes;
+  parallel_config_ = pipeline_config;
+  stage_ctx_.clear();
+  stage_inputs_.assign(runtimes.size(), {});
+  for (size_t i = 0; i < runtimes.size(); i++) {
+    stage_ctx_.emplace_back(std::make_unique<StageContext>());
+  }
+  // Count, per stage, the input connections feeding it (a full frame of
+  // staged inputs advances its produced counter) and the stages owning
+  // global outputs (a frame retires after one write from each).
+  num_global_stages_ = 0;
+  for (size_t i = 0; i < runtimes.size(); i++) {
+    bool has_global = false;
+    int outputs_num = runtimes[i]->NumOutputs();
+    for (int j = 0; j < outputs_num; j++) {
+      ConfigBindings& out_binding = parallel_config_[i][j];
+      for (auto bind : out_binding.Get()) {
+        if (bind.first >= 0) {
+          stage_ctx_[bind.first]->expected_inputs++;
+        }
+      }
+      has_global = has_global || out_binding.IsGlobalOutput();
+    }
+    if (has_global) num_global_stages_++;
+  }
+  for (size_t i = 0; i < runtimes.size(); i++) {
+    stage_threads_.emplace_back([this, i]() { this->ParallelLoop(i); });
+  }
+}
+/*!
+ * \brief The worker loop of one pipeline stage: wait for a staged frame,
+ * copy the staged inputs into the executor (which frees the staging slot for
+ * the producer), run, then forward the outputs into the consumers' staging.
+ * \param stage_index The index of the stage this worker drives.
+ */
+void PipelineScheduler::ParallelLoop(size_t stage_index) {
+  StageContext* ctx = stage_ctx_[stage_index].get();
+  BackendRuntime* runtime = parallel_runtimes_[stage_index].get();
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(ctx->mu);
+      ctx->cv.wait(lock, [ctx]() { return ctx->exit || ctx->produced > ctx->consumed; });
+      if (ctx->exit) return;
+    }
+    // Move the staged inputs into the executor and release the staging slot.
+    size_t slot = ctx->consumed % 2;
+    {
+      std::lock_guard<std::mutex> lock(stage_inputs_mu_);
+      for (StagedInput& staged : stage_inputs_[stage_index]) {
+        if (!staged.buffers[slot].defined()) continue;
+        runtime->SetInput(staged.input_name,
+                          const_cast<DLTensor*>(staged.buffers[slot].operator->()));
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(ctx->mu);
+      ctx->consumed++;
+    }
+    ctx->cv.notify_all();
+
+    runtime->Run();
+
+    // Forward every output into its consumers' staging buffers, or into the
+    // global output arrays.
+    int outputs_num = runtime->NumOutputs();
+    bool has_global_output = false;
+    for (int j = 0; j < outputs_num; j++) {
+      ConfigBindings& out_binding = parallel_config_[stage_index][j];
+      std::unordered_map<int, std::string>& input_connections = out_binding.Get();
+      NDArray output = runtime->GetOutput(j);
+      for (auto bind : input_connections) {
+        if (bind.first < 0) continue;
+        StageContext* consumer = stage_ctx_[bind.first].get();
+        // Wait for a free staging slot: at most two frames may be in flight
+        // between a producer and a consumer (the essence of double buffering).
+        size_t consumer_slot;
+        {
+          std::unique_lock<std::mutex> lock(consumer->mu);
+          consumer->cv.wait(lock, [consumer]() {
+            return consumer->exit || consumer->produced - consumer->consumed < 2;
+          });
+          if (consumer->exit) return;
+          consumer_slot = consumer->produced % 2;
+        }
+        // Lazily create the double buffers on the producer's device; the
+        // consumer's SetInput handles any cross-device hop. The staging lists
+        // are deques, so the reference stays valid across later appends.
+        NDArray* buffers = nullptr;
+        {
+          std::lock_guard<std::mutex> lock(stage_inputs_mu_);
+          std::deque<StagedInput>& staged_inputs = stage_inputs_[bind.first];
+          auto it = std::find_if(
+              staged_inputs.begin(), staged_inputs.end(),
+              [&bind](const StagedInput& entry) { return entry.input_name == bind.second; });
+          if (it == staged_inputs.end()) {
+            staged_inputs.emplace_back();
+            staged_inputs.back().input_name = bind.second;
+            it = staged_inputs.end() - 1;
+          }
+          buffers = it->buffers;
+        }
+        if (!buffers[consumer_slot].defined()) {
+          buffers[consumer_slot] =
+              NDArray::Empty(output.Shape(), output.DataType(), output->device);
+        }
+        buffers[consumer_slot].CopyFrom(output);
+        // A full frame of staged inputs makes the next frame visible to the
+        // consumer.
+        {
+          std::lock_guard<std::mutex> lock(consumer->mu);
+          consumer->staged_writes++;
+          if (consumer->staged_writes % consumer->expected_inputs == 0) {
+            consumer->produced++;
+          }
+        }
+        consumer->cv.notify_all();
+      }
+      if (out_binding.IsGlobalOutput()) {
+        has_global_output = true;
+        int global_idx = out_binding.GetGlobalOutputIndex();
+        TVMArrayCopyFromTo(const_cast<DLTensor*>(output.operator->()),
+                           const_cast<DLTensor*>(output_arrays_[global_idx].operator->()), nullptr);
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(ctx->mu);
+      ctx->finished++;
+    }
+    // Wake a frame admitter waiting on stage 0's completion (stage 0 reads
+    // its inputs directly from the executor's tensors).
+    ctx->cv.notify_all();
+    if (has_global_output) {
+      std::lock_guard<std::mutex> lock(done_mu_);
+      global_writes_++;
+      done_cv_.notify_all();
+    }
+  }
+}
+/*!
+ * \brief Running the pipeline in the threaded parallel mode.
+ * \param runtimes A list of backend runtime modules.
+ * \param pipeline_config The dependent configuration of each runtime module.
+ */
+void PipelineScheduler::PipelineRunParallel(
+    const std::vector<std::shared_ptr<BackendRuntime>>& runtimes,
+    ConfigPipelineExecution pipeline_config) {
+  EnsureParallelWorkers(runtimes, pipeline_config);
+  StageContext* first = stage_ctx_[0].get();
+  {
+    // Stage 0 reads its inputs straight from its executor (set_input writes
+    // them there), so admission of the next frame waits until the previous
+    // stage-0 run finished; the downstream stages still overlap with it.
+    std::unique_lock<std::mutex> lock(first->mu);
+    first->cv.wait(lock, [first]() { return first->finished == first->produced; });
+    first->produced++;
+  }
+  {
+    std::lock_guard<std::mutex> lock(done_mu_);
+    frames_in_++;
+  }
+  first->cv.notify_all();
+}
 /*!
  * \brief Stop the pipeline exection.
  */
 void PipelineScheduler::PipelineStop() {
-  // TODO(huajsj) Add stop logic.
+  for (auto& ctx : stage_ctx_) {
+    std::lock_guard<std::mutex> lock(ctx->mu);
+    ctx->exit = true;
+  }
+  for (auto& ctx : stage_ctx_) {
+    ctx->cv.notify_all();
+  }
+  for (std::thread& worker : stage_threads_) {
+    if (worker.joinable()) worker.join();
+  }
+  stage_threads_.clear();
+  stage_ctx_.clear();
+  parallel_runtimes_.clear();
 }
 /*!
  * \brief Get a list of output.
  */
-Array<NDArray> PipelineScheduler::PipelineGetOutput() { return output_arrays_; }
+Array<NDArray> PipelineScheduler::PipelineGetOutput() {
+  // In the parallel mode outputs only settle once every admitted frame has
+  // retired; drain before handing the arrays back.
+  std::unique_lock<std::mutex> lock(done_mu_);
+  done_cv_.wait(lock,
+                [this]() { return global_writes_ >= frames_in_ * num_global_stages_; });
+  return output_arrays_;
+}
 }  // namespace runtime
 }  // namespace tvm
@@ -27,6 +27,15 @@
 #include <string>
 #include <vector>
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "pipeline_struct.h"
 namespace tvm {
 namespace runtime {
@@ -58,6 +67,16 @@ class PipelineScheduler {
    */
   void PipelineRunSequential(const std::vector<std::shared_ptr<BackendRuntime>>& runtimes,
                              ConfigPipelineExecution pipeline_config);
+  /*!
+   * \brief Running the pipeline in the threaded parallel mode: every stage
+   * executes on its own worker thread and hands tensors to its consumers
+   * through double-buffered staging, so stage k+1 consumes one buffer while
+   * stage k produces the other.
+   * \param runtimes A list of backend runtime modules.
+   * \param pipeline_config The dependent configuration of each runtime module.
+   */
+  void PipelineRunParallel(const std::vector<std::shared_ptr<BackendRuntime>>& runtimes,
+                           ConfigPipelineExecution pipeline_config);
   /*!
    * \brief Stop the pipeline exection.
    */
@@ -67,7 +86,58 @@ class PipelineScheduler {
    */
   Array<NDArray> PipelineGetOutput();
 
+  ~PipelineScheduler() { PipelineStop(); }
+
  private:
+  /*!\brief Per-stage synchronization state for the parallel mode.*/
+  struct StageContext {
+    std::mutex mu;
+    std::condition_variable cv;
+    /*!\brief Frames staged and not yet consumed by this stage.*/
+    uint64_t produced = 0;
+    /*!\brief Frames this stage has consumed (copied out of staging).*/
+    uint64_t consumed = 0;
+    /*!\brief Frames this stage has fully executed and forwarded.*/
+    uint64_t finished = 0;
+    /*!\brief Staged input writes received; produced advances every
+     * expected_inputs writes (one full frame of inputs).*/
+    uint64_t staged_writes = 0;
+    /*!\brief Input connections feeding this stage (0 for the first stage).*/
+    uint64_t expected_inputs = 0;
+    bool exit = false;
+  };
+  /*!\brief Double-buffered input staging of one stage, keyed by input name.*/
+  struct StagedInput {
+    std::string input_name;
+    NDArray buffers[2];
+  };
+  /*!\brief The worker loop of one pipeline stage.*/
+  void ParallelLoop(size_t stage_index);
+  /*!\brief Launch the stage worker threads on first parallel run.*/
+  void EnsureParallelWorkers(const std::vector<std::shared_ptr<BackendRuntime>>& runtimes,
+                             const ConfigPipelineExecution& pipeline_config);
+  /*!\brief Stage synchronization states, one per runtime.*/
+  std::vector<std::unique_ptr<StageContext>> stage_ctx_;
+  /*!\brief Double-buffered staging areas, one list per runtime. A deque so
+   * references stay valid while producers append lazily.*/
+  std::vector<std::deque<StagedInput>> stage_inputs_;
+  /*!\brief Guards lazily created staging buffers.*/
+  std::mutex stage_inputs_mu_;
+  /*!\brief The stage worker threads.*/
+  std::vector<std::thread> stage_threads_;
+  /*!\brief The runtimes captured for the worker threads.*/
+  std::vector<std::shared_ptr<BackendRuntime>> parallel_runtimes_;
+  /*!\brief The bindings captured for the worker threads.*/
+  ConfigPipelineExecution parallel_config_;
+  /*!\brief Completion tracking: frames admitted and frames fully retired.*/
+  std::mutex done_mu_;
+  std::condition_variable done_cv_;
+  uint64_t frames_in_ = 0;
+  /*!\brief Global-output writes retired; a frame is done after one write per
+   * global-output-owning stage.*/
+  uint64_t global_writes_ = 0;
+  /*!\brief Number of stages owning at least one global output.*/
+  uint64_t num_global_stages_ = 0;
   /*!\brief The list of graph executors.*/
   std::vector<Module> graph_modules_;
   /*!\brief A list of NDArray used to storage outputs.*/
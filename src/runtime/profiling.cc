@@ -32,10 +32,14 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 #include <map>
 #include <numeric>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace tvm {
 namespace runtime {
@@ -68,6 +72,79 @@ TVM_REGISTER_OBJECT_TYPE(TimerNode);
 
 Timer DefaultTimer(Device dev) { return Timer(make_object<DefaultTimerNode>(dev)); }
 
+#if defined(__x86_64__) || defined(__aarch64__)
+
+namespace {
+
+/*! \brief Read the invariant hardware counter. */
+inline uint64_t ReadCycleCounter() {
+#if defined(__x86_64__)
+  unsigned lo, hi;
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+  return (static_cast<uint64_t>(hi) << 32) | lo;
+#else
+  uint64_t cnt;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(cnt));
+  return cnt;
+#endif
+}
+
+/*! \brief Nanoseconds per counter tick, calibrated once against the steady
+ * clock (a ~10 ms spin paid only on the first timer use). */
+double NanosPerTick() {
+  static const double ns_per_tick = []() {
+    auto wall_begin = std::chrono::steady_clock::now();
+    uint64_t tick_begin = ReadCycleCounter();
+    while (std::chrono::steady_clock::now() - wall_begin < std::chrono::milliseconds(10)) {
+    }
+    uint64_t tick_end = ReadCycleCounter();
+    auto wall_end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration_cast<std::chrono::nanoseconds>(wall_end - wall_begin).count();
+    return ns / static_cast<double>(tick_end - tick_begin);
+  }();
+  return ns_per_tick;
+}
+
+}  // namespace
+
+/*!
+ * \brief Cycle-counter timer: Start/Stop are single register reads, so
+ * per-op profiling of sub-100us ops stops paying the clock_gettime pair.
+ * Opt-in via TVM_USE_HW_TIMER=1 since it relies on an invariant, socket-
+ * synchronized counter (standard on the hardware of the last decade).
+ */
+class HardwareCounterTimerNode : public TimerNode {
+ public:
+  virtual void Start() { start_ = ReadCycleCounter(); }
+  virtual void Stop() { stop_ = ReadCycleCounter(); }
+  virtual int64_t SyncAndGetElapsedNanos() {
+    return static_cast<int64_t>((stop_ - start_) * NanosPerTick());
+  }
+  virtual ~HardwareCounterTimerNode() {}
+
+  static constexpr const char* _type_key = "HardwareCounterTimerNode";
+  TVM_DECLARE_FINAL_OBJECT_INFO(HardwareCounterTimerNode, TimerNode);
+
+ private:
+  uint64_t start_{0};
+  uint64_t stop_{0};
+};
+
+TVM_REGISTER_OBJECT_TYPE(HardwareCounterTimerNode);
+
+TVM_REGISTER_GLOBAL("profiling.timer.cpu").set_body_typed([](Device dev) {
+  static const bool use_hw_timer = []() {
+    const char* val = getenv("TVM_USE_HW_TIMER");
+    return val && atoi(val) != 0;
+  }();
+  if (use_hw_timer) {
+    return Timer(make_object<HardwareCounterTimerNode>());
+  }
+  return Timer(make_object<DefaultTimerNode>(dev));
+});
+
+#endif  // defined(__x86_64__) || defined(__aarch64__)
+
 class CPUTimerNode : public TimerNode {
  public:
   virtual void Start() { start_ = std::chrono::high_resolution_clock::now(); }
@@ -545,6 +622,58 @@ std::string DeviceString(Device dev) {
   return DeviceName(dev.device_type) + std::to_string(dev.device_id);
 }
 
+void EventRecorder::Record(String name, Device dev, Timer timer) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (ring_.size() < capacity_) {
+    ring_.push_back(Event{std::move(name), dev, std::move(timer)});
+  } else {
+    ring_[next_] = Event{std::move(name), dev, std::move(timer)};
+    next_ = (next_ + 1) % capacity_;
+  }
+}
+
+Report EventRecorder::GetReport() {
+  std::vector<Event> events;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events.swap(ring_);
+    next_ = 0;
+  }
+  // Aggregate per (name, device); the sync happens here, far from the
+  // recorded ops, so recording itself never serialized the device.
+  struct Agg {
+    double total_us = 0;
+    int64_t count = 0;
+    Device dev;
+  };
+  std::unordered_map<std::string, Agg> aggs;
+  for (Event& event : events) {
+    Agg& agg = aggs[event.name.operator std::string()];
+    agg.total_us += event.timer->SyncAndGetElapsedNanos() / 1e3;
+    agg.count += 1;
+    agg.dev = event.dev;
+  }
+  std::vector<Map<String, ObjectRef>> rows;
+  for (const auto& kv : aggs) {
+    Map<String, ObjectRef> row;
+    row.Set("Name", String(kv.first));
+    row.Set("Device", String(DeviceString(kv.second.dev)));
+    row.Set("Duration (us)", ObjectRef(make_object<DurationNode>(kv.second.total_us)));
+    row.Set("Count", ObjectRef(make_object<CountNode>(kv.second.count)));
+    rows.push_back(row);
+  }
+  return profiling::Report(rows, {});
+}
+
+EventRecorder* EventRecorder::Global() {
+  static EventRecorder* inst = new EventRecorder();
+  return inst;
+}
+
+TVM_REGISTER_GLOBAL("runtime.profiling.GetSampledReport").set_body_typed([]() {
+  return EventRecorder::Global()->GetReport();
+});
+
 Report Profiler::Report(bool aggregate, bool sort) {
   // sync all timers and normalize rows
   std::vector<std::unordered_map<String, ObjectRef>> rows;
@@ -668,6 +797,98 @@ TVM_REGISTER_OBJECT_TYPE(ReportNode);
 TVM_REGISTER_OBJECT_TYPE(DeviceWrapperNode);
 TVM_REGISTER_OBJECT_TYPE(MetricCollectorNode);
 
+namespace {
+
+/*! \brief Per-op duration samples pulled out of a report's call rows. */
+struct OpSamples {
+  std::vector<double> durations_us;
+
+  double Mean() const {
+    double sum = 0;
+    for (double d : durations_us) sum += d;
+    return durations_us.empty() ? 0.0 : sum / durations_us.size();
+  }
+
+  double Variance(double mean) const {
+    if (durations_us.size() < 2) return 0.0;
+    double acc = 0;
+    for (double d : durations_us) acc += (d - mean) * (d - mean);
+    return acc / (durations_us.size() - 1);
+  }
+};
+
+std::unordered_map<std::string, OpSamples> CollectSamples(const Report& report) {
+  std::unordered_map<std::string, OpSamples> samples;
+  for (const auto& row : report->calls) {
+    auto name_it = row.find("Name");
+    auto dur_it = row.find("Duration (us)");
+    if (name_it == row.end() || dur_it == row.end()) continue;
+    const auto* name = (*name_it).second.as<StringObj>();
+    const auto* dur = (*dur_it).second.as<DurationNode>();
+    if (name == nullptr || dur == nullptr) continue;
+    samples[std::string(name->data, name->size)].durations_us.push_back(dur->microseconds);
+  }
+  return samples;
+}
+
+}  // namespace
+
+/*!
+ * \brief Compare two reports per op: mean deltas, Welch significance, and a
+ *  regression flag against a relative threshold. Machine-readable so perf
+ *  CI stops diffing rendered tables.
+ */
+Map<String, Map<String, ObjectRef>> CompareReports(Report base, Report updated,
+                                                   double regression_threshold) {
+  auto base_samples = CollectSamples(base);
+  auto new_samples = CollectSamples(updated);
+  Map<String, Map<String, ObjectRef>> result;
+  for (const auto& kv : new_samples) {
+    auto base_it = base_samples.find(kv.first);
+    Map<String, ObjectRef> row;
+    double new_mean = kv.second.Mean();
+    row.Set("new_mean_us", ObjectRef(make_object<DurationNode>(new_mean)));
+    row.Set("new_count", ObjectRef(make_object<CountNode>(kv.second.durations_us.size())));
+    if (base_it == base_samples.end()) {
+      row.Set("status", String("added"));
+      result.Set(kv.first, row);
+      continue;
+    }
+    const OpSamples& b = base_it->second;
+    double base_mean = b.Mean();
+    row.Set("base_mean_us", ObjectRef(make_object<DurationNode>(base_mean)));
+    row.Set("base_count", ObjectRef(make_object<CountNode>(b.durations_us.size())));
+    double delta_pct = base_mean > 0 ? (new_mean - base_mean) / base_mean * 100.0 : 0.0;
+    row.Set("delta_percent", ObjectRef(make_object<PercentNode>(delta_pct)));
+    // Welch's t over the per-call samples; |t| > 2 as the usual ~95% bar.
+    double var_term = b.Variance(base_mean) / std::max<size_t>(b.durations_us.size(), 1) +
+                      kv.second.Variance(new_mean) / std::max<size_t>(kv.second.durations_us.size(), 1);
+    bool significant = false;
+    if (var_term > 0) {
+      double t = (new_mean - base_mean) / std::sqrt(var_term);
+      significant = std::fabs(t) > 2.0;
+    } else {
+      significant = new_mean != base_mean;
+    }
+    bool regressed = significant && delta_pct > regression_threshold * 100.0;
+    row.Set("significant", ObjectRef(make_object<CountNode>(significant ? 1 : 0)));
+    row.Set("regressed", ObjectRef(make_object<CountNode>(regressed ? 1 : 0)));
+    row.Set("status", String(regressed ? "regressed" : "ok"));
+    result.Set(kv.first, row);
+  }
+  for (const auto& kv : base_samples) {
+    if (new_samples.count(kv.first) == 0) {
+      Map<String, ObjectRef> row;
+      row.Set("base_mean_us", ObjectRef(make_object<DurationNode>(kv.second.Mean())));
+      row.Set("status", String("removed"));
+      result.Set(kv.first, row);
+    }
+  }
+  return result;
+}
+
+TVM_REGISTER_GLOBAL("runtime.profiling.CompareReports").set_body_typed(CompareReports);
+
 TVM_REGISTER_GLOBAL("runtime.profiling.AsTable").set_body_method<Report>(&ReportNode::AsTable);
 TVM_REGISTER_GLOBAL("runtime.profiling.AsCSV").set_body_typed([](Report n) { return n->AsCSV(); });
 TVM_REGISTER_GLOBAL("runtime.profiling.AsJSON").set_body_typed([](Report n) {
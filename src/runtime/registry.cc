@@ -27,6 +27,7 @@
 #include <tvm/runtime/registry.h>
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -37,17 +38,25 @@ namespace tvm {
 namespace runtime {
 
 struct Registry::Manager {
+  using FMap = std::unordered_map<std::string, Registry*>;
   // map storing the functions.
   // We deliberately used raw pointer.
   // This is because PackedFunc can contain callbacks into the host language (Python) and the
   // resource can become invalid because of indeterministic order of destruction and forking.
   // The resources will only be recycled during program exit.
-  std::unordered_map<std::string, Registry*> fmap;
-  // mutex
+  FMap fmap;
+  // Read-only snapshot of fmap, republished after every mutation. Lookups
+  // atomically load the snapshot instead of taking the mutex, so steady-state
+  // Get() calls on serving paths do not contend with each other.
+  std::shared_ptr<const FMap> snapshot = std::make_shared<const FMap>();
+  // mutex, serializes mutations only
   std::mutex mutex;
 
   Manager() {}
 
+  // Publish the current fmap for lock-free readers; caller holds mutex.
+  void PublishSnapshot() { std::atomic_store(&snapshot, std::make_shared<const FMap>(fmap)); }
+
   static Manager* Global() {
     // We deliberately leak the Manager instance, to avoid leak sanitizers
     // complaining about the entries in Manager::fmap being leaked at program
@@ -72,6 +81,7 @@ Registry& Registry::Register(const std::string& name, bool can_override) {  // N
   Registry* r = new Registry();
   r->name_ = name;
   m->fmap[name] = r;
+  m->PublishSnapshot();
   return *r;
 }
 
@@ -81,23 +91,26 @@ bool Registry::Remove(const std::string& name) {
   auto it = m->fmap.find(name);
   if (it == m->fmap.end()) return false;
   m->fmap.erase(it);
+  m->PublishSnapshot();
   return true;
 }
 
 const PackedFunc* Registry::Get(const std::string& name) {
   Manager* m = Manager::Global();
-  std::lock_guard<std::mutex> lock(m->mutex);
-  auto it = m->fmap.find(name);
-  if (it == m->fmap.end()) return nullptr;
+  std::shared_ptr<const Manager::FMap> snapshot = std::atomic_load(&m->snapshot);
+  auto it = snapshot->find(name);
+  if (it == snapshot->end()) return nullptr;
+  // The Registry entries themselves are never freed, so the returned pointer
+  // stays valid even after the snapshot is republished.
   return &(it->second->func_);
 }
 
 std::vector<std::string> Registry::ListNames() {
   Manager* m = Manager::Global();
-  std::lock_guard<std::mutex> lock(m->mutex);
+  std::shared_ptr<const Manager::FMap> snapshot = std::atomic_load(&m->snapshot);
   std::vector<std::string> keys;
-  keys.reserve(m->fmap.size());
-  for (const auto& kv : m->fmap) {
+  keys.reserve(snapshot->size());
+  for (const auto& kv : *snapshot) {
     keys.push_back(kv.first);
   }
   return keys;
@@ -22,11 +22,100 @@
  */
 #include "rpc_channel.h"
 
+#include <cstring>
+#include <limits>
 #include <string>
 
+#include "../../support/compression.h"
+
 namespace tvm {
 namespace runtime {
 
+void RPCChannel::SendAll(const void* data, size_t size) {
+  const char* buf = static_cast<const char*>(data);
+  size_t nsent = 0;
+  while (nsent < size) {
+    size_t n = Send(buf + nsent, size - nsent);
+    ICHECK_NE(n, 0) << "Channel closes before we sent all the data";
+    nsent += n;
+  }
+}
+
+namespace {
+
+void EncodeU32(char* buf, uint32_t value) {
+  buf[0] = static_cast<char>(value & 0xFF);
+  buf[1] = static_cast<char>((value >> 8) & 0xFF);
+  buf[2] = static_cast<char>((value >> 16) & 0xFF);
+  buf[3] = static_cast<char>((value >> 24) & 0xFF);
+}
+
+uint32_t DecodeU32(const char* buf) {
+  return static_cast<uint32_t>(static_cast<unsigned char>(buf[0])) |
+         (static_cast<uint32_t>(static_cast<unsigned char>(buf[1])) << 8) |
+         (static_cast<uint32_t>(static_cast<unsigned char>(buf[2])) << 16) |
+         (static_cast<uint32_t>(static_cast<unsigned char>(buf[3])) << 24);
+}
+
+}  // namespace
+
+size_t CompressedChannel::Send(const void* data, size_t size) {
+  // Never emit an empty frame: a zero-length Recv result means channel close.
+  if (size == 0) return 0;
+  ICHECK_LE(size, std::numeric_limits<uint32_t>::max()) << "Compressed frame too large";
+  std::string compressed = support::CompressBytes(static_cast<const char*>(data), size);
+  // A payload size equal to the raw size marks a stored (uncompressed) frame.
+  const bool stored = compressed.size() >= size;
+  const char* payload = stored ? static_cast<const char*>(data) : compressed.data();
+  size_t payload_size = stored ? size : compressed.size();
+  char header[8];
+  EncodeU32(header, static_cast<uint32_t>(size));
+  EncodeU32(header + 4, static_cast<uint32_t>(payload_size));
+  inner_->SendAll(header, sizeof(header));
+  inner_->SendAll(payload, payload_size);
+  return size;
+}
+
+size_t CompressedChannel::Recv(void* data, size_t size) {
+  while (recv_pos_ == recv_buf_.size()) {
+    char header[8];
+    if (!RecvAllInner(header, sizeof(header), /*allow_clean_close=*/true)) {
+      return 0;
+    }
+    size_t raw_size = DecodeU32(header);
+    size_t payload_size = DecodeU32(header + 4);
+    std::string payload(payload_size, '\0');
+    if (payload_size != 0) {
+      RecvAllInner(&payload[0], payload_size, /*allow_clean_close=*/false);
+    }
+    if (payload_size == raw_size) {
+      recv_buf_ = std::move(payload);
+    } else {
+      ICHECK(support::DecompressBytes(payload.data(), payload.size(), raw_size, &recv_buf_))
+          << "Corrupted compressed RPC frame";
+    }
+    recv_pos_ = 0;
+  }
+  size_t n = std::min(size, recv_buf_.size() - recv_pos_);
+  std::memcpy(data, recv_buf_.data() + recv_pos_, n);
+  recv_pos_ += n;
+  return n;
+}
+
+bool CompressedChannel::RecvAllInner(void* data, size_t size, bool allow_clean_close) {
+  char* buf = static_cast<char*>(data);
+  size_t nrecv = 0;
+  while (nrecv < size) {
+    size_t n = inner_->Recv(buf + nrecv, size - nrecv);
+    if (n == 0) {
+      ICHECK(allow_clean_close && nrecv == 0) << "Channel closes inside a compressed frame";
+      return false;
+    }
+    nrecv += n;
+  }
+  return true;
+}
+
 size_t CallbackChannel::Send(const void* data, size_t size) {
   TVMByteArray bytes;
   bytes.data = static_cast<const char*>(data);
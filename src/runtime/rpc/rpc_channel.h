@@ -26,6 +26,8 @@
 
 #include <tvm/runtime/packed_func.h>
 
+#include <memory>
+#include <string>
 #include <utility>
 
 namespace tvm {
@@ -53,6 +55,15 @@ class RPCChannel {
    * \return The actual bytes received.
    */
   virtual size_t Recv(void* data, size_t size) = 0;
+  /*!
+   * \brief Send all of the data over the channel, retrying partial sends.
+   *
+   *  Used to stream large payloads (e.g. tensor contents) directly from the
+   *  caller's buffer without staging them through an intermediate buffer.
+   * \param data The data pointer.
+   * \param size The size of the data.
+   */
+  void SendAll(const void* data, size_t size);
 };
 
 /*!
@@ -94,6 +105,35 @@ class CallbackChannel final : public RPCChannel {
   PackedFunc frecv_;
 };
 
+/*!
+ * \brief Channel decorator that compresses traffic in flight.
+ *
+ *  Every Send becomes one framed record ([raw size][payload size][payload],
+ *  falling back to a stored payload when compression does not help), so
+ *  module binaries and tensor payloads shrink on slow links. Both peers must
+ *  enable it (TVM_RPC_COMPRESS=1); the format is internal to TVM's own
+ *  support::CompressBytes codec.
+ */
+class CompressedChannel final : public RPCChannel {
+ public:
+  explicit CompressedChannel(std::unique_ptr<RPCChannel> inner) : inner_(std::move(inner)) {}
+
+  size_t Send(const void* data, size_t size) final;
+  size_t Recv(void* data, size_t size) final;
+
+ private:
+  /*! \brief Read exactly size bytes from the inner channel.
+   *  \return False when the channel closed before the first byte. */
+  bool RecvAllInner(void* data, size_t size, bool allow_clean_close);
+
+  /*! \brief The transport this channel compresses onto. */
+  std::unique_ptr<RPCChannel> inner_;
+  /*! \brief Decompressed bytes not yet handed to the caller. */
+  std::string recv_buf_;
+  /*! \brief Read cursor into recv_buf_. */
+  size_t recv_pos_{0};
+};
+
 }  // namespace runtime
 }  // namespace tvm
 #endif  // TVM_RUNTIME_RPC_RPC_CHANNEL_H_
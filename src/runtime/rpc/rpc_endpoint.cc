@@ -621,14 +621,18 @@ class RPCEndpoint::EventHandler : public dmlc::Stream {
   std::function<void()> flush_writer_;
 };
 
+void RPCEndpoint::FlushWriter() {
+  while (writer_.bytes_available() != 0) {
+    writer_.ReadWithCallback(
+        [this](const void* data, size_t size) { return channel_->Send(data, size); },
+        writer_.bytes_available());
+  }
+}
+
 RPCCode RPCEndpoint::HandleUntilReturnEvent(bool client_mode, RPCSession::FEncodeReturn setreturn) {
   RPCCode code = RPCCode::kCallFunc;
   while (code != RPCCode::kReturn && code != RPCCode::kShutdown && code != RPCCode::kCopyAck) {
-    while (writer_.bytes_available() != 0) {
-      writer_.ReadWithCallback(
-          [this](const void* data, size_t size) { return channel_->Send(data, size); },
-          writer_.bytes_available());
-    }
+    FlushWriter();
     size_t bytes_needed = handler_->BytesNeeded();
     if (bytes_needed != 0) {
       size_t n = reader_.WriteWithCallback(
@@ -817,7 +821,12 @@ void RPCEndpoint::CopyToRemote(void* from_bytes, DLTensor* to, uint64_t nbytes)
   handler_->Write(code);
   RPCReference::SendDLTensor(handler_, to);
   handler_->Write(nbytes);
-  handler_->WriteArray(reinterpret_cast<char*>(from_bytes), nbytes);
+  // Stream the payload directly from the source buffer: flush the staged
+  // header, then hand the tensor bytes to the channel without copying them
+  // through the write ring buffer, which would double peak memory for large
+  // parameter sets.
+  FlushWriter();
+  channel_->SendAll(from_bytes, nbytes);
   ICHECK(HandleUntilReturnEvent(true, [](TVMArgs) {}) == RPCCode::kReturn);
 }
 
@@ -178,6 +178,8 @@ class RPCEndpoint {
   void Init();
   // Shutdown
   void Shutdown();
+  // Push all staged writer bytes out to the channel.
+  void FlushWriter();
   // Internal channel.
   std::unique_ptr<RPCChannel> channel_;
   // Internal mutex
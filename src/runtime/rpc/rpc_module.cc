@@ -26,8 +26,12 @@
 #include <tvm/runtime/profiling.h>
 #include <tvm/runtime/registry.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <cstring>
 #include <memory>
+#include <vector>
 #if defined(_M_X64) || defined(__x86_64__)
 #include <immintrin.h>
 #endif
@@ -350,6 +354,32 @@ inline void CPUCacheFlushImpl(const char* addr, unsigned int len) {
 #endif
 }
 
+/*!
+ * \brief Whether the measured samples pin down their median tightly enough.
+ *
+ *  Uses the distribution-free order-statistic confidence interval for the
+ *  median at ~95% coverage: ranks n/2 +/- 1.96*sqrt(n)/2. Stable kernels
+ *  converge in a handful of repeats while noisy ones keep measuring up to
+ *  the caller's cap, and unlike a mean-based interval a stray outlier from
+ *  a shared board cannot stall convergence.
+ *
+ * \param samples The per-repeat averaged costs measured so far.
+ * \param max_rel_half_width The requested relative half-width of the interval.
+ * \return True when the interval is narrow enough to stop measuring.
+ */
+inline bool MedianConverged(const std::vector<double>& samples, double max_rel_half_width) {
+  size_t n = samples.size();
+  std::vector<double> sorted(samples);
+  std::sort(sorted.begin(), sorted.end());
+  double half_rank = 0.98 * std::sqrt(static_cast<double>(n));  // 1.96 * sqrt(n) / 2
+  double mid = (n - 1) / 2.0;
+  size_t lo = static_cast<size_t>(std::max(0.0, std::floor(mid - half_rank)));
+  size_t hi = static_cast<size_t>(std::min(n - 1.0, std::ceil(mid + half_rank)));
+  double median = (n % 2) ? sorted[n / 2] : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+  if (median <= 0.0) return false;
+  return (sorted[hi] - sorted[lo]) <= 2.0 * max_rel_half_width * median;
+}
+
 inline void CPUCacheFlush(int begin_index, const TVMArgs& args) {
   for (int i = begin_index; i < args.size(); i++) {
     CPUCacheFlushImpl(static_cast<char*>((args[i].operator DLTensor*()->data)),
@@ -376,6 +406,14 @@ PackedFunc WrapTimeEvaluator(PackedFunc pf, Device dev, int number, int repeat,
 
     DeviceAPI::Get(dev)->StreamSync(dev, nullptr);
 
+    // Opt-in adaptive repetition: when TVM_TIME_EVALUATOR_CI gives a relative
+    // half-width (e.g. 0.05), `repeat` becomes a hard cap and measurement
+    // stops as soon as the median's confidence interval is narrow enough.
+    const char* ci_env = std::getenv("TVM_TIME_EVALUATOR_CI");
+    const double ci_target = ci_env ? std::atof(ci_env) : 0.0;
+    constexpr int kMinAdaptiveRepeats = 5;
+    std::vector<double> speeds;
+
     for (int i = 0; i < repeat; ++i) {
       if (f_preproc != nullptr) {
         f_preproc.CallPacked(args, &temp);
@@ -400,6 +438,14 @@ PackedFunc WrapTimeEvaluator(PackedFunc pf, Device dev, int number, int repeat,
 
       double speed = duration_ms / 1e3 / number;
       os.write(reinterpret_cast<char*>(&speed), sizeof(speed));
+
+      if (ci_target > 0.0) {
+        speeds.push_back(speed);
+        if (static_cast<int>(speeds.size()) >= kMinAdaptiveRepeats &&
+            MedianConverged(speeds, ci_target)) {
+          break;
+        }
+      }
     }
 
     std::string blob = os.str();
@@ -0,0 +1,222 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file rpc_shm_impl.cc
+ * \brief Shared-memory RPC channel for same-host sessions.
+ *
+ *  Same-host measurement setups still push every tensor through a socket,
+ *  paying kernel round trips and copies per page. This channel moves the
+ *  whole RPC byte stream through two single-producer single-consumer rings
+ *  in anonymous shared memory (one per direction), inherited by a forked
+ *  server child the way the pipe transport passes its descriptors. Reads
+ *  and writes are memcpys into the mapping with a bounded spin-then-yield
+ *  wait, so large-tensor transfers run at memory bandwidth and no payload
+ *  crosses the kernel after setup.
+ */
+// Linux only: depends on memfd-style anonymous shared memory and fork.
+#if defined(__linux__)
+
+#include <dmlc/base.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <tvm/runtime/registry.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rpc_endpoint.h"
+#include "rpc_local_session.h"
+
+namespace tvm {
+namespace runtime {
+
+namespace {
+
+/*! \brief One direction of the transport: a byte ring in shared memory. */
+struct ShmRing {
+  std::atomic<uint64_t> head;  // consumer cursor
+  char pad0[64 - sizeof(std::atomic<uint64_t>)];
+  std::atomic<uint64_t> tail;  // producer cursor
+  char pad1[64 - sizeof(std::atomic<uint64_t>)];
+  uint64_t capacity;
+  char pad2[64 - sizeof(uint64_t)];
+  char data[1];  // capacity bytes follow
+
+  static size_t TotalBytes(uint64_t capacity) { return sizeof(ShmRing) + capacity; }
+
+  void Init(uint64_t cap) {
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+    capacity = cap;
+  }
+
+  size_t Write(const void* src, size_t size) {
+    uint64_t tail_pos = tail.load(std::memory_order_relaxed);
+    uint64_t used = tail_pos - head.load(std::memory_order_acquire);
+    uint64_t space = capacity - used;
+    for (int spin = 0; space == 0; ++spin) {
+      if (spin > 1024) sched_yield();
+      space = capacity - (tail_pos - head.load(std::memory_order_acquire));
+    }
+    size_t n = std::min<uint64_t>(size, space);
+    uint64_t offset = tail_pos % capacity;
+    size_t first = std::min<uint64_t>(n, capacity - offset);
+    std::memcpy(data + offset, src, first);
+    std::memcpy(data, static_cast<const char*>(src) + first, n - first);
+    tail.store(tail_pos + n, std::memory_order_release);
+    return n;
+  }
+
+  size_t Read(void* dst, size_t size) {
+    uint64_t head_pos = head.load(std::memory_order_relaxed);
+    uint64_t avail = tail.load(std::memory_order_acquire) - head_pos;
+    for (int spin = 0; avail == 0; ++spin) {
+      if (spin > 1024) sched_yield();
+      avail = tail.load(std::memory_order_acquire) - head_pos;
+    }
+    size_t n = std::min<uint64_t>(size, avail);
+    uint64_t offset = head_pos % capacity;
+    size_t first = std::min<uint64_t>(n, capacity - offset);
+    std::memcpy(dst, data + offset, first);
+    std::memcpy(static_cast<char*>(dst) + first, data, n - first);
+    head.store(head_pos + n, std::memory_order_release);
+    return n;
+  }
+};
+
+ShmRing* MapRing(int fd, uint64_t capacity) {
+  void* addr =
+      mmap(nullptr, ShmRing::TotalBytes(capacity), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ICHECK(addr != MAP_FAILED) << "Cannot map the shared-memory ring: " << strerror(errno);
+  return static_cast<ShmRing*>(addr);
+}
+
+int CreateRingFd(uint64_t capacity) {
+  // memfd_create via syscall to stay friendly to older libcs; the fd is
+  // intentionally inheritable so the forked server child can map it.
+  int fd = static_cast<int>(syscall(SYS_memfd_create, "tvm_rpc_shm", 0));
+  ICHECK_GE(fd, 0) << "memfd_create failed: " << strerror(errno);
+  ICHECK_EQ(ftruncate(fd, ShmRing::TotalBytes(capacity)), 0);
+  return fd;
+}
+
+class ShmChannel final : public RPCChannel {
+ public:
+  ShmChannel(int recv_fd, int send_fd, uint64_t capacity, pid_t child_pid)
+      : capacity_(capacity), child_pid_(child_pid) {
+    recv_ring_ = MapRing(recv_fd, capacity);
+    send_ring_ = MapRing(send_fd, capacity);
+    recv_fd_ = recv_fd;
+    send_fd_ = send_fd;
+  }
+
+  ~ShmChannel() {
+    munmap(recv_ring_, ShmRing::TotalBytes(capacity_));
+    munmap(send_ring_, ShmRing::TotalBytes(capacity_));
+    close(recv_fd_);
+    close(send_fd_);
+    if (child_pid_ > 0) {
+      kill(child_pid_, SIGKILL);
+    }
+  }
+
+  size_t Send(const void* data, size_t size) final { return send_ring_->Write(data, size); }
+
+  size_t Recv(void* data, size_t size) final { return recv_ring_->Read(data, size); }
+
+ private:
+  ShmRing* recv_ring_;
+  ShmRing* send_ring_;
+  int recv_fd_;
+  int send_fd_;
+  uint64_t capacity_;
+  pid_t child_pid_;
+};
+
+}  // namespace
+
+/*!
+ * \brief Spawn cmd as a same-host RPC server connected over shared memory.
+ *
+ *  Mirrors rpc.CreatePipeClient: two ring fds and the capacity are appended
+ *  to the command line, and the child enters the loop via rpc.ServeShm.
+ */
+Module CreateShmClient(std::vector<std::string> cmd, uint64_t capacity) {
+  int c2s = CreateRingFd(capacity);
+  int s2c = CreateRingFd(capacity);
+  // Initialize before fork so both sides see a ready ring.
+  for (int fd : {c2s, s2c}) {
+    ShmRing* ring = MapRing(fd, capacity);
+    ring->Init(capacity);
+    munmap(ring, ShmRing::TotalBytes(capacity));
+  }
+
+  pid_t pid = fork();
+  if (pid == 0) {
+    std::string sread = std::to_string(c2s);
+    std::string swrite = std::to_string(s2c);
+    std::string scap = std::to_string(capacity);
+    std::vector<char*> argv;
+    for (auto& str : cmd) {
+      argv.push_back(dmlc::BeginPtr(str));
+    }
+    argv.push_back(dmlc::BeginPtr(sread));
+    argv.push_back(dmlc::BeginPtr(swrite));
+    argv.push_back(dmlc::BeginPtr(scap));
+    argv.push_back(nullptr);
+    execvp(argv[0], &argv[0]);
+    _exit(127);
+  }
+
+  auto endpt = RPCEndpoint::Create(
+      std::unique_ptr<ShmChannel>(new ShmChannel(s2c, c2s, capacity, pid)), "shm", "shm");
+  endpt->InitRemoteSession(TVMArgs(nullptr, nullptr, 0));
+  return CreateRPCSessionModule(CreateClientSession(endpt));
+}
+
+TVM_REGISTER_GLOBAL("rpc.CreateShmClient").set_body([](TVMArgs args, TVMRetValue* rv) {
+  std::vector<std::string> cmd;
+  for (int i = 0; i < args.size() - 1; ++i) {
+    cmd.push_back(args[i].operator std::string());
+  }
+  uint64_t capacity = static_cast<uint64_t>(args[args.size() - 1].operator int64_t());
+  *rv = CreateShmClient(cmd, capacity);
+});
+
+// Server side: the spawned child calls this with the two inherited ring fds
+// (read = client-to-server, write = server-to-client) and the capacity.
+TVM_REGISTER_GLOBAL("rpc.ServeShm").set_body_typed([](int read_fd, int write_fd, int64_t capacity) {
+  RPCEndpoint::Create(std::unique_ptr<ShmChannel>(new ShmChannel(
+                          read_fd, write_fd, static_cast<uint64_t>(capacity), /*child_pid=*/0)),
+                      "ShmServerLoop", "")
+      ->ServerLoop();
+});
+
+}  // namespace runtime
+}  // namespace tvm
+
+#endif  // __linux__
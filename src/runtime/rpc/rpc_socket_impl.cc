@@ -23,7 +23,14 @@
  */
 #include <tvm/runtime/registry.h>
 
+#include <chrono>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "../../support/socket.h"
 #include "rpc_endpoint.h"
@@ -33,6 +40,16 @@
 namespace tvm {
 namespace runtime {
 
+// Wrap the transport in a compressing decorator when TVM_RPC_COMPRESS=1.
+// Compression is configured, not negotiated: both peers must enable it.
+static std::unique_ptr<RPCChannel> MaybeCompressed(std::unique_ptr<RPCChannel> channel) {
+  const char* compress = getenv("TVM_RPC_COMPRESS");
+  if (compress && atoi(compress) != 0) {
+    return std::unique_ptr<RPCChannel>(new CompressedChannel(std::move(channel)));
+  }
+  return channel;
+}
+
 class SockChannel final : public RPCChannel {
  public:
   explicit SockChannel(support::TCPSocket sock) : sock_(sock) {}
@@ -96,8 +113,8 @@ std::shared_ptr<RPCEndpoint> RPCConnect(std::string url, int port, std::string k
     remote_key.resize(keylen);
     ICHECK_EQ(sock.RecvAll(&remote_key[0], keylen), keylen);
   }
-  auto endpt =
-      RPCEndpoint::Create(std::unique_ptr<SockChannel>(new SockChannel(sock)), key, remote_key);
+  auto endpt = RPCEndpoint::Create(
+      MaybeCompressed(std::unique_ptr<RPCChannel>(new SockChannel(sock))), key, remote_key);
   endpt->InitRemoteSession(init_seq);
   return endpt;
 }
@@ -110,13 +127,15 @@ Module RPCClientConnect(std::string url, int port, std::string key, TVMArgs init
 // TVM_DLL needed for MSVC
 TVM_DLL void RPCServerLoop(int sockfd) {
   support::TCPSocket sock(static_cast<support::TCPSocket::SockType>(sockfd));
-  RPCEndpoint::Create(std::unique_ptr<SockChannel>(new SockChannel(sock)), "SockServerLoop", "")
+  RPCEndpoint::Create(MaybeCompressed(std::unique_ptr<RPCChannel>(new SockChannel(sock))),
+                      "SockServerLoop", "")
       ->ServerLoop();
 }
 
 void RPCServerLoop(PackedFunc fsend, PackedFunc frecv) {
-  RPCEndpoint::Create(std::unique_ptr<CallbackChannel>(new CallbackChannel(fsend, frecv)),
-                      "SockServerLoop", "")
+  RPCEndpoint::Create(
+      MaybeCompressed(std::unique_ptr<RPCChannel>(new CallbackChannel(fsend, frecv))),
+      "SockServerLoop", "")
       ->ServerLoop();
 }
 
@@ -128,6 +147,104 @@ TVM_REGISTER_GLOBAL("rpc.Connect").set_body([](TVMArgs args, TVMRetValue* rv) {
                          TVMArgs(args.values + 3, args.type_codes + 3, args.size() - 3));
 });
 
+/*!
+ * \brief Pool of warm client sessions keyed by (url, port, key).
+ *
+ *  Measurement loops open a fresh TCP session per trial, paying connect and
+ *  InitRemoteSession handshake each time. Runners instead lease a session
+ *  with rpc.SessionPoolAcquire and hand it back with rpc.SessionPoolRelease;
+ *  released sessions are health-checked with a cheap remote call on the next
+ *  acquire and dropped after an idle timeout (TVM_RPC_POOL_IDLE_TIMEOUT
+ *  seconds, default 600) or when the probe fails.
+ */
+class RPCSessionPool {
+ public:
+  static RPCSessionPool* Global() {
+    static RPCSessionPool* inst = new RPCSessionPool();
+    return inst;
+  }
+
+  Module Acquire(const std::string& url, int port, const std::string& key, TVMArgs init_seq) {
+    std::string pool_key = PoolKey(url, port, key);
+    for (;;) {
+      Module cached;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& entries = pool_[pool_key];
+        // Trim sessions idle past the timeout; the newest entry is reused.
+        auto now = std::chrono::steady_clock::now();
+        while (!entries.empty() &&
+               now - entries.front().released_at > std::chrono::seconds(idle_timeout_seconds_)) {
+          entries.pop_front();
+        }
+        if (entries.empty()) break;
+        cached = std::move(entries.back().session);
+        entries.pop_back();
+      }
+      if (HealthCheck(&cached)) {
+        return cached;
+      }
+      // Dead session: drop it and try the next cached one, if any.
+    }
+    return RPCClientConnect(url, port, key, init_seq);
+  }
+
+  void Release(const std::string& url, int port, const std::string& key, Module session) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pool_[PoolKey(url, port, key)].push_back(
+        PooledSession{std::move(session), std::chrono::steady_clock::now()});
+  }
+
+ private:
+  struct PooledSession {
+    Module session;
+    std::chrono::steady_clock::time_point released_at;
+  };
+
+  RPCSessionPool() {
+    if (const char* val = getenv("TVM_RPC_POOL_IDLE_TIMEOUT")) {
+      idle_timeout_seconds_ = atoi(val);
+    }
+  }
+
+  static std::string PoolKey(const std::string& url, int port, const std::string& key) {
+    std::ostringstream os;
+    os << url << ":" << port << "/" << key;
+    return os.str();
+  }
+
+  // A remote GetFunction round-trips through the endpoint, so it doubles as a
+  // liveness probe for the pooled connection.
+  static bool HealthCheck(Module* session) {
+    try {
+      session->GetFunction("runtime.String", true);
+      return true;
+    } catch (const std::exception&) {
+      return false;
+    }
+  }
+
+  int idle_timeout_seconds_{600};
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::deque<PooledSession>> pool_;
+};
+
+TVM_REGISTER_GLOBAL("rpc.SessionPoolAcquire").set_body([](TVMArgs args, TVMRetValue* rv) {
+  std::string url = args[0];
+  int port = args[1];
+  std::string key = args[2];
+  *rv = RPCSessionPool::Global()->Acquire(
+      url, port, key, TVMArgs(args.values + 3, args.type_codes + 3, args.size() - 3));
+});
+
+TVM_REGISTER_GLOBAL("rpc.SessionPoolRelease").set_body([](TVMArgs args, TVMRetValue* rv) {
+  std::string url = args[0];
+  int port = args[1];
+  std::string key = args[2];
+  Module session = args[3];
+  RPCSessionPool::Global()->Release(url, port, key, std::move(session));
+});
+
 TVM_REGISTER_GLOBAL("rpc.ServerLoop").set_body([](TVMArgs args, TVMRetValue* rv) {
   if (args[0].type_code() == kDLInt) {
     RPCServerLoop(args[0]);
@@ -0,0 +1,143 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file shape_dispatcher.cc
+ * \brief Runtime dispatch between shape-specialized kernel variants.
+ *
+ *  Variable-shape models compile one shape-generic kernel (via relay.Any and
+ *  the VM) plus specialized variants for hot shapes. The dispatcher is the
+ *  thin runtime layer between them: it keys on the concrete shapes of the
+ *  tensor arguments of a call, invokes a registered specialized variant on an
+ *  exact match, and falls back to the generic kernel otherwise. Lookup is a
+ *  single hash over the argument shapes, and the per-shape call counts it
+ *  keeps let deployments decide which shapes deserve specialization next.
+ */
+#include <tvm/runtime/container/map.h>
+#include <tvm/runtime/container/string.h>
+#include <tvm/runtime/packed_func.h>
+#include <tvm/runtime/registry.h>
+
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace tvm {
+namespace runtime {
+
+/*! \brief Dispatches calls to shape-specialized variants of one kernel. */
+class ShapeDispatcherObj : public Object {
+ public:
+  /*! \brief The generic fallback invoked for unmatched shapes. */
+  PackedFunc generic;
+
+  /*! \brief Compute the dispatch key of a call: all DLTensor argument shapes. */
+  static std::string ShapeKeyOf(const TVMArgs& args) {
+    std::ostringstream os;
+    for (int i = 0; i < args.num_args; ++i) {
+      if (args[i].type_code() != kTVMDLTensorHandle && args[i].type_code() != kTVMNDArrayHandle) {
+        continue;
+      }
+      DLTensor* tensor = args[i];
+      os << '|';
+      for (int dim = 0; dim < tensor->ndim; ++dim) {
+        os << tensor->shape[dim] << ',';
+      }
+    }
+    return os.str();
+  }
+
+  /*! \brief Register a specialized variant for a shape key. */
+  void Register(const std::string& shape_key, PackedFunc variant) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    variants_[shape_key].variant = std::move(variant);
+  }
+
+  /*! \brief Dispatch a call to the best variant. */
+  void Call(TVMArgs args, TVMRetValue* rv) {
+    std::string shape_key = ShapeKeyOf(args);
+    PackedFunc target;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      Entry& entry = variants_[shape_key];
+      ++entry.calls;
+      target = entry.variant != nullptr ? entry.variant : generic;
+    }
+    target.CallPacked(args, rv);
+  }
+
+  /*! \brief Report per-shape call counts, for deciding what to specialize. */
+  Map<String, String> CallCounts() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Map<String, String> result;
+    for (const auto& kv : variants_) {
+      result.Set(kv.first, std::to_string(kv.second.calls));
+    }
+    return result;
+  }
+
+  static constexpr const uint32_t _type_index = TypeIndex::kDynamic;
+  static constexpr const char* _type_key = "runtime.ShapeDispatcher";
+  TVM_DECLARE_FINAL_OBJECT_INFO(ShapeDispatcherObj, Object);
+
+ private:
+  struct Entry {
+    PackedFunc variant{nullptr};
+    int64_t calls{0};
+  };
+  std::mutex mutex_;
+  std::unordered_map<std::string, Entry> variants_;
+};
+
+TVM_REGISTER_OBJECT_TYPE(ShapeDispatcherObj);
+
+class ShapeDispatcher : public ObjectRef {
+ public:
+  TVM_DEFINE_MUTABLE_OBJECT_REF_METHODS(ShapeDispatcher, ObjectRef, ShapeDispatcherObj);
+};
+
+TVM_REGISTER_GLOBAL("runtime.ShapeDispatcherCreate").set_body_typed([](PackedFunc generic) {
+  auto obj = make_object<ShapeDispatcherObj>();
+  obj->generic = std::move(generic);
+  return ShapeDispatcher(obj);
+});
+
+TVM_REGISTER_GLOBAL("runtime.ShapeDispatcherRegister")
+    .set_body_typed([](ShapeDispatcher dispatcher, String shape_key, PackedFunc variant) {
+      dispatcher->Register(shape_key, std::move(variant));
+    });
+
+TVM_REGISTER_GLOBAL("runtime.ShapeDispatcherGetFunction")
+    .set_body_typed([](ShapeDispatcher dispatcher) {
+      return PackedFunc(
+          [dispatcher](TVMArgs args, TVMRetValue* rv) { dispatcher->Call(args, rv); });
+    });
+
+TVM_REGISTER_GLOBAL("runtime.ShapeDispatcherCallCounts")
+    .set_body_typed([](ShapeDispatcher dispatcher) { return dispatcher->CallCounts(); });
+
+TVM_REGISTER_GLOBAL("runtime.ShapeDispatcherShapeKey").set_body([](TVMArgs args, TVMRetValue* rv) {
+  *rv = ShapeDispatcherObj::ShapeKeyOf(args);
+});
+
+}  // namespace runtime
+}  // namespace tvm
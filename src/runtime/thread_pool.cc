@@ -33,6 +33,7 @@
 #endif
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstring>
 #include <memory>
@@ -60,6 +61,10 @@ uint32_t GetSpinCount() {
 
 }  // namespace
 
+// Sentinel task id pushed to workers in work-stealing mode; the real task id
+// is claimed from the launcher's shared cursor instead.
+constexpr int32_t kWorkStealingToken = -1;
+
 // stride in the page, fit to cache line.
 constexpr int kSyncStride = 64 / sizeof(std::atomic<int>);
 
@@ -117,6 +122,14 @@ class ParallelLauncher {
   }
   // Signal that one job has finished.
   void SignalJobFinish() { num_pending_.fetch_sub(1); }
+  // Claim the next unstarted task in work-stealing mode.
+  // Returns the task id, or kWorkStealingToken if all tasks are claimed.
+  int32_t FetchTask() {
+    int32_t task_id = task_cursor_.fetch_add(1, std::memory_order_relaxed);
+    return task_id < env.num_task ? task_id : kWorkStealingToken;
+  }
+  // Reset the claim cursor before a work-stealing launch.
+  void ResetTaskCursor() { task_cursor_.store(0, std::memory_order_relaxed); }
   // Get thread local version of the store.
   static ParallelLauncher* ThreadLocal() { return dmlc::ThreadLocalStore<ParallelLauncher>::Get(); }
   // The parallel lambda
@@ -132,6 +145,8 @@ class ParallelLauncher {
  private:
   // The pending jobs.
   std::atomic<int32_t> num_pending_;
+  // The next unclaimed task id when tasks are claimed by stealing.
+  std::atomic<int32_t> task_cursor_{0};
   // Whether error has been countered.
   std::atomic<bool> has_error_;
   // The counter page.
@@ -262,6 +277,10 @@ class ThreadPool {
     if (exclude_worker0 && atoi(exclude_worker0) == 0) {
       exclude_worker0_ = false;
     }
+    const char* work_stealing = getenv("TVM_THREAD_POOL_WORK_STEALING");
+    if (work_stealing && atoi(work_stealing) != 0) {
+      work_stealing_ = true;
+    }
     Init();
   }
 
@@ -295,17 +314,43 @@ class ThreadPool {
           << " workers=" << num_workers_used_ << " request=" << num_task;
     }
     launcher->Init(flambda, cdata, num_task, need_sync != 0);
+    UpdateLaunchInterval();
     SpscTaskQueue::Task tsk;
     tsk.launcher = launcher;
-    // if worker0 is taken by the main, queues_[0] is abandoned
-    for (int i = exclude_worker0_; i < num_task; ++i) {
-      tsk.task_id = i;
-      queues_[i]->Push(tsk);
+    // In work-stealing mode workers claim unstarted tasks from a shared cursor
+    // instead of waiting on their statically assigned one, so a slow core does
+    // not stall the launch. Safe also for barriered launches: num_task is
+    // checked above to not exceed the claiming workers, and a claimer blocked
+    // in TVMBackendParallelBarrier cannot claim a second task, so every task
+    // of a sync group ends up in flight concurrently.
+    const bool use_stealing = work_stealing_;
+    if (use_stealing) {
+      launcher->ResetTaskCursor();
+      tsk.task_id = kWorkStealingToken;
+      int num_wakeup = std::min(num_task, num_workers_used_);
+      for (int i = exclude_worker0_; i < num_wakeup; ++i) {
+        queues_[i]->Push(tsk);
+      }
+    } else {
+      // if worker0 is taken by the main, queues_[0] is abandoned
+      for (int i = exclude_worker0_; i < num_task; ++i) {
+        tsk.task_id = i;
+        queues_[i]->Push(tsk);
+      }
     }
-    // use the main thread to run task 0
+    // use the main thread to run task 0 (or claim tasks in stealing mode)
     if (exclude_worker0_) {
       TVMParallelGroupEnv* penv = &(tsk.launcher->env);
-      if ((*tsk.launcher->flambda)(0, penv, cdata) == 0) {
+      if (use_stealing) {
+        int32_t task_id;
+        while ((task_id = launcher->FetchTask()) != kWorkStealingToken) {
+          if ((*launcher->flambda)(task_id, penv, cdata) == 0) {
+            launcher->SignalJobFinish();
+          } else {
+            launcher->SignalJobError(task_id);
+          }
+        }
+      } else if ((*tsk.launcher->flambda)(0, penv, cdata) == 0) {
         tsk.launcher->SignalJobFinish();
       } else {
         tsk.launcher->SignalJobError(tsk.task_id);
@@ -317,15 +362,21 @@ class ThreadPool {
 
   static ThreadPool* ThreadLocal() { return dmlc::ThreadLocalStore<ThreadPool>::Get(); }
 
-  void UpdateWorkerConfiguration(threading::ThreadGroup::AffinityMode mode, int nthreads) {
+  void UpdateWorkerConfiguration(threading::ThreadGroup::AffinityMode mode, int nthreads,
+                                 int numa_node = -1) {
     // this will also reset the affinity of the ThreadGroup
     // may use less than the MaxConcurrency number of workers
-    num_workers_used_ = threads_->Configure(mode, nthreads, exclude_worker0_);
+    num_workers_used_ = threads_->Configure(mode, nthreads, exclude_worker0_, numa_node);
     // if MaxConcurrency restricted the number of workers (e.g., due to
     // hyperthreading), respect the restriction
     num_workers_used_ = std::min(num_workers_, num_workers_used_);
   }
 
+  void UpdateWorkerGroup(int group_index, int num_groups) {
+    num_workers_used_ = threads_->ConfigureGroup(group_index, num_groups, exclude_worker0_);
+    num_workers_used_ = std::min(num_workers_, num_workers_used_);
+  }
+
  private:
   // Shared initialization code
   void Init() {
@@ -340,6 +391,51 @@ class ThreadPool {
     num_workers_used_ = threads_->Configure(threading::ThreadGroup::kBig, 0, exclude_worker0_);
   }
 
+  /*!
+   * \brief Track the time between parallel launches for adaptive spinning.
+   *
+   *  Only the (single) launching thread writes; workers read the EWMA with
+   *  relaxed ordering - staleness just means a slightly miscalibrated spin.
+   */
+  void UpdateLaunchInterval() {
+    int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now().time_since_epoch())
+                      .count();
+    if (last_launch_ns_ != 0) {
+      int64_t interval = now - last_launch_ns_;
+      int64_t ewma = launch_interval_ns_.load(std::memory_order_relaxed);
+      ewma = (ewma <= 0) ? interval : (7 * ewma + interval) / 8;
+      launch_interval_ns_.store(ewma, std::memory_order_relaxed);
+    }
+    last_launch_ns_ = now;
+  }
+
+  /*!
+   * \brief Worker spin budget for the next Pop.
+   *
+   *  With TVM_THREAD_POOL_ADAPTIVE_SPIN=1, workers spin long enough to cover
+   *  the recently observed launch interval when dispatches arrive faster
+   *  than the wakeup latency matters (sub-2ms cadence), removing the futex
+   *  round trip and its jitter from back-to-back sub-millisecond kernels.
+   *  Sparse dispatch keeps the configured default so idle pools still sleep.
+   */
+  uint32_t AdaptiveSpinCount(size_t default_spin) const {
+    static const bool adaptive = [] {
+      const char* env = getenv("TVM_THREAD_POOL_ADAPTIVE_SPIN");
+      return env != nullptr && atoi(env) != 0;
+    }();
+    if (!adaptive) return static_cast<uint32_t>(default_spin);
+    constexpr int64_t kMaxCoveredIntervalNs = 2 * 1000 * 1000;  // 2ms
+    constexpr int64_t kApproxNsPerSpin = 20;
+    constexpr uint32_t kMaxSpinIters = 300000;
+    int64_t ewma = launch_interval_ns_.load(std::memory_order_relaxed);
+    if (ewma <= 0 || ewma > kMaxCoveredIntervalNs) {
+      return static_cast<uint32_t>(default_spin);
+    }
+    int64_t iters = ewma / kApproxNsPerSpin + 1;
+    return static_cast<uint32_t>(std::min<int64_t>(iters, kMaxSpinIters));
+  }
+
   // Internal worker function.
   void RunWorker(int worker_id) {
     SpscTaskQueue* queue = queues_[worker_id].get();
@@ -349,11 +445,32 @@ class ThreadPool {
     // the global first use of the ThreadPool.
     // TODO(tulloch): should we make this configurable via standard APIs?
     static size_t spin_count = GetSpinCount();
-    while (queue->Pop(&task, spin_count)) {
+    while (queue->Pop(&task, AdaptiveSpinCount(spin_count))) {
       ICHECK(task.launcher != nullptr);
       TVMParallelGroupEnv* penv = &(task.launcher->env);
       void* cdata = task.launcher->cdata;
-      if ((*task.launcher->flambda)(task.task_id, penv, cdata) == 0) {
+      if (task.task_id == kWorkStealingToken) {
+        // Work-stealing mode: keep claiming unstarted tasks until none remain.
+        // The next claim must happen BEFORE the previous task's finish is
+        // signaled: the final SignalJobFinish releases WaitForJobs, after
+        // which the launching thread may Init the same thread-local launcher
+        // for its next launch - a FetchTask issued after that signal would
+        // claim a task of the new launch and run it with this launch's
+        // flambda/cdata. Claiming first means every fetch happens while at
+        // least one task of the current launch is still unsignaled, so the
+        // launcher cannot be recycled underneath it.
+        int32_t task_id = task.launcher->FetchTask();
+        while (task_id != kWorkStealingToken) {
+          int call_res = (*task.launcher->flambda)(task_id, penv, cdata);
+          int32_t next_task_id = task.launcher->FetchTask();
+          if (call_res == 0) {
+            task.launcher->SignalJobFinish();
+          } else {
+            task.launcher->SignalJobError(task_id);
+          }
+          task_id = next_task_id;
+        }
+      } else if ((*task.launcher->flambda)(task.task_id, penv, cdata) == 0) {
         task.launcher->SignalJobFinish();
       } else {
         task.launcher->SignalJobError(task.task_id);
@@ -365,6 +482,12 @@ class ThreadPool {
   int num_workers_used_;
   // if or not to exclude worker 0 and use main to run task 0
   bool exclude_worker0_{true};
+  // whether idle workers steal unstarted tasks (TVM_THREAD_POOL_WORK_STEALING)
+  bool work_stealing_{false};
+  // timestamp of the previous launch; touched only by the launching thread
+  int64_t last_launch_ns_{0};
+  // EWMA of the inter-launch interval, read by workers to size their spin
+  std::atomic<int64_t> launch_interval_ns_{-1};
   std::vector<std::unique_ptr<SpscTaskQueue> > queues_;
   std::unique_ptr<tvm::runtime::threading::ThreadGroup> threads_;
 };
@@ -373,9 +496,22 @@ TVM_REGISTER_GLOBAL("runtime.config_threadpool").set_body([](TVMArgs args, TVMRe
   threading::ThreadGroup::AffinityMode mode =
       static_cast<threading::ThreadGroup::AffinityMode>(static_cast<int>(args[0]));
   int nthreads = args[1];
-  ThreadPool::ThreadLocal()->UpdateWorkerConfiguration(mode, nthreads);
+  // Optional third argument restricts the pool to one NUMA node (kNuma mode),
+  // e.g. to run one executor replica per socket.
+  int numa_node = args.num_args > 2 ? static_cast<int>(args[2]) : -1;
+  ThreadPool::ThreadLocal()->UpdateWorkerConfiguration(mode, nthreads, numa_node);
 });
 
+// Thread pools are per calling thread, so an ensemble service runs one
+// executor per host thread and gives each a disjoint slice of the cores:
+// calling (i, n) from host thread i of n makes every TVMBackendParallelLaunch
+// issued from that thread use only its own group's workers, so concurrent
+// executors neither serialize on one pool nor oversubscribe the machine.
+TVM_REGISTER_GLOBAL("runtime.config_threadpool_group")
+    .set_body_typed([](int group_index, int num_groups) {
+      ThreadPool::ThreadLocal()->UpdateWorkerGroup(group_index, num_groups);
+    });
+
 namespace threading {
 void ResetThreadPool() { tvm::runtime::ThreadPool::ThreadLocal()->Reset(); }
 }  // namespace threading
@@ -383,16 +519,129 @@ void ResetThreadPool() { tvm::runtime::ThreadPool::ThreadLocal()->Reset(); }
 }  // namespace runtime
 }  // namespace tvm
 
+namespace {
+
+/*!
+ * \brief Per-kernel execution-time EWMAs for adaptive parallelism
+ * (TVM_ADAPTIVE_PARALLEL=1): kernels whose parallel region runs shorter
+ * than the fan-out/barrier cost are re-dispatched serially. Fixed-size
+ * open-addressed table keyed by the kernel's parallel lambda; lock free,
+ * no deletion, collisions simply fall back to parallel dispatch.
+ */
+struct AdaptiveParallelTable {
+  static constexpr size_t kSize = 1024;  // power of two
+  static constexpr int64_t kSerialThresholdNs = 30 * 1000;
+
+  struct Entry {
+    std::atomic<void*> key{nullptr};
+    std::atomic<int64_t> ewma_ns{0};
+  };
+  Entry entries[kSize];
+
+  static AdaptiveParallelTable* Global() {
+    static AdaptiveParallelTable* inst = new AdaptiveParallelTable();
+    return inst;
+  }
+
+  Entry* Find(void* key, bool insert) {
+    size_t index = (reinterpret_cast<uintptr_t>(key) >> 4) & (kSize - 1);
+    for (size_t probe = 0; probe < 8; ++probe) {
+      Entry& entry = entries[(index + probe) & (kSize - 1)];
+      void* current = entry.key.load(std::memory_order_acquire);
+      if (current == key) return &entry;
+      if (current == nullptr) {
+        if (!insert) return nullptr;
+        void* expected = nullptr;
+        if (entry.key.compare_exchange_strong(expected, key)) return &entry;
+        if (expected == key) return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  void Update(void* key, int64_t elapsed_ns) {
+    Entry* entry = Find(key, /*insert=*/true);
+    if (entry == nullptr) return;
+    int64_t old_value = entry->ewma_ns.load(std::memory_order_relaxed);
+    int64_t new_value = old_value == 0 ? elapsed_ns : (old_value * 7 + elapsed_ns) / 8;
+    entry->ewma_ns.store(new_value, std::memory_order_relaxed);
+  }
+
+  bool ShouldRunSerial(void* key) {
+    Entry* entry = Find(key, /*insert=*/false);
+    if (entry == nullptr) return false;
+    int64_t ewma = entry->ewma_ns.load(std::memory_order_relaxed);
+    return ewma != 0 && ewma < kSerialThresholdNs;
+  }
+};
+
+bool AdaptiveParallelEnabled() {
+  static const bool enabled = []() {
+    const char* val = getenv("TVM_ADAPTIVE_PARALLEL");
+    return val && atoi(val) != 0;
+  }();
+  return enabled;
+}
+
+// TVM_DETERMINISTIC_PARALLEL=1 pins every run-to-run degree of freedom that
+// can change floating-point association: timing-driven serial/parallel
+// switching is disabled so a kernel always fans out to the same task count,
+// and with it the same chunk boundaries. The tree reduction is already
+// canonical - its pairing depends only on task ids and rounds are barrier
+// separated - so with the task count pinned, reruns combine bit-exactly.
+// Costs the adaptive win on tiny kernels; intended for validation pipelines.
+bool DeterministicParallelEnabled() {
+  static const bool enabled = [] {
+    const char* val = getenv("TVM_DETERMINISTIC_PARALLEL");
+    return val && atoi(val) != 0;
+  }();
+  return enabled;
+}
+
+int RunSerial(FTVMParallelLambda flambda, void* cdata) {
+  std::atomic<int32_t> sync_counter{0};
+  TVMParallelGroupEnv env;
+  env.num_task = 1;
+  env.sync_handle = &sync_counter;
+  return (*flambda)(0, &env, cdata);
+}
+
+}  // namespace
+
+static int TVMBackendParallelLaunchImpl(FTVMParallelLambda flambda, void* cdata, int num_task,
+                                        int num_workers);
+
 int TVMBackendParallelLaunch(FTVMParallelLambda flambda, void* cdata, int num_task) {
   int num_workers = tvm::runtime::threading::MaxConcurrency();
   if (num_workers == 1) {
-    std::atomic<int32_t> sync_counter{0};
-    TVMParallelGroupEnv env;
-    env.num_task = 1;
-    env.sync_handle = &sync_counter;
-    (*flambda)(0, &env, cdata);
+    RunSerial(flambda, cdata);
     return 0;
-  } else {
+  }
+  if (AdaptiveParallelEnabled() && !DeterministicParallelEnabled()) {
+    // Kernels measured faster than the fan-out cost run serially: one task
+    // covering the whole range is always valid since generated kernels
+    // partition by penv->num_task, and a single task trivially passes its
+    // barriers.
+    auto* table = AdaptiveParallelTable::Global();
+    void* key = reinterpret_cast<void*>(flambda);
+    auto begin = std::chrono::steady_clock::now();
+    int res;
+    if (table->ShouldRunSerial(key)) {
+      res = RunSerial(flambda, cdata);
+    } else {
+      res = TVMBackendParallelLaunchImpl(flambda, cdata, num_task, num_workers);
+    }
+    auto end = std::chrono::steady_clock::now();
+    table->Update(key,
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    return res;
+  }
+  return TVMBackendParallelLaunchImpl(flambda, cdata, num_task, num_workers);
+}
+
+static int TVMBackendParallelLaunchImpl(FTVMParallelLambda flambda, void* cdata, int num_task,
+                                        int num_workers) {
+  {
 #if !TVM_THREADPOOL_USE_OPENMP
     int res = tvm::runtime::ThreadPool::ThreadLocal()->Launch(flambda, cdata, num_task, 1);
     return res;
@@ -410,6 +659,26 @@ int TVMBackendParallelLaunch(FTVMParallelLambda flambda, void* cdata, int num_ta
   }
 }
 
+int TVMBackendParallelTreeReduce(int task_id, TVMParallelGroupEnv* penv, void* partials,
+                                 int64_t elem_bytes, FTVMParallelReduceCombiner combiner,
+                                 void* cdata) {
+  int num_task = penv->num_task;
+  char* slots = static_cast<char*>(partials);
+  // Pairwise log-depth combine: in round r, tasks at even multiples of the
+  // stride fold in the partial one stride away. Barriers separate the rounds
+  // so a slot is only read after its owner finished writing it.
+  for (int stride = 1; stride < num_task; stride *= 2) {
+    TVMBackendParallelBarrier(task_id, penv);
+    if (task_id % (2 * stride) == 0 && task_id + stride < num_task) {
+      combiner(slots + static_cast<int64_t>(task_id) * elem_bytes,
+               slots + static_cast<int64_t>(task_id + stride) * elem_bytes, cdata);
+    }
+  }
+  // Make the combined slot 0 visible to every task.
+  TVMBackendParallelBarrier(task_id, penv);
+  return 0;
+}
+
 int TVMBackendParallelBarrier(int task_id, TVMParallelGroupEnv* penv) {
 #if TVM_THREADPOOL_USE_OPENMP
 #pragma omp barrier
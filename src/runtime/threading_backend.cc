@@ -51,6 +51,7 @@ class ThreadGroup::Impl {
       threads_.emplace_back([worker_callback, i] { worker_callback(i); });
     }
     InitSortedOrder();
+    InitNumaTopology();
   }
   ~Impl() { Join(); }
 
@@ -60,12 +61,16 @@ class ThreadGroup::Impl {
     }
   }
 
-  int Configure(AffinityMode mode, int nthreads, bool exclude_worker0) {
+  int Configure(AffinityMode mode, int nthreads, bool exclude_worker0, int numa_node = -1) {
     int num_workers_used = 0;
     if (mode == kLittle) {
       num_workers_used = little_count_;
     } else if (mode == kBig) {
       num_workers_used = big_count_;
+    } else if (mode == kNuma && numa_node >= 0 &&
+               numa_node < static_cast<int>(numa_nodes_.size())) {
+      // One replica per socket: do not use more workers than the node has cores.
+      num_workers_used = static_cast<int>(numa_nodes_[numa_node].size());
     } else {
       // use default
       num_workers_used = threading::MaxConcurrency();
@@ -83,7 +88,9 @@ class ThreadGroup::Impl {
     const char* val = getenv("TVM_BIND_THREADS");
     if (val == nullptr || atoi(val) == 1) {
       // Do not set affinity if there are more workers than found cores
-      if (sorted_order_.size() >= static_cast<unsigned int>(num_workers_)) {
+      if (mode == kNuma && !numa_nodes_.empty()) {
+        SetNumaAffinity(exclude_worker0, numa_node);
+      } else if (sorted_order_.size() >= static_cast<unsigned int>(num_workers_)) {
         SetAffinity(exclude_worker0, mode == kLittle);
       } else {
         LOG(WARNING) << "The thread affinity cannot be set when the number of workers"
@@ -93,6 +100,26 @@ class ThreadGroup::Impl {
     return num_workers_used;
   }
 
+  int ConfigureGroup(int group_index, int num_groups, bool exclude_worker0) {
+    ICHECK_GT(num_groups, 0);
+    ICHECK(group_index >= 0 && group_index < num_groups)
+        << "Worker group index " << group_index << " out of range for " << num_groups << " groups.";
+    // Each group owns a disjoint contiguous slice of the sorted core order,
+    // so concurrent pools never compete for the same cores.
+    int chunk = std::max(1, static_cast<int>(sorted_order_.size()) / num_groups);
+    int num_workers_used = std::min(num_workers_, chunk);
+    const char* val = getenv("TVM_BIND_THREADS");
+    if (val == nullptr || atoi(val) == 1) {
+      if (sorted_order_.size() >= static_cast<unsigned int>(num_groups)) {
+        SetGroupAffinity(exclude_worker0, group_index, chunk);
+      } else {
+        LOG(WARNING) << "The thread affinity cannot be set when the number of worker groups"
+                     << "is larger than the number of available cores in the system.";
+      }
+    }
+    return num_workers_used;
+  }
+
  private:
   // bind worker threads to disjoint cores
   // if worker 0 is offloaded to main, i.e. exclude_worker0 is true,
@@ -172,6 +199,107 @@ class ThreadGroup::Impl {
 #endif
   }
 
+  // Bind each worker to a NUMA node: all to numa_node when given, otherwise
+  // worker i to node (i % nodes). Workers get the node's full CPU mask so the
+  // OS schedules within the node but never across sockets; with first-touch
+  // placement their working sets then stay node-local.
+  void SetNumaAffinity(bool exclude_worker0, int numa_node) {
+#if defined(__linux__) || defined(__ANDROID__)
+    const int num_nodes = static_cast<int>(numa_nodes_.size());
+    auto node_of_worker = [&](int worker_id) {
+      if (numa_node >= 0 && numa_node < num_nodes) return numa_node;
+      return worker_id % num_nodes;
+    };
+    auto bind_to_node = [&](pthread_t handle, int node) {
+      cpu_set_t cpuset;
+      CPU_ZERO(&cpuset);
+      for (unsigned int core_id : numa_nodes_[node]) {
+        CPU_SET(core_id, &cpuset);
+      }
+#if defined(__ANDROID__)
+      sched_setaffinity(handle, sizeof(cpu_set_t), &cpuset);
+#else
+      pthread_setaffinity_np(handle, sizeof(cpu_set_t), &cpuset);
+#endif
+    };
+    for (unsigned i = 0; i < threads_.size(); ++i) {
+      bind_to_node(threads_[i].native_handle(), node_of_worker(i + exclude_worker0));
+    }
+    if (exclude_worker0) {  // main thread runs task 0
+      bind_to_node(pthread_self(), node_of_worker(0));
+    }
+#endif
+  }
+
+  // Pin every thread of this pool inside its group's core slice. Workers get
+  // one core each while the slice lasts and wrap modulo afterwards; surplus
+  // threads beyond num_workers_used stay parked and never run tasks, but
+  // keeping them inside the slice guarantees the pool can never spill onto a
+  // sibling group's cores.
+  void SetGroupAffinity(bool exclude_worker0, int group_index, int chunk) {
+#if defined(__linux__) || defined(__ANDROID__)
+    const int base = group_index * chunk;
+    auto core_in_slice = [&](int i) {
+      return sorted_order_[base + (i % chunk)];
+    };
+    for (unsigned i = 0; i < threads_.size(); ++i) {
+      cpu_set_t cpuset;
+      CPU_ZERO(&cpuset);
+      CPU_SET(core_in_slice(i + exclude_worker0), &cpuset);
+#if defined(__ANDROID__)
+      sched_setaffinity(threads_[i].native_handle(), sizeof(cpu_set_t), &cpuset);
+#else
+      pthread_setaffinity_np(threads_[i].native_handle(), sizeof(cpu_set_t), &cpuset);
+#endif
+    }
+    if (exclude_worker0) {  // main thread runs task 0: let it float in the slice
+      cpu_set_t cpuset;
+      CPU_ZERO(&cpuset);
+      for (int c = 0; c < chunk; ++c) {
+        CPU_SET(sorted_order_[base + c], &cpuset);
+      }
+#if defined(__ANDROID__)
+      sched_setaffinity(pthread_self(), sizeof(cpu_set_t), &cpuset);
+#else
+      pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+#endif
+    }
+#endif
+  }
+
+  // Discover NUMA topology from sysfs; leaves numa_nodes_ empty when the
+  // platform exposes none (single node systems count as none).
+  void InitNumaTopology() {
+#if defined(__linux__) || defined(__ANDROID__)
+    for (int node = 0;; ++node) {
+      std::ostringstream filepath;
+      filepath << "/sys/devices/system/node/node" << node << "/cpulist";
+      std::ifstream ifs(filepath.str());
+      if (ifs.fail()) break;
+      std::string cpulist;
+      std::getline(ifs, cpulist);
+      std::vector<unsigned int> cpus;
+      std::istringstream iss(cpulist);
+      std::string token;
+      while (std::getline(iss, token, ',')) {
+        if (token.empty() || !isdigit(token[0])) continue;
+        size_t dash = token.find('-');
+        unsigned int begin = std::stoul(token.substr(0, dash));
+        unsigned int end = dash == std::string::npos ? begin : std::stoul(token.substr(dash + 1));
+        for (unsigned int cpu = begin; cpu <= end; ++cpu) {
+          cpus.push_back(cpu);
+        }
+      }
+      if (!cpus.empty()) {
+        numa_nodes_.push_back(std::move(cpus));
+      }
+    }
+    if (numa_nodes_.size() < 2) {
+      numa_nodes_.clear();
+    }
+#endif
+  }
+
   void InitSortedOrder() {
     unsigned int threads = std::thread::hardware_concurrency();
 #if defined(__hexagon__)
@@ -221,6 +349,8 @@ class ThreadGroup::Impl {
   int num_workers_;
   std::vector<std::thread> threads_;
   std::vector<unsigned int> sorted_order_;
+  // CPU ids of each NUMA node; empty when the host is single-node.
+  std::vector<std::vector<unsigned int>> numa_nodes_;
   int big_count_ = 0;
   int little_count_ = 0;
 };
@@ -231,8 +361,12 @@ ThreadGroup::ThreadGroup(int num_workers, std::function<void(int)> worker_callba
 ThreadGroup::~ThreadGroup() { delete impl_; }
 void ThreadGroup::Join() { impl_->Join(); }
 
-int ThreadGroup::Configure(AffinityMode mode, int nthreads, bool exclude_worker0) {
-  return impl_->Configure(mode, nthreads, exclude_worker0);
+int ThreadGroup::Configure(AffinityMode mode, int nthreads, bool exclude_worker0, int numa_node) {
+  return impl_->Configure(mode, nthreads, exclude_worker0, numa_node);
+}
+
+int ThreadGroup::ConfigureGroup(int group_index, int num_groups, bool exclude_worker0) {
+  return impl_->ConfigureGroup(group_index, num_groups, exclude_worker0);
 }
 
 void Yield() { std::this_thread::yield(); }
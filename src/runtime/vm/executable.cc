@@ -30,9 +30,11 @@
 #include <tvm/runtime/vm/vm.h>
 
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <thread>
 #include <random>
 #include <sstream>
 #include <utility>
@@ -97,6 +99,13 @@ PackedFunc Executable::GetFunction(const std::string& name, const ObjectPtr<Obje
       uint64_t byte_limit = args[1];
       MoveLateBoundConstantsToFile(path, static_cast<size_t>(byte_limit));
     });
+  } else if (name == "move_late_bound_consts_aligned") {
+    return PackedFunc([this](TVMArgs args, TVMRetValue* rv) {
+      CHECK_EQ(args.size(), 2);
+      std::string path = args[0];
+      uint64_t byte_limit = args[1];
+      MoveLateBoundConstantsToAlignedFile(path, static_cast<size_t>(byte_limit));
+    });
   } else if (name == "load_late_bound_consts") {
     return PackedFunc([this](TVMArgs args, TVMRetValue* rv) {
       CHECK_EQ(args.size(), 1);
@@ -307,7 +316,7 @@ void Executable::SaveVirtualDevicesSection(dmlc::Stream* strm) {
   strm->Write(host_device_index);
 }
 
-void Executable::MoveLateBoundConstantsToStream(dmlc::Stream* stream, size_t byte_limit) {
+Map<String, NDArray> Executable::MoveLateBoundConstantsToMap(size_t byte_limit) {
   ICHECK(late_bound_constant_names.empty());
   late_bound_constant_names.reserve(constants.size());
   Map<String, NDArray> map;
@@ -330,7 +339,11 @@ void Executable::MoveLateBoundConstantsToStream(dmlc::Stream* stream, size_t byt
   }
   VLOG(1) << "moved " << map.size() << " constants of " << total_late_bound_bytes
           << " bytes (out of " << constants.size() << " overall) to be late-bound";
-  runtime::SaveParams(stream, map);
+  return map;
+}
+
+void Executable::MoveLateBoundConstantsToStream(dmlc::Stream* stream, size_t byte_limit) {
+  runtime::SaveParams(stream, MoveLateBoundConstantsToMap(byte_limit));
 }
 
 void Executable::MoveLateBoundConstantsToFile(const std::string& path, size_t byte_limit) {
@@ -340,13 +353,20 @@ void Executable::MoveLateBoundConstantsToFile(const std::string& path, size_t by
   SaveBinaryToFile(path, bytes);
 }
 
+void Executable::MoveLateBoundConstantsToAlignedFile(const std::string& path, size_t byte_limit) {
+  runtime::SaveParamsAligned(path, MoveLateBoundConstantsToMap(byte_limit));
+}
+
 void Executable::LoadLateBoundConstantsFromStream(dmlc::Stream* stream) {
   if (late_bound_constant_names.empty()) {
     VLOG(1) << "Found no late-bound constants to load";
     return;
   }
+  ApplyLateBoundConstants(runtime::LoadParams(stream));
+}
+
+void Executable::ApplyLateBoundConstants(Map<String, NDArray> map) {
   ICHECK_EQ(late_bound_constant_names.size(), constants.size());
-  Map<String, NDArray> map = runtime::LoadParams(stream);
   VLOG(1) << "loaded " << map.size() << " late-bound constants";
   for (size_t const_index = 0; const_index < constants.size(); ++const_index) {
     if (!late_bound_constant_names[const_index].defined()) {
@@ -367,6 +387,22 @@ void Executable::LoadLateBoundConstantsFromStream(dmlc::Stream* stream) {
 }
 
 void Executable::LoadLateBoundConstantsFromFile(const std::string& path) {
+  if (late_bound_constant_names.empty()) {
+    VLOG(1) << "Found no late-bound constants to load";
+    return;
+  }
+  // Files written by MoveLateBoundConstantsToAlignedFile are memory-mapped so
+  // CPU constants alias the file pages instead of being eagerly materialized.
+  {
+    std::ifstream fs(path, std::ios::binary);
+    ICHECK(!fs.fail()) << "Cannot open constant file " << path;
+    uint64_t magic = 0;
+    fs.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    if (!fs.fail() && magic == runtime::kTVMNDArrayAlignedListMagic) {
+      ApplyLateBoundConstants(runtime::LoadParamsMmap(path));
+      return;
+    }
+  }
   std::string bytes;
   LoadBinaryFromFile(path, &bytes);
   dmlc::MemoryStringStream stream(&bytes);
@@ -1008,28 +1044,63 @@ void Executable::LoadCodeSection(dmlc::Stream* strm) {
 
   size_t num_funcs = static_cast<size_t>(sz);
   this->functions.resize(num_funcs);
+  // Reading the stream is inherently serial; pull the raw serialized form of
+  // every function first so instruction decode can fan out across threads.
+  std::vector<VMFunctionSerializer> loaded_funcs(num_funcs);
+  std::vector<std::vector<VMInstructionSerializer>> loaded_instrs(num_funcs);
   for (size_t i = 0; i < num_funcs; i++) {
-    // Load the function info.
-    VMFunctionSerializer loaded_func;
-    STREAM_CHECK(loaded_func.Load(strm), "code/function");
-
-    // Load the instructions.
-    std::vector<Instruction> instructions;
-    for (size_t j = 0; j < loaded_func.num_instructions; j++) {
-      VMInstructionSerializer instr;
-      std::vector<Index> instr_fields;
-      STREAM_CHECK(instr.Load(strm), "code/instruction");
-      instructions.push_back(DeserializeInstruction(instr));
+    STREAM_CHECK(loaded_funcs[i].Load(strm), "code/function");
+    loaded_instrs[i].resize(loaded_funcs[i].num_instructions);
+    for (size_t j = 0; j < loaded_funcs[i].num_instructions; j++) {
+      STREAM_CHECK(loaded_instrs[i][j].Load(strm), "code/instruction");
     }
+  }
 
-    // Create the VM function.
-    VMFunction vm_func =
-        VMFunction(loaded_func.name, loaded_func.params, instructions,
-                   loaded_func.register_file_size, loaded_func.param_device_indexes);
-    auto it = this->global_map.find(loaded_func.name);
-    ICHECK(it != this->global_map.end());
-    ICHECK_LE(it->second, this->global_map.size());
-    this->functions[it->second] = vm_func;
+  auto decode_range = [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      const VMFunctionSerializer& loaded_func = loaded_funcs[i];
+      std::vector<Instruction> instructions;
+      instructions.reserve(loaded_instrs[i].size());
+      for (const VMInstructionSerializer& instr : loaded_instrs[i]) {
+        instructions.push_back(DeserializeInstruction(instr));
+      }
+      VMFunction vm_func =
+          VMFunction(loaded_func.name, loaded_func.params, instructions,
+                     loaded_func.register_file_size, loaded_func.param_device_indexes);
+      auto it = this->global_map.find(loaded_func.name);
+      ICHECK(it != this->global_map.end());
+      ICHECK_LE(it->second, this->global_map.size());
+      this->functions[it->second] = vm_func;
+    }
+  };
+
+  size_t num_workers = std::min<size_t>(std::thread::hardware_concurrency(), num_funcs);
+  if (num_workers <= 1) {
+    decode_range(0, num_funcs);
+    return;
+  }
+  std::vector<std::thread> workers;
+  std::vector<std::exception_ptr> errors(num_workers);
+  workers.reserve(num_workers);
+  size_t chunk = (num_funcs + num_workers - 1) / num_workers;
+  for (size_t w = 0; w < num_workers; ++w) {
+    size_t begin = w * chunk;
+    size_t end = std::min(begin + chunk, num_funcs);
+    if (begin >= end) break;
+    workers.emplace_back([&, begin, end, w]() {
+      try {
+        decode_range(begin, end);
+      } catch (...) {
+        errors[w] = std::current_exception();
+      }
+    });
+  }
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  // Surface a decode failure the same way the serial path would.
+  for (const std::exception_ptr& error : errors) {
+    if (error) std::rethrow_exception(error);
   }
 }
 
@@ -28,6 +28,7 @@
 
 #include "naive_allocator.h"
 #include "pooled_allocator.h"
+#include "size_class_allocator.h"
 
 namespace tvm {
 namespace runtime {
@@ -130,6 +131,12 @@ Allocator* MemoryManager::GetOrCreateAllocator(Device dev, AllocatorType type) {
         alloc.reset(new PooledAllocator(dev));
         break;
       }
+      case kSizeClass: {
+        VLOG(1) << "New size-class allocator for " << DeviceName(dev.device_type) << "("
+                << dev.device_id << ")";
+        alloc.reset(new SizeClassAllocator(dev));
+        break;
+      }
       default:
         LOG(FATAL) << "Unknown allocator type: " << type;
     }
@@ -146,6 +153,63 @@ Allocator* MemoryManager::GetOrCreateAllocator(Device dev, AllocatorType type) {
   return alloc;
 }
 
+void MemoryManager::SetDeviceBudget(Device dev, size_t budget_bytes) {
+  MemoryManager* m = MemoryManager::Global();
+  std::lock_guard<std::mutex> lock(m->mu_);
+  if (budget_bytes == 0) {
+    m->budgets_.erase(dev);
+  } else {
+    m->budgets_[dev] = budget_bytes;
+  }
+}
+
+size_t MemoryManager::GetDeviceBudget(Device dev) {
+  MemoryManager* m = MemoryManager::Global();
+  std::lock_guard<std::mutex> lock(m->mu_);
+  auto it = m->budgets_.find(dev);
+  return it == m->budgets_.end() ? 0 : it->second;
+}
+
+size_t MemoryManager::UsedBytes(Device dev) {
+  MemoryManager* m = MemoryManager::Global();
+  std::lock_guard<std::mutex> lock(m->mu_);
+  auto it = m->allocators_.find(dev);
+  return it == m->allocators_.end() ? 0 : it->second->UsedMemory();
+}
+
+void MemoryManager::ReleaseUnused(Device dev) {
+  MemoryManager* m = MemoryManager::Global();
+  Allocator* alloc = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m->mu_);
+    auto it = m->allocators_.find(dev);
+    if (it == m->allocators_.end()) return;
+    alloc = it->second.get();
+  }
+  // Outside the manager lock: trimming frees through the device API and an
+  // allocator running its own OOM recovery may already hold its lock.
+  alloc->ReleaseUnused();
+}
+
+TVM_REGISTER_GLOBAL("runtime.memory_manager.SetDeviceBudget")
+    .set_body_typed([](int device_type, int device_id, int64_t budget_bytes) {
+      MemoryManager::SetDeviceBudget(Device{static_cast<DLDeviceType>(device_type), device_id},
+                                     static_cast<size_t>(budget_bytes));
+    });
+
+TVM_REGISTER_GLOBAL("runtime.memory_manager.UsedBytes")
+    .set_body_typed([](int device_type, int device_id) {
+      return static_cast<int64_t>(
+          MemoryManager::UsedBytes(Device{static_cast<DLDeviceType>(device_type), device_id}));
+    });
+
+// External frameworks sharing the process call this from their own OOM
+// paths so TVM's pools stop hoarding freed device blocks.
+TVM_REGISTER_GLOBAL("runtime.memory_manager.ReleaseUnused")
+    .set_body_typed([](int device_type, int device_id) {
+      MemoryManager::ReleaseUnused(Device{static_cast<DLDeviceType>(device_type), device_id});
+    });
+
 Allocator* MemoryManager::GetAllocator(Device dev) {
   MemoryManager* m = MemoryManager::Global();
   std::lock_guard<std::mutex> lock(m->mu_);
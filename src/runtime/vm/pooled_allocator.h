@@ -57,6 +57,17 @@ class PooledAllocator final : public Allocator {
     Buffer buf;
     buf.device = device_;
     buf.size = size;
+    // Budget pressure: trim the pool before growing past the cap, and fail
+    // the allocation if it would still exceed it. The cap applies to this
+    // allocator's accounted bytes; like the existing OOM recovery it leans
+    // on ReleaseAll's accounting, which restarts from the trimmed pool.
+    size_t budget = MemoryManager::GetDeviceBudget(device_);
+    if (budget != 0 && used_memory_.load(std::memory_order_relaxed) + size > budget) {
+      ReleaseAll();
+      ICHECK_LE(used_memory_.load(std::memory_order_relaxed) + size, budget)
+          << "Allocation of " << size << " bytes exceeds the device budget of " << budget
+          << " bytes (" << used_memory_.load(std::memory_order_relaxed) << " bytes in use)";
+    }
     try {
       buf.data = DeviceAPI::Get(device_)->AllocDataSpace(device_, size, alignment, type_hint);
     } catch (InternalError& err) {
@@ -82,6 +93,8 @@ class PooledAllocator final : public Allocator {
 
   size_t UsedMemory() const override { return used_memory_.load(std::memory_order_relaxed); }
 
+  void ReleaseUnused() override { ReleaseAll(); }
+
  private:
   void ReleaseAll() {
     std::lock_guard<std::recursive_mutex> lock(mu_);
@@ -69,6 +69,7 @@ PackedFunc VirtualMachineDebug::GetFunction(const std::string& name,
             invoke(arg_name);
           }
 
+          peak_pool_bytes_ = 0;
           prof_.operator*().Start();
           invoke(arg_name);
           prof_.operator*().Stop();
@@ -115,9 +116,16 @@ void VirtualMachineDebug::OpStartHook(Instruction instr) {
       }
       auto storage_obj = ReadRegister(instr.alloc_tensor.storage);
       auto storage = Downcast<Storage>(storage_obj);
+      int64_t nbytes = (instr.alloc_tensor.dtype.bits * instr.alloc_tensor.dtype.lanes + 7) / 8;
+      for (int64_t dim : shape) {
+        nbytes *= dim;
+      }
+      alloc_device_ = storage->buffer.device;
+      alloc_pending_ = true;
       prof_.operator*().StartCall(
           "VM::AllocTensor", storage->buffer.device,
-          {{"Argument Shapes", profiling::ShapeString(shape, instr.alloc_tensor.dtype)}});
+          {{"Argument Shapes", profiling::ShapeString(shape, instr.alloc_tensor.dtype)},
+           {"Allocated Bytes", ObjectRef(make_object<profiling::CountNode>(nbytes))}});
     } else if (instr.op == Opcode::AllocTensorReg) {
       auto storage_obj = ReadRegister(instr.alloc_tensor_reg.storage);
       auto storage = Downcast<Storage>(storage_obj);
@@ -133,8 +141,18 @@ void VirtualMachineDebug::OpStartHook(Instruction instr) {
       std::ostringstream shape;
       shape << DLDataType2String(instr.alloc_storage.dtype_hint) << "[" << size << "]";
       Device dev = GetDevice(instr.alloc_storage.device_index);
-      prof_.operator*().StartCall("VM::AllocStorage", dev,
-                                  {{"VM::Argument Shapes", String(shape.str())}});
+      // Pool used bytes before the allocation; together with the post-op
+      // value recorded in OpStopHook this shows which instruction grew the
+      // pool (a cached-page hit leaves the delta at zero).
+      Allocator* allocator = GetAllocator(instr.alloc_storage.device_index);
+      int64_t used_before = static_cast<int64_t>(allocator->UsedMemory());
+      alloc_device_ = dev;
+      alloc_pending_ = true;
+      prof_.operator*().StartCall(
+          "VM::AllocStorage", dev,
+          {{"VM::Argument Shapes", String(shape.str())},
+           {"Allocated Bytes", ObjectRef(make_object<profiling::CountNode>(size))},
+           {"Pool Bytes Before", ObjectRef(make_object<profiling::CountNode>(used_before))}});
     } else {
       prof_.operator*().StartCall("VM::UnknownOp", GetDevice(exec_->host_device_index), {});
     }
@@ -143,6 +161,18 @@ void VirtualMachineDebug::OpStartHook(Instruction instr) {
 
 void VirtualMachineDebug::OpStopHook() {
   if (prof_ && prof_.operator*().IsRunning()) {
+    if (alloc_pending_) {
+      alloc_pending_ = false;
+      // Post-op pool state: growth shows as Pool Bytes After > Before, and
+      // the running peak is the per-invocation high-water mark.
+      Allocator* allocator = MemoryManager::GetAllocator(alloc_device_);
+      int64_t used_after = static_cast<int64_t>(allocator->UsedMemory());
+      peak_pool_bytes_ = std::max(peak_pool_bytes_, used_after);
+      prof_.operator*().StopCall(
+          {{"Pool Bytes After", ObjectRef(make_object<profiling::CountNode>(used_after))},
+           {"Pool Peak Bytes", ObjectRef(make_object<profiling::CountNode>(peak_pool_bytes_))}});
+      return;
+    }
     prof_.operator*().StopCall();
   }
 }
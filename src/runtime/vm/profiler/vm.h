@@ -56,6 +56,12 @@ class VirtualMachineDebug : public VirtualMachine {
 
   std::unordered_map<Index, std::string> packed_index_map_;
   dmlc::optional<profiling::Profiler> prof_;
+  /*! \brief Device of the allocation instruction currently in flight. */
+  Device alloc_device_;
+  /*! \brief Whether the call being stopped is an allocation instruction. */
+  bool alloc_pending_{false};
+  /*! \brief High-water mark of allocator used bytes seen this invocation. */
+  int64_t peak_pool_bytes_{0};
 };
 
 }  // namespace vm
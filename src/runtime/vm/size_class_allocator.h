@@ -0,0 +1,227 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file runtime/vm/size_class_allocator.h
+ */
+#ifndef TVM_RUNTIME_VM_SIZE_CLASS_ALLOCATOR_H_
+#define TVM_RUNTIME_VM_SIZE_CLASS_ALLOCATOR_H_
+
+#include <tvm/runtime/device_api.h>
+#include <tvm/runtime/vm/memory_manager.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tvm {
+namespace runtime {
+namespace vm {
+
+/*!
+ * \brief Allocator with power-of-two size-class free lists and LRU trimming.
+ *
+ *  Unlike PooledAllocator, which keys its pool on the exact rounded request
+ *  size, requests are rounded up to the next power of two, so dynamic-shape
+ *  workloads with many near-duplicate sizes share a small number of free
+ *  lists instead of ballooning the cache. The total cached bytes are bounded
+ *  by a growth cap (TVM_VM_POOL_CACHE_LIMIT_BYTES, 0 disables the cap) with
+ *  least-recently-freed eviction, and a background thread trims buffers that
+ *  stayed unused for longer than TVM_VM_POOL_TRIM_SECONDS (default 30).
+ */
+class SizeClassAllocator final : public Allocator {
+ public:
+  static constexpr size_t kMinBlockSize = 4096;
+
+  explicit SizeClassAllocator(Device dev)
+      : Allocator(kSizeClass), used_memory_(0), cached_bytes_(0), device_(dev) {
+    if (const char* val = getenv("TVM_VM_POOL_CACHE_LIMIT_BYTES")) {
+      cache_limit_bytes_ = static_cast<size_t>(atoll(val));
+    }
+    if (const char* val = getenv("TVM_VM_POOL_TRIM_SECONDS")) {
+      trim_seconds_ = atoi(val);
+    }
+    if (trim_seconds_ > 0) {
+      trim_thread_ = std::thread([this]() { this->TrimLoop(); });
+    }
+  }
+
+  ~SizeClassAllocator() {
+    if (trim_thread_.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        exit_now_ = true;
+      }
+      trim_cv_.notify_all();
+      trim_thread_.join();
+    }
+    ReleaseAll();
+  }
+
+  Buffer Alloc(size_t nbytes, size_t alignment, DLDataType type_hint) override {
+    size_t size = SizeClassOf(nbytes);
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      FreeList& list = free_lists_[SizeClassIndex(size)];
+      if (!list.empty()) {
+        Buffer ret = list.back().buffer;
+        cached_bytes_ -= ret.size;
+        list.pop_back();
+        return ret;
+      }
+    }
+    Buffer buf;
+    buf.device = device_;
+    buf.size = size;
+    try {
+      buf.data = DeviceAPI::Get(device_)->AllocDataSpace(device_, size, alignment, type_hint);
+    } catch (InternalError& err) {
+      LOG(WARNING) << "SizeClassAllocator got InternalError during allocation: " << err.message();
+      LOG(WARNING) << "Trying to release all unused memory and reallocate...";
+      ReleaseAll();
+      buf.data = DeviceAPI::Get(device_)->AllocDataSpace(device_, size, alignment, type_hint);
+    }
+    used_memory_.fetch_add(size, std::memory_order_relaxed);
+    VLOG(1) << "allocate " << size << " B, used memory " << used_memory_ << " B";
+    return buf;
+  }
+
+  void Free(const Buffer& buffer) override {
+    std::vector<Buffer> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      FreeList& list = free_lists_[SizeClassIndex(buffer.size)];
+      list.push_back(CachedBuffer{buffer, std::chrono::steady_clock::now()});
+      cached_bytes_ += buffer.size;
+      // Enforce the growth cap by evicting the least recently freed buffers.
+      while (cache_limit_bytes_ != 0 && cached_bytes_ > cache_limit_bytes_) {
+        EvictOldestLocked(&evicted);
+      }
+    }
+    ReleaseBuffers(evicted);
+    VLOG(1) << "reclaim buffer " << buffer.size;
+  }
+
+  size_t UsedMemory() const override { return used_memory_.load(std::memory_order_relaxed); }
+
+  void ReleaseUnused() override { ReleaseAll(); }
+
+ private:
+  struct CachedBuffer {
+    Buffer buffer;
+    std::chrono::steady_clock::time_point freed_at;
+  };
+  using FreeList = std::deque<CachedBuffer>;
+  // 64 classes cover every possible power-of-two size on a 64-bit host.
+  static constexpr int kNumClasses = 64;
+
+  static size_t SizeClassOf(size_t nbytes) {
+    size_t size = kMinBlockSize;
+    while (size < nbytes) size <<= 1;
+    return size;
+  }
+
+  static int SizeClassIndex(size_t size) {
+    int index = 0;
+    while ((kMinBlockSize << index) < size) ++index;
+    ICHECK_LT(index, kNumClasses) << "allocation of " << size << " B exceeds the size-class range";
+    return index;
+  }
+
+  // Pop the oldest cached buffer across all classes; caller holds mu_.
+  void EvictOldestLocked(std::vector<Buffer>* evicted) {
+    FreeList* oldest_list = nullptr;
+    for (FreeList& list : free_lists_) {
+      if (list.empty()) continue;
+      if (oldest_list == nullptr || list.front().freed_at < oldest_list->front().freed_at) {
+        oldest_list = &list;
+      }
+    }
+    if (oldest_list == nullptr) return;
+    cached_bytes_ -= oldest_list->front().buffer.size;
+    evicted->push_back(oldest_list->front().buffer);
+    oldest_list->pop_front();
+  }
+
+  void ReleaseBuffers(const std::vector<Buffer>& buffers) {
+    for (const Buffer& buf : buffers) {
+      DeviceAPI::Get(buf.device)->FreeDataSpace(buf.device, buf.data);
+      used_memory_.fetch_sub(buf.size, std::memory_order_relaxed);
+    }
+  }
+
+  void ReleaseAll() {
+    std::vector<Buffer> buffers;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      for (FreeList& list : free_lists_) {
+        for (const CachedBuffer& cached : list) {
+          buffers.push_back(cached.buffer);
+        }
+        list.clear();
+      }
+      cached_bytes_ = 0;
+    }
+    ReleaseBuffers(buffers);
+    VLOG(1) << "release all buffers";
+  }
+
+  // Periodically release buffers that stayed cached for over trim_seconds_.
+  void TrimLoop() {
+    std::unique_lock<std::mutex> lock(mu_);
+    while (!exit_now_) {
+      trim_cv_.wait_for(lock, std::chrono::seconds(trim_seconds_));
+      if (exit_now_) break;
+      std::vector<Buffer> evicted;
+      auto deadline = std::chrono::steady_clock::now() - std::chrono::seconds(trim_seconds_);
+      for (FreeList& list : free_lists_) {
+        while (!list.empty() && list.front().freed_at < deadline) {
+          cached_bytes_ -= list.front().buffer.size;
+          evicted.push_back(list.front().buffer);
+          list.pop_front();
+        }
+      }
+      lock.unlock();
+      ReleaseBuffers(evicted);
+      lock.lock();
+    }
+  }
+
+  std::atomic<size_t> used_memory_;
+  size_t cached_bytes_;
+  size_t cache_limit_bytes_{0};
+  int trim_seconds_{30};
+  FreeList free_lists_[kNumClasses];
+  bool exit_now_{false};
+  std::thread trim_thread_;
+  std::condition_variable trim_cv_;
+  std::mutex mu_;
+  Device device_;
+};
+
+}  // namespace vm
+}  // namespace runtime
+}  // namespace tvm
+
+#endif  // TVM_RUNTIME_VM_SIZE_CLASS_ALLOCATOR_H_
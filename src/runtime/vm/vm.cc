@@ -26,6 +26,7 @@
 #include <tvm/runtime/container/adt.h>
 #include <tvm/runtime/data_type.h>
 #include <tvm/runtime/debug.h>
+#include <tvm/runtime/device_api.h>
 #include <tvm/runtime/logging.h>
 #include <tvm/runtime/memory.h>
 #include <tvm/runtime/object.h>
@@ -33,6 +34,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
 #include <vector>
@@ -278,16 +280,27 @@ inline Allocator* VirtualMachine::GetAllocator(Index device_index) const {
 }
 
 void VirtualMachine::PushFrame(Index arg_count, Index ret_pc, const VMFunction& vm_func) {
-  auto frame = VMFrame(ret_pc, func_index_, arg_count, code_, vm_func.register_file_size);
-  frames_.push_back(frame);
+  // Reuse the heap buffer of a completed frame's register file when one is
+  // available; resize only constructs empty ObjectRefs within the retained
+  // capacity, so deep call chains stop paying an allocation per invoke.
+  std::vector<ObjectRef> register_file;
+  if (!free_register_files_.empty()) {
+    register_file = std::move(free_register_files_.back());
+    free_register_files_.pop_back();
+  }
+  register_file.resize(vm_func.register_file_size);
+  frames_.emplace_back(ret_pc, func_index_, arg_count, code_, std::move(register_file));
 }
 
 Index VirtualMachine::PopFrame() {
   ICHECK_GT(frames_.size(), 0);
-  const VMFrame& fr = frames_.back();
+  VMFrame& fr = frames_.back();
   func_index_ = fr.func_index;
   code_ = fr.code;
   pc_ = fr.pc;
+  // Drop the object references but keep the allocation for the next frame.
+  fr.register_file.clear();
+  free_register_files_.push_back(std::move(fr.register_file));
   auto call_stack_size = frames_.size();
   frames_.pop_back();
   return call_stack_size;
@@ -340,9 +353,16 @@ void VirtualMachine::InvokePacked(Index packed_index, const PackedFunc& func, In
     }
   }
 
-  std::vector<TVMValue> values(arity);
-  std::vector<int> codes(arity);
-  runtime::TVMArgsSetter setter(values.data(), codes.data());
+  // Reuse the VM's scratch argument buffers: shape-computation chains call
+  // many tiny kernels, and two heap allocations per call cost more than the
+  // integer work inside them. RunLoop is single-threaded per VM instance.
+  if (arg_values_scratch_.size() < arity) {
+    arg_values_scratch_.resize(arity);
+    arg_codes_scratch_.resize(arity);
+  }
+  TVMValue* values = arg_values_scratch_.data();
+  int* codes = arg_codes_scratch_.data();
+  runtime::TVMArgsSetter setter(values, codes);
   int idx = 0;
   bool is_empty_output = false;
   for (Index i = 0; i < arg_count; i++) {
@@ -369,8 +389,20 @@ void VirtualMachine::InvokePacked(Index packed_index, const PackedFunc& func, In
   }
 
   if (!is_empty_output) {
+    // Shape-computation chains invoke many tiny kernels, where the PackedFunc
+    // body indirection and return handling dominate the scalar work inside;
+    // call the raw C entry point when the executable's library exposed one.
+    if (packed_index < static_cast<Index>(raw_funcs_.size()) &&
+        raw_funcs_[packed_index] != nullptr) {
+      TVMValue ret_value;
+      int ret_tcode = kTVMNullptr;
+      int ret = (*raw_funcs_[packed_index])(values, codes, static_cast<int>(arity), &ret_value,
+                                            &ret_tcode, nullptr);
+      ICHECK_EQ(ret, 0) << TVMGetLastError();
+      return;
+    }
     TVMRetValue rv;
-    func.CallPacked(TVMArgs(values.data(), codes.data(), arity), &rv);
+    func.CallPacked(TVMArgs(values, codes, arity), &rv);
   }
 }
 
@@ -399,6 +431,23 @@ void VirtualMachine::LoadExecutable(const ObjectPtr<Executable>& exec) {
   for (size_t i = 0; i < packed_funcs_.size(); ++i) {
     ICHECK(packed_funcs_[i] != nullptr) << "Packed function " << i << " is not initialized";
   }
+
+  // Resolve the raw C entry points when the library supports it (plain
+  // library-backed modules only, mirroring the graph executor fast path), so
+  // InvokePacked can skip PackedFunc marshalling for e.g. shape functions.
+  raw_funcs_.assign(packed_funcs_.size(), nullptr);
+  if (lib.defined() && std::strcmp(lib.operator->()->type_key(), "library") == 0) {
+    tvm::runtime::PackedFunc lookup =
+        lib.GetFunction(tvm::runtime::symbol::tvm_lookup_packed_c_func, false);
+    if (lookup != nullptr) {
+      for (const auto& it : exec_->primitive_map) {
+        void* sym = lookup(it.first);
+        if (sym != nullptr) {
+          raw_funcs_[it.second] = reinterpret_cast<TVMBackendPackedCFunc>(sym);
+        }
+      }
+    }
+  }
 }
 
 void VirtualMachine::Init(const std::vector<Device>& physical_devices,
@@ -427,6 +476,30 @@ void VirtualMachine::Init(const std::vector<Device>& physical_devices,
     devices_.push_back(*itr);
     allocators_.push_back(MemoryManager::GetOrCreateAllocator(*itr, alloc_types[i]));
   }
+
+  // Optional instruction-window lookahead: dispatch independent InvokePacked
+  // instructions onto TVM_VM_EXEC_STREAMS streams of the first non-CPU device
+  // so kernel launches overlap instead of serializing with interpretation.
+  const char* exec_streams = getenv("TVM_VM_EXEC_STREAMS");
+  int num_lanes = exec_streams ? atoi(exec_streams) : 0;
+  if (num_lanes > 1 && exec_streams_.empty()) {
+    auto itr = std::find_if(devices_.begin(), devices_.end(),
+                            [](const Device& dev) { return dev.device_type != kDLCPU; });
+    if (itr != devices_.end()) {
+      exec_stream_device_ = *itr;
+      DeviceAPI* api = DeviceAPI::Get(exec_stream_device_);
+      for (int i = 0; i < num_lanes; ++i) {
+        exec_streams_.push_back(api->CreateStream(exec_stream_device_));
+      }
+    }
+  }
+}
+
+VirtualMachine::~VirtualMachine() {
+  DeviceAPI* api = exec_streams_.empty() ? nullptr : DeviceAPI::Get(exec_stream_device_);
+  for (TVMStreamHandle stream : exec_streams_) {
+    api->FreeStream(exec_stream_device_, stream);
+  }
 }
 
 inline void VirtualMachine::WriteRegister(Index r, const ObjectRef& val) {
@@ -467,6 +540,116 @@ int64_t VirtualMachine::LoadScalarInt(Index r) const {
   return result;
 }
 
+bool VirtualMachine::TryInvokePackedMultiStream() {
+  // Byte range of a tensor argument; two instructions are independent when no
+  // output range of one overlaps any range of the other. Register disjointness
+  // alone is not enough since memory planning lets registers alias storage.
+  using ByteRange = std::pair<const char*, const char*>;
+  struct Member {
+    const Instruction* instr;
+    std::vector<ObjectRef> args;
+    std::vector<ByteRange> in_ranges;
+    std::vector<ByteRange> out_ranges;
+  };
+  auto overlaps = [](const ByteRange& a, const ByteRange& b) {
+    return a.first < b.second && b.first < a.second;
+  };
+  auto any_overlap = [&](const std::vector<ByteRange>& lhs, const std::vector<ByteRange>& rhs) {
+    for (const ByteRange& a : lhs) {
+      for (const ByteRange& b : rhs) {
+        if (overlaps(a, b)) return true;
+      }
+    }
+    return false;
+  };
+
+  std::vector<Member> group;
+  for (Index pc = pc_; group.size() < exec_streams_.size(); ++pc) {
+    const Instruction& ins = code_[pc];
+    if (ins.op != Opcode::InvokePacked) break;
+    ICHECK_LE(ins.packed_index, packed_funcs_.size());
+    Member member;
+    member.instr = &ins;
+    bool eligible = true;
+    for (Index i = 0; i < ins.arity; ++i) {
+      ObjectRef arg = ReadRegister(ins.packed_args[i]);
+      const auto* container = arg.as<NDArray::Container>();
+      if (container == nullptr) {
+        // Conservatively keep ADT and other non-tensor calls on the main path.
+        eligible = false;
+        break;
+      }
+      const DLTensor& tensor = container->dl_tensor;
+      const char* begin = static_cast<const char*>(tensor.data) + tensor.byte_offset;
+      ByteRange range(begin, begin + GetDataSize(tensor));
+      if (i < ins.arity - ins.output_size) {
+        member.in_ranges.push_back(range);
+      } else {
+        member.out_ranges.push_back(range);
+      }
+      member.args.push_back(arg);
+    }
+    if (eligible) {
+      for (const Member& prev : group) {
+        if (any_overlap(prev.out_ranges, member.in_ranges) ||
+            any_overlap(member.out_ranges, prev.in_ranges) ||
+            any_overlap(member.out_ranges, prev.out_ranges)) {
+          eligible = false;
+          break;
+        }
+      }
+    }
+    if (!eligible) break;
+    group.push_back(std::move(member));
+  }
+  if (group.size() < 2) return false;
+
+  DeviceAPI* api = DeviceAPI::Get(exec_stream_device_);
+  for (size_t lane = 0; lane < group.size(); ++lane) {
+    // Each lane first waits for work already enqueued on the default stream.
+    api->SyncStreamFromTo(exec_stream_device_, nullptr, exec_streams_[lane]);
+    api->SetStream(exec_stream_device_, exec_streams_[lane]);
+    const Instruction& ins = *group[lane].instr;
+    InvokePacked(ins.packed_index, packed_funcs_[ins.packed_index], ins.arity, ins.output_size,
+                 group[lane].args);
+  }
+  api->SetStream(exec_stream_device_, nullptr);
+  for (size_t lane = 0; lane < group.size(); ++lane) {
+    // Subsequent default-stream work waits for every lane of the group.
+    api->SyncStreamFromTo(exec_stream_device_, exec_streams_[lane], nullptr);
+  }
+  pc_ += static_cast<Index>(group.size());
+  return true;
+}
+
+// Threaded interpreter dispatch. When built with TVM_VM_COMPUTED_GOTO=1 on a
+// GNU-compatible compiler, the RunLoop switch is replaced by a computed-goto
+// table so each handler jumps straight to the next one, removing the shared
+// bounds-check-and-branch of switch dispatch that profiles show on
+// control-flow-heavy models. The macros keep one copy of the handler bodies.
+#if defined(TVM_VM_COMPUTED_GOTO) && TVM_VM_COMPUTED_GOTO && defined(__GNUC__)
+#define VM_DISPATCH_TABLE()                                                                     \
+  static const void* const kDispatchTable[] = {                                                 \
+      &&vm_lbl_Move,       &&vm_lbl_Ret,        &&vm_lbl_Invoke,      &&vm_lbl_InvokeClosure,   \
+      &&vm_lbl_InvokePacked, &&vm_lbl_AllocTensor, &&vm_lbl_AllocTensorReg, &&vm_lbl_AllocADT,  \
+      &&vm_lbl_AllocClosure, &&vm_lbl_GetField,  &&vm_lbl_If,          &&vm_lbl_LoadConst,      \
+      &&vm_lbl_Goto,       &&vm_lbl_GetTag,     &&vm_lbl_LoadConsti,  &&vm_lbl_Fatal,           \
+      &&vm_lbl_AllocStorage, &&vm_lbl_ShapeOf,  &&vm_lbl_ReshapeTensor, &&vm_lbl_DeviceCopy,    \
+      &&vm_lbl_KillRegister}
+#define VM_DISPATCH(op)                                                             \
+  if (static_cast<size_t>(op) >= sizeof(kDispatchTable) / sizeof(*kDispatchTable)) \
+    goto vm_lbl_Unknown;                                                            \
+  goto* kDispatchTable[static_cast<size_t>(op)];                                    \
+  if (true)
+#define VM_CASE(name) vm_lbl_##name
+#define VM_DEFAULT() vm_lbl_Unknown
+#else
+#define VM_DISPATCH_TABLE()
+#define VM_DISPATCH(op) switch (op)
+#define VM_CASE(name) case Opcode::name
+#define VM_DEFAULT() default
+#endif
+
 void VirtualMachine::RunLoop() {
   ICHECK(this->exec_);
   ICHECK(this->code_);
@@ -477,18 +660,19 @@ void VirtualMachine::RunLoop() {
     auto const& instr = code_[this->pc_];
     VLOG(2) << "Executing(" << pc_ << "): " << instr;
 
-    switch (instr.op) {
-      case Opcode::Move: {
+    VM_DISPATCH_TABLE();
+    VM_DISPATCH(instr.op) {
+      VM_CASE(Move): {
         ObjectRef from_obj;
         from_obj = ReadRegister(instr.from);
         WriteRegister(instr.dst, from_obj);
         pc_++;
         goto main_loop;
       }
-      case Opcode::Fatal: {
+      VM_CASE(Fatal): {
         throw std::runtime_error("VM encountered fatal error");
       }
-      case Opcode::LoadConst: {
+      VM_CASE(LoadConst): {
         bool is_not_cached = const_pool_.size() <= static_cast<size_t>(instr.const_index) ||
                              !const_pool_[instr.const_index].defined();
         if (is_not_cached) {
@@ -513,14 +697,14 @@ void VirtualMachine::RunLoop() {
         pc_++;
         goto main_loop;
       }
-      case Opcode::LoadConsti: {
+      VM_CASE(LoadConsti): {
         auto tensor = NDArray::Empty({1}, {kDLInt, 64, 1}, GetDevice(exec_->host_device_index));
         reinterpret_cast<int64_t*>(tensor->data)[0] = instr.load_consti.val;
         WriteRegister(instr.dst, tensor);
         pc_++;
         goto main_loop;
       }
-      case Opcode::Invoke: {
+      VM_CASE(Invoke): {
         std::vector<ObjectRef> args;
         for (Index i = 0; i < instr.num_args; ++i) {
           args.push_back(ReadRegister(instr.invoke_args_registers[i]));
@@ -529,7 +713,10 @@ void VirtualMachine::RunLoop() {
         frames_.back().caller_return_register = instr.dst;
         goto main_loop;
       }
-      case Opcode::InvokePacked: {
+      VM_CASE(InvokePacked): {
+        if (exec_streams_.size() > 1 && TryInvokePackedMultiStream()) {
+          goto main_loop;
+        }
         ICHECK_LE(instr.packed_index, packed_funcs_.size());
         const auto& func = packed_funcs_[instr.packed_index];
         const auto& arity = instr.arity;
@@ -562,7 +749,7 @@ void VirtualMachine::RunLoop() {
         pc_++;
         goto main_loop;
       }
-      case Opcode::InvokeClosure: {
+      VM_CASE(InvokeClosure): {
         auto object = ReadRegister(instr.closure);
         const auto* closure = object.as<VMClosureObj>();
         ICHECK(closure);
@@ -577,7 +764,7 @@ void VirtualMachine::RunLoop() {
         frames_.back().caller_return_register = instr.dst;
         goto main_loop;
       }
-      case Opcode::GetField: {
+      VM_CASE(GetField): {
         auto object = ReadRegister(instr.object);
         const auto& tuple = Downcast<ADT>(object);
         auto field = tuple[instr.field_index];
@@ -585,7 +772,7 @@ void VirtualMachine::RunLoop() {
         pc_++;
         goto main_loop;
       }
-      case Opcode::GetTag: {
+      VM_CASE(GetTag): {
         auto object = ReadRegister(instr.get_tag.object);
         const auto& adt = Downcast<ADT>(object);
         auto tag = adt.tag();
@@ -595,11 +782,11 @@ void VirtualMachine::RunLoop() {
         pc_++;
         goto main_loop;
       }
-      case Opcode::Goto: {
+      VM_CASE(Goto): {
         pc_ += instr.pc_offset;
         goto main_loop;
       }
-      case Opcode::If: {
+      VM_CASE(If): {
         int32_t test_val = LoadScalarInt(instr.if_op.test);
         int32_t target_val = LoadScalarInt(instr.if_op.target);
 
@@ -613,7 +800,7 @@ void VirtualMachine::RunLoop() {
 
         goto main_loop;
       }
-      case Opcode::AllocTensor: {
+      VM_CASE(AllocTensor): {
         OpStartHook(instr);
         auto shape = std::vector<int64_t>(instr.alloc_tensor.ndim);
 
@@ -634,7 +821,7 @@ void VirtualMachine::RunLoop() {
         pc_++;
         goto main_loop;
       }
-      case Opcode::AllocTensorReg: {
+      VM_CASE(AllocTensorReg): {
         OpStartHook(instr);
         Device cpu_dev = GetDevice(exec_->host_device_index);
         auto shape_obj = ReadRegister(instr.alloc_tensor_reg.shape_register);
@@ -653,7 +840,7 @@ void VirtualMachine::RunLoop() {
         pc_++;
         goto main_loop;
       }
-      case Opcode::AllocADT: {
+      VM_CASE(AllocADT): {
         std::vector<ObjectRef> fields;
         for (Index i = 0; i < instr.num_fields; ++i) {
           fields.push_back(ReadRegister(instr.datatype_fields[i]));
@@ -663,7 +850,7 @@ void VirtualMachine::RunLoop() {
         pc_++;
         goto main_loop;
       }
-      case Opcode::AllocClosure: {
+      VM_CASE(AllocClosure): {
         std::vector<ObjectRef> free_vars;
         for (Index i = 0; i < instr.num_freevar; i++) {
           free_vars.push_back(ReadRegister(instr.free_vars[i]));
@@ -672,7 +859,7 @@ void VirtualMachine::RunLoop() {
         pc_++;
         goto main_loop;
       }
-      case Opcode::AllocStorage: {
+      VM_CASE(AllocStorage): {
         OpStartHook(instr);
         auto size = LoadScalarInt(instr.alloc_storage.allocation_size);
         auto alignment = instr.alloc_storage.alignment;
@@ -691,7 +878,7 @@ void VirtualMachine::RunLoop() {
         pc_++;
         goto main_loop;
       }
-      case Opcode::ShapeOf: {
+      VM_CASE(ShapeOf): {
         auto input = ReadRegister(instr.shape_of.tensor);
         NDArray input_array = Downcast<NDArray>(input);
         int ndim = input_array->ndim;
@@ -706,7 +893,7 @@ void VirtualMachine::RunLoop() {
         pc_++;
         goto main_loop;
       }
-      case Opcode::Ret: {
+      VM_CASE(Ret): {
         // If we have hit the point from which we started
         // running, we should return to the caller breaking
         // the dispatch loop.
@@ -721,7 +908,7 @@ void VirtualMachine::RunLoop() {
           goto main_loop;
         }
       }
-      case Opcode::ReshapeTensor: {
+      VM_CASE(ReshapeTensor): {
         OpStartHook(instr);
         Device cpu_dev = GetDevice(exec_->host_device_index);
         auto tensor_obj = ReadRegister(instr.reshape_tensor.tensor);
@@ -745,7 +932,7 @@ void VirtualMachine::RunLoop() {
         pc_++;
         goto main_loop;
       }
-      case Opcode::DeviceCopy: {
+      VM_CASE(DeviceCopy): {
         OpStartHook(instr);
         auto tensor_src = ReadRegister(instr.device_copy.src);
         NDArray src_data = Downcast<NDArray>(tensor_src);
@@ -761,14 +948,14 @@ void VirtualMachine::RunLoop() {
         pc_++;
         goto main_loop;
       }
-      case Opcode::KillRegister: {
+      VM_CASE(KillRegister): {
         OpStartHook(instr);
         WriteRegister(instr.dst, ObjectRef());
         OpStopHook();
         pc_++;
         goto main_loop;
       }
-      default:
+      VM_DEFAULT():
         LOG(FATAL) << "Unknown instruction opcode: " << int(instr.op);
     }
   }
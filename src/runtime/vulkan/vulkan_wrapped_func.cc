@@ -104,6 +104,63 @@ void VulkanWrappedFunc::operator()(TVMArgs args, TVMRetValue* rv,
 
   // Otherwise, the more expensive deferred path.
   std::vector<ArgUnion64> pack_args_storage(pack_args, pack_args + num_pack_args_);
+
+  // Resolve the descriptor set for this exact buffer-binding signature. A
+  // cached set replays with no descriptor writes and no flush; a fresh set
+  // is written immediately (legal, nothing references it yet) and cached.
+  // Only when the pool is exhausted do we fall back to mutating the default
+  // set, which keeps the original synchronize-on-conflict semantics.
+  VkDescriptorSet target_set = pipeline->descriptor_set;
+  bool set_needs_deferred_init = true;
+  {
+    std::lock_guard<std::mutex> cache_lock(pipeline->descriptor_cache_mutex);
+    std::string signature;
+    signature.reserve(descriptor_buffers.size() * sizeof(VkDescriptorBufferInfo));
+    for (const VkDescriptorBufferInfo& binfo : descriptor_buffers) {
+      signature.append(reinterpret_cast<const char*>(&binfo), sizeof(binfo));
+    }
+    auto it = pipeline->descriptor_set_cache.find(signature);
+    if (it != pipeline->descriptor_set_cache.end()) {
+      target_set = it->second;
+      set_needs_deferred_init = false;
+    } else if (pipeline->allocated_sets < 1 + VulkanPipeline::kMaxDescriptorSets) {
+      VkDescriptorSetAllocateInfo alloc_info;
+      alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+      alloc_info.pNext = nullptr;
+      alloc_info.descriptorPool = pipeline->descriptor_pool;
+      alloc_info.descriptorSetCount = 1;
+      alloc_info.pSetLayouts = &(pipeline->descriptor_set_layout);
+      VkDescriptorSet fresh_set = VK_NULL_HANDLE;
+      if (vkAllocateDescriptorSets(device, &alloc_info, &fresh_set) == VK_SUCCESS) {
+        ++pipeline->allocated_sets;
+        pipeline->descriptor_set_cache.emplace(signature, fresh_set);
+        target_set = fresh_set;
+        set_needs_deferred_init = false;
+        // Write the fresh set right away; it is not referenced anywhere yet.
+        std::vector<VkWriteDescriptorSet> write_descriptor_sets;
+        write_descriptor_sets.resize(descriptor_buffers.size());
+        for (size_t i = 0; i < write_descriptor_sets.size(); i++) {
+          write_descriptor_sets[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+          write_descriptor_sets[i].pNext = 0;
+          write_descriptor_sets[i].dstSet = fresh_set;
+          write_descriptor_sets[i].dstBinding = i;
+          write_descriptor_sets[i].dstArrayElement = 0;
+          write_descriptor_sets[i].descriptorCount = 1;
+          write_descriptor_sets[i].pImageInfo = 0;
+          write_descriptor_sets[i].pBufferInfo = &(descriptor_buffers[i]);
+          write_descriptor_sets[i].pTexelBufferView = 0;
+          if (pipeline->use_ubo && i == write_descriptor_sets.size() - 1) {
+            write_descriptor_sets[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+          } else {
+            write_descriptor_sets[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+          }
+        }
+        vkUpdateDescriptorSets(device, write_descriptor_sets.size(), write_descriptor_sets.data(),
+                               0, 0);
+      }
+    }
+  }
+
   const auto& deferred_initializer = [&device, pipeline, descriptor_buffers]() {
     std::vector<VkWriteDescriptorSet> write_descriptor_sets;
     write_descriptor_sets.resize(descriptor_buffers.size());
@@ -128,14 +185,13 @@ void VulkanWrappedFunc::operator()(TVMArgs args, TVMRetValue* rv,
     vkUpdateDescriptorSets(device, write_descriptor_sets.size(), write_descriptor_sets.data(), 0,
                            0);
   };
-  const auto& deferred_kernel = [this, pipeline, wl, pack_args_storage, nbytes_scalars,
-                                 device_id](VulkanStreamState* state) {
+  const auto& deferred_kernel = [this, pipeline, wl, pack_args_storage, nbytes_scalars, device_id,
+                                 target_set](VulkanStreamState* state) {
     auto& device = VulkanDeviceAPI::Global()->device(device_id);
 
     vkCmdBindPipeline(state->cmd_buffer_, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline->pipeline);
     vkCmdBindDescriptorSets(state->cmd_buffer_, VK_PIPELINE_BIND_POINT_COMPUTE,
-                            pipeline->pipeline_layout, 0, 1, &(pipeline->descriptor_set), 0,
-                            nullptr);
+                            pipeline->pipeline_layout, 0, 1, &target_set, 0, nullptr);
 
     if (pipeline->use_ubo) {
       auto& ubo = device.ThreadLocalUniformBuffer(nbytes_scalars);
@@ -158,12 +214,18 @@ void VulkanWrappedFunc::operator()(TVMArgs args, TVMRetValue* rv,
                          1, &barrier_info, 0, nullptr, 0, nullptr);
   };
   VulkanStreamToken deferred_token;
-  deferred_token.descriptor_set_ = pipeline->descriptor_set;
+  deferred_token.descriptor_set_ = target_set;
   deferred_token.buffers_.resize(descriptor_buffers.size());
   for (size_t i = 0; i < descriptor_buffers.size(); ++i) {
     deferred_token.buffers_[i] = descriptor_buffers[i].buffer;
   }
-  device.ThreadLocalStream().LaunchDeferred(deferred_initializer, deferred_kernel, deferred_token);
+  if (!set_needs_deferred_init) {
+    // Cached or freshly written set: nothing to initialize at submit time.
+    device.ThreadLocalStream().LaunchDeferred([]() {}, deferred_kernel, deferred_token);
+  } else {
+    device.ThreadLocalStream().LaunchDeferred(deferred_initializer, deferred_kernel,
+                                              deferred_token);
+  }
 }
 
 VulkanModuleNode::~VulkanModuleNode() {
@@ -306,7 +368,11 @@ std::shared_ptr<VulkanPipeline> VulkanModuleNode::GetPipeline(size_t device_id,
     descrip_pool_cinfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
     descrip_pool_cinfo.pNext = nullptr;
     descrip_pool_cinfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
-    descrip_pool_cinfo.maxSets = 1;
+    // Room for the default set plus the per-binding-signature cache.
+    descrip_pool_cinfo.maxSets = 1 + VulkanPipeline::kMaxDescriptorSets;
+    for (auto& pool_size : descriptor_set_pool_sizes) {
+      pool_size.descriptorCount *= 1 + VulkanPipeline::kMaxDescriptorSets;
+    }
     descrip_pool_cinfo.poolSizeCount = descriptor_set_pool_sizes.size();
     descrip_pool_cinfo.pPoolSizes = descriptor_set_pool_sizes.data();
     VULKAN_CALL(
@@ -49,6 +49,21 @@ struct VulkanPipeline {
   VkPipeline pipeline{VK_NULL_HANDLE};
   VkDescriptorUpdateTemplateKHR descriptor_update_template{VK_NULL_HANDLE};
   bool use_ubo{false};
+  /*! \brief Extra descriptor sets the pool can still hand out. */
+  static constexpr uint32_t kMaxDescriptorSets = 8;
+  /*!
+   * \brief Persistent descriptor sets keyed by buffer-binding signature.
+   *
+   *  A kernel re-launched with bindings it has used before replays its
+   *  cached set: no descriptor writes, and - because a cached set is never
+   *  updated while referenced - no synchronization flush between launches
+   *  of the same kernel on different buffers.
+   */
+  std::unordered_map<std::string, VkDescriptorSet> descriptor_set_cache;
+  /*! \brief Sets allocated from descriptor_pool so far. */
+  uint32_t allocated_sets{1};
+  /*! \brief Guards the cache; pipelines are shared across threads. */
+  std::mutex descriptor_cache_mutex;
 };
 
 class VulkanModuleNode;
@@ -23,6 +23,8 @@
  */
 #include "workspace_pool.h"
 
+#include <cstdlib>
+
 #include <memory>
 
 namespace tvm {
@@ -52,6 +54,14 @@ class WorkspacePool::Pool {
     type.code = kDLUInt;
     type.bits = 8;
     type.lanes = 1;
+    // Steady-state fast path: a kernel invoked repeatedly re-requests the
+    // size it just released, so the most recently freed page satisfies the
+    // request in O(1) without touching the sorted free list.
+    if (mru_valid_ && mru_.size >= nbytes) {
+      mru_valid_ = false;
+      allocated_.push_back(mru_);
+      return mru_.data;
+    }
     if (free_list_.size() == 2) {
       e = free_list_.back();
       free_list_.pop_back();
@@ -99,6 +109,13 @@ class WorkspacePool::Pool {
       e = allocated_[index];
       allocated_.erase(allocated_.begin() + index);
     }
+    // Park the page in the MRU slot; the entry it displaces goes through the
+    // regular sorted insertion below.
+    std::swap(e, mru_);
+    if (!mru_valid_) {
+      mru_valid_ = true;
+      return;
+    }
     if (free_list_.back().size < e.size) {
       free_list_.push_back(e);
     } else if (free_list_.size() == 2) {
@@ -115,11 +132,29 @@ class WorkspacePool::Pool {
   }
   // Release all resources
   void Release(Device dev, DeviceAPI* device) {
+    ReleaseMRU(dev, device);
     for (size_t i = 1; i < free_list_.size(); ++i) {
       device->FreeDataSpace(dev, free_list_[i].data);
     }
     free_list_.clear();
   }
+  // Release the free pages but keep the pool (and outstanding allocations)
+  // usable; the next Alloc simply repopulates from the device.
+  void ReleaseFree(Device dev, DeviceAPI* device) {
+    ReleaseMRU(dev, device);
+    for (size_t i = 1; i < free_list_.size(); ++i) {
+      device->FreeDataSpace(dev, free_list_[i].data);
+    }
+    free_list_.resize(1);
+  }
+  // Total bytes sitting on the free list.
+  size_t FreeBytes() const {
+    size_t total = mru_valid_ ? mru_.size : 0;
+    for (size_t i = 1; i < free_list_.size(); ++i) {
+      total += free_list_[i].size;
+    }
+    return total;
+  }
 
  private:
   /*! \brief a single entry in the pool */
@@ -127,6 +162,18 @@ class WorkspacePool::Pool {
     void* data;
     size_t size;
   };
+  // Give the most recently freed page back to the device.
+  void ReleaseMRU(Device dev, DeviceAPI* device) {
+    if (mru_valid_) {
+      device->FreeDataSpace(dev, mru_.data);
+      mru_valid_ = false;
+    }
+  }
+
+  /*! \brief The most recently freed entry, first candidate for reuse. */
+  Entry mru_{nullptr, 0};
+  /*! \brief Whether mru_ holds a live free page. */
+  bool mru_valid_{false};
   /*! \brief List of free items, sorted from small to big size */
   std::vector<Entry> free_list_;
   /*! \brief List of allocated items */
@@ -161,6 +208,21 @@ void* WorkspacePool::AllocWorkspace(Device dev, size_t size) {
 void WorkspacePool::FreeWorkspace(Device dev, void* ptr) {
   ICHECK(static_cast<size_t>(dev.device_id) < array_.size() && array_[dev.device_id] != nullptr);
   array_[dev.device_id]->Free(ptr);
+  // Optional high-water trim: once the free list exceeds the configured
+  // limit, give the spare pages back to the device right away.
+  static size_t trim_bytes = []() -> size_t {
+    const char* val = getenv("TVM_WORKSPACE_POOL_TRIM_BYTES");
+    return val ? static_cast<size_t>(atoll(val)) : 0;
+  }();
+  if (trim_bytes != 0 && array_[dev.device_id]->FreeBytes() > trim_bytes) {
+    array_[dev.device_id]->ReleaseFree(dev, device_);
+  }
+}
+
+void WorkspacePool::ReleaseFreeMemory(Device dev) {
+  if (static_cast<size_t>(dev.device_id) < array_.size() && array_[dev.device_id] != nullptr) {
+    array_[dev.device_id]->ReleaseFree(dev, device_);
+  }
 }
 
 }  // namespace runtime
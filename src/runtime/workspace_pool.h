@@ -65,6 +65,13 @@ class TVM_DLL WorkspacePool {
    * \param ptr The pointer to be freed.
    */
   void FreeWorkspace(Device dev, void* ptr);
+  /*!
+   * \brief Release every free (not currently allocated) page back to the
+   * device, so long-running services can return workspace memory between
+   * traffic peaks. Outstanding workspaces stay valid.
+   * \param dev The device whose free pages are released.
+   */
+  void ReleaseFreeMemory(Device dev);
 
  private:
   class Pool;
@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "generic_arena.h"
 
@@ -37,6 +38,12 @@ namespace support {
 
 /*!
  * \brief Simple page allocator that uses new and delete.
+ *
+ *  Standard-size pages are recycled through a bounded thread-local cache:
+ *  pass-heavy builds construct thousands of short-lived arenas, and with
+ *  the cache warm an arena's first page is a pointer pop instead of a heap
+ *  round trip. Oversized pages and overflow beyond the cache bound still
+ *  go back to the system allocator.
  */
 class SimplePageAllocator {
  public:
@@ -48,6 +55,13 @@ class SimplePageAllocator {
    */
   ArenaPageHeader* allocate(size_t min_size) {
     size_t npages = ((min_size + kPageSize - 1) / kPageSize);
+    if (npages == 1 && !PageCacheDestroyed() && !Cache().empty()) {
+      ArenaPageHeader* header = Cache().back();
+      Cache().pop_back();
+      header->size = kPageSize;
+      header->offset = sizeof(ArenaPageHeader);
+      return header;
+    }
     ArenaPageHeader* header = reinterpret_cast<ArenaPageHeader*>(new Page[npages]);
     header->size = npages * kPageSize;
     header->offset = sizeof(ArenaPageHeader);
@@ -57,7 +71,13 @@ class SimplePageAllocator {
    * \brief De-allocate an allocate page.
    * \param page The page to be de-allocated.
    */
-  void deallocate(ArenaPageHeader* page) { delete[] reinterpret_cast<Page*>(page); }
+  void deallocate(ArenaPageHeader* page) {
+    if (page->size == kPageSize && !PageCacheDestroyed() && Cache().size() < kMaxCachedPages) {
+      Cache().push_back(page);
+      return;
+    }
+    delete[] reinterpret_cast<Page*>(page);
+  }
 
   static const constexpr int kPageSize = 16 << 10;
   static const constexpr int kPageAlign = 1024;
@@ -66,6 +86,29 @@ class SimplePageAllocator {
   // page size 16 KB
   // The page data type;
   using Page = std::aligned_storage<kPageSize, kPageAlign>::type;
+  // Bound the per-thread cache at 64 pages (1 MB).
+  static const constexpr size_t kMaxCachedPages = 64;
+
+  struct PageCacheStorage : public std::vector<ArenaPageHeader*> {
+    ~PageCacheStorage() {
+      for (ArenaPageHeader* page : *this) {
+        delete[] reinterpret_cast<Page*>(page);
+      }
+      // The sentinel outlives this cache object, so late frees at thread
+      // exit observe it and bypass the destroyed cache.
+      PageCacheDestroyed() = true;
+    }
+  };
+
+  static std::vector<ArenaPageHeader*>& Cache() {
+    static thread_local PageCacheStorage cache;
+    return cache;
+  }
+
+  static bool& PageCacheDestroyed() {
+    static thread_local bool destroyed = false;
+    return destroyed;
+  }
 };
 
 using Arena = GenericArena<SimplePageAllocator>;
@@ -0,0 +1,171 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file compression.h
+ * \brief Dependency-free byte-oriented LZ77 compression.
+ *
+ *  Used to compress RPC payloads in flight between TVM peers; the format is
+ *  internal and both sides of a connection must use this implementation.
+ *  Greedy single-pass match search over a 64 KiB window, tuned for the highly
+ *  repetitive payloads we ship during tuning (ELF kernel binaries, serialized
+ *  modules), not for general-purpose ratios.
+ */
+#ifndef TVM_SUPPORT_COMPRESSION_H_
+#define TVM_SUPPORT_COMPRESSION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace tvm {
+namespace support {
+
+namespace detail {
+
+constexpr size_t kLZWindowSize = 1 << 16;
+constexpr size_t kLZMinMatch = 4;
+constexpr size_t kLZMaxMatch = 259;  // kLZMinMatch + 255
+constexpr size_t kLZHashBits = 15;
+
+inline uint32_t LZHash(const unsigned char* p) {
+  uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return (v * 2654435761u) >> (32 - kLZHashBits);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Compress a byte buffer.
+ *
+ *  Output layout: groups of up to eight items preceded by a flag byte whose
+ *  i-th bit selects literal (0: one raw byte) or match (1: 16-bit little
+ *  endian backward distance followed by one byte encoding length - 4).
+ * \param data The input bytes.
+ * \param size Number of input bytes.
+ * \return The compressed bytes (may be larger than the input for
+ *         incompressible data; callers should keep the raw form then).
+ */
+inline std::string CompressBytes(const char* data, size_t size) {
+  using namespace detail;
+  const unsigned char* in = reinterpret_cast<const unsigned char*>(data);
+  std::string out;
+  out.reserve(size / 2 + 16);
+  std::vector<uint32_t> head(size_t(1) << kLZHashBits, 0xFFFFFFFFu);
+
+  size_t pos = 0;
+  size_t flag_pos = 0;
+  int flag_bit = 8;  // forces a fresh flag byte on first item
+  unsigned char flag = 0;
+  auto begin_item = [&]() {
+    if (flag_bit == 8) {
+      if (!out.empty() || pos != 0) out[flag_pos] = static_cast<char>(flag);
+      flag_pos = out.size();
+      out.push_back(0);
+      flag = 0;
+      flag_bit = 0;
+    }
+  };
+  while (pos < size) {
+    size_t best_len = 0;
+    size_t best_dist = 0;
+    if (pos + kLZMinMatch <= size) {
+      uint32_t h = LZHash(in + pos);
+      uint32_t cand = head[h];
+      if (cand != 0xFFFFFFFFu && cand < pos && pos - cand <= kLZWindowSize) {
+        size_t limit = size - pos;
+        if (limit > kLZMaxMatch) limit = kLZMaxMatch;
+        size_t len = 0;
+        while (len < limit && in[cand + len] == in[pos + len]) ++len;
+        if (len >= kLZMinMatch) {
+          best_len = len;
+          best_dist = pos - cand;
+        }
+      }
+      head[h] = static_cast<uint32_t>(pos);
+    }
+    begin_item();
+    if (best_len != 0) {
+      flag |= static_cast<unsigned char>(1u << flag_bit);
+      out.push_back(static_cast<char>(best_dist & 0xFF));
+      out.push_back(static_cast<char>((best_dist >> 8) & 0xFF));
+      out.push_back(static_cast<char>(best_len - kLZMinMatch));
+      // Index the interior of the match so later data can still find it.
+      size_t end = pos + best_len;
+      for (size_t p = pos + 1; p + kLZMinMatch <= size && p < end; ++p) {
+        head[LZHash(in + p)] = static_cast<uint32_t>(p);
+      }
+      pos = end;
+    } else {
+      out.push_back(static_cast<char>(in[pos]));
+      ++pos;
+    }
+    ++flag_bit;
+  }
+  if (flag_bit != 0 && !out.empty()) {
+    out[flag_pos] = static_cast<char>(flag);
+  }
+  return out;
+}
+
+/*!
+ * \brief Decompress a buffer produced by CompressBytes.
+ * \param data The compressed bytes.
+ * \param size Number of compressed bytes.
+ * \param raw_size The expected decompressed size.
+ * \param out Receives exactly raw_size decompressed bytes on success.
+ * \return Whether decompression succeeded and produced raw_size bytes.
+ */
+inline bool DecompressBytes(const char* data, size_t size, size_t raw_size, std::string* out) {
+  using namespace detail;
+  const unsigned char* in = reinterpret_cast<const unsigned char*>(data);
+  out->clear();
+  out->reserve(raw_size);
+  size_t pos = 0;
+  while (out->size() < raw_size) {
+    if (pos >= size) return false;
+    unsigned char flag = in[pos++];
+    for (int bit = 0; bit < 8 && out->size() < raw_size; ++bit) {
+      if (flag & (1u << bit)) {
+        if (pos + 3 > size) return false;
+        size_t dist = static_cast<size_t>(in[pos]) | (static_cast<size_t>(in[pos + 1]) << 8);
+        size_t len = static_cast<size_t>(in[pos + 2]) + kLZMinMatch;
+        pos += 3;
+        if (dist == 0 || dist > out->size() || out->size() + len > raw_size) return false;
+        // Byte-by-byte copy: overlapping matches replicate earlier output.
+        size_t from = out->size() - dist;
+        for (size_t i = 0; i < len; ++i) {
+          out->push_back((*out)[from + i]);
+        }
+      } else {
+        if (pos >= size) return false;
+        out->push_back(static_cast<char>(in[pos++]));
+      }
+    }
+  }
+  return pos == size && out->size() == raw_size;
+}
+
+}  // namespace support
+}  // namespace tvm
+
+#endif  // TVM_SUPPORT_COMPRESSION_H_
@@ -47,6 +47,11 @@ std::vector<std::vector<int>> rr_partitioner(int begin, int end, int step, int n
   return ret;
 }
 
+std::mutex& ParallelForMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
 void parallel_for(int begin, int end, const std::function<void(int)>& f, int step,
                   const PartitionerFuncType partitioner) {
   static bool GLOBAL_PARALLEL_FOR_FLAG{false};
@@ -0,0 +1,760 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file llvm_module.cc
+ * \brief LLVM runtime module for TVM
+ */
+#ifdef TVM_LLVM_VERSION
+
+#include <tvm/ir/module.h>
+#include <tvm/relay/runtime.h>
+#include <tvm/runtime/packed_func.h>
+#include <tvm/runtime/registry.h>
+#include <tvm/target/codegen.h>
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Object/ObjectFile.h>
+#include <llvm/Object/SymbolSize.h>
+
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "../../runtime/file_utils.h"
+#include "../../runtime/library_module.h"
+#include "../func_registry_generator.h"
+#include "codegen_blob.h"
+#include "codegen_cpu.h"
+#include "codegen_llvm.h"
+#include "llvm_common.h"
+
+namespace tvm {
+namespace codegen {
+
+/*!
+ * \brief On-disk MCJIT object cache keyed by the hash of the LLVM IR.
+ *
+ *  Enabled by pointing TVM_LLVM_OBJ_CACHE_DIR at an existing directory: the
+ *  engine consults it before running codegen, so re-JITing an identical
+ *  module (tuning loops rebuild thousands of near-identical kernels) becomes
+ *  a file load. The module's full IR is stored next to the object and
+ *  compared on hit, so a hash collision degrades to a plain miss.
+ */
+class LLVMDiskObjectCache : public llvm::ObjectCache {
+ public:
+  static llvm::ObjectCache* Global() {
+    static const char* dir = getenv("TVM_LLVM_OBJ_CACHE_DIR");
+    static LLVMDiskObjectCache* inst = dir && dir[0] ? new LLVMDiskObjectCache(dir) : nullptr;
+    return inst;
+  }
+
+  void notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef obj) override {
+    std::string ir = ModuleIR(module);
+    std::ofstream obj_fs(ObjectPath(ir), std::ios::binary);
+    if (obj_fs.fail()) return;
+    obj_fs.write(obj.getBufferStart(), obj.getBufferSize());
+    std::ofstream ir_fs(IRPath(ir), std::ios::binary);
+    if (ir_fs.fail()) return;
+    ir_fs << ir;
+  }
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override {
+    std::string ir = ModuleIR(module);
+    {
+      // The stored IR must match exactly; otherwise treat as a miss.
+      std::ifstream ir_fs(IRPath(ir), std::ios::binary);
+      if (ir_fs.fail()) return nullptr;
+      std::stringstream ss;
+      ss << ir_fs.rdbuf();
+      if (ss.str() != ir) return nullptr;
+    }
+    // Use the defaulted overload: the meaning of the second parameter differs
+    // across the LLVM versions TVM supports.
+    auto buffer = llvm::MemoryBuffer::getFile(ObjectPath(ir));
+    if (!buffer) return nullptr;
+    return std::move(*buffer);
+  }
+
+ private:
+  explicit LLVMDiskObjectCache(std::string dir) : dir_(std::move(dir)) {}
+
+  static std::string ModuleIR(const llvm::Module* module) {
+    std::string ir;
+    llvm::raw_string_ostream os(ir);
+    module->print(os, nullptr);
+    os.flush();
+    return ir;
+  }
+
+  std::string KeyOf(const std::string& ir) const {
+    std::ostringstream os;
+    os << std::hex << std::hash<std::string>()(ir);
+    return os.str();
+  }
+
+  std::string ObjectPath(const std::string& ir) const { return dir_ + "/" + KeyOf(ir) + ".o"; }
+  std::string IRPath(const std::string& ir) const { return dir_ + "/" + KeyOf(ir) + ".ll"; }
+
+  std::string dir_;
+};
+
+using runtime::PackedFunc;
+using runtime::TVMArgs;
+using runtime::TVMRetValue;
+
+class LLVMModuleNode final : public runtime::ModuleNode {
+ public:
+  ~LLVMModuleNode() {
+    module_.reset();
+    if (ee_ != nullptr) {
+      ee_->runStaticConstructorsDestructors(true);
+      delete ee_;
+    }
+  }
+
+  const char* type_key() const { return "llvm"; }
+
+  PackedFunc GetFunction(const std::string& name, const ObjectPtr<Object>& sptr_to_self) final {
+    if (name == "__tvm_is_system_module") {
+      bool flag = (mptr_->getFunction("__tvm_module_startup") != nullptr);
+      return PackedFunc([flag](TVMArgs args, TVMRetValue* rv) { *rv = flag; });
+    } else if (name == "get_func_names") {
+      return PackedFunc(
+          [sptr_to_self, this](TVMArgs args, TVMRetValue* rv) { *rv = this->function_names_; });
+    } else if (name == "get_function_sizes") {
+      // Per-symbol generated-code sizes from an in-memory object emission,
+      // so size regressions surface at build time instead of link time.
+      return PackedFunc([sptr_to_self, this](TVMArgs args, TVMRetValue* rv) {
+        *rv = this->GetFunctionSizes();
+      });
+    } else if (name == "get_symbol") {
+      return PackedFunc(nullptr);
+    } else if (name == "get_const_vars") {
+      return PackedFunc(nullptr);
+    } else if (name == "_get_target_triple") {
+      std::ostringstream target_triple_ss;
+      target_triple_ss << tm_->getTargetTriple().str();
+      // getTargetTriple() doesn't include other flags besides the triple. Add back flags which are
+      // important for ModulePackImportsToLLVM.
+      if (tm_->Options.FloatABIType == llvm::FloatABI::ABIType::Soft) {
+        target_triple_ss << " -mfloat-abi=soft";
+      }
+      std::string mabi = tm_->Options.MCOptions.ABIName;
+      if (!mabi.empty()) {
+        target_triple_ss << " -mabi=" << mabi;
+      }
+      llvm::StringRef mcpu = tm_->getTargetCPU();
+      if (!mcpu.empty() && mcpu != "generic") {
+        target_triple_ss << " -mcpu=" << mcpu.str();
+      }
+      std::string target_triple = target_triple_ss.str();
+      return PackedFunc([target_triple](TVMArgs args, TVMRetValue* rv) { *rv = target_triple; });
+    }
+    if (ee_ == nullptr) LazyInitJIT();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    TVMBackendPackedCFunc faddr;
+    if (name == runtime::symbol::tvm_module_main) {
+      const char* entry_name =
+          reinterpret_cast<const char*>(GetGlobalAddr(runtime::symbol::tvm_module_main));
+      ICHECK(entry_name != nullptr)
+          << "Symbol " << runtime::symbol::tvm_module_main << " is not presented";
+      faddr = reinterpret_cast<TVMBackendPackedCFunc>(GetFunctionAddr(entry_name));
+    } else {
+      faddr = reinterpret_cast<TVMBackendPackedCFunc>(GetFunctionAddr(name));
+    }
+    if (faddr == nullptr) return PackedFunc();
+    return WrapPackedFunc(faddr, sptr_to_self);
+  }
+
+  void SaveToFile(const std::string& file_name, const std::string& format) final {
+    std::string fmt = runtime::GetFileFormat(file_name, format);
+    std::error_code ecode;
+#if TVM_LLVM_VERSION <= 70
+    llvm::raw_fd_ostream dest(file_name, ecode, llvm::sys::fs::F_None);
+#else
+    llvm::raw_fd_ostream dest(file_name, ecode, llvm::sys::fs::OF_None);
+#endif
+    ICHECK_EQ(ecode.value(), 0) << "Cannot open file: " << file_name << " " << ecode.message();
+    if (fmt == "o" || fmt == "obj") {
+#if TVM_LLVM_VERSION <= 60
+      std::unique_ptr<llvm::Module> m = llvm::CloneModule(mptr_);
+#else
+      std::unique_ptr<llvm::Module> m = llvm::CloneModule(*mptr_);
+#endif
+      llvm::legacy::PassManager pass;
+      ICHECK(tm_);
+#if TVM_LLVM_VERSION <= 60
+      ICHECK(tm_->addPassesToEmitFile(pass, dest, llvm::TargetMachine::CGFT_ObjectFile) == 0)
+          << "Cannot emit target CGFT_ObjectFile";
+#elif TVM_LLVM_VERSION <= 90
+      ICHECK(tm_->addPassesToEmitFile(pass, dest, nullptr, llvm::TargetMachine::CGFT_ObjectFile) ==
+             0)
+          << "Cannot emit target CGFT_ObjectFile";
+#else
+      ICHECK(tm_->addPassesToEmitFile(pass, dest, nullptr, llvm::CGFT_ObjectFile) == 0)
+          << "Cannot emit target CGFT_ObjectFile";
+#endif
+      pass.run(*m);
+    } else if (fmt == "s" || fmt == "asm") {
+#if TVM_LLVM_VERSION <= 60
+      std::unique_ptr<llvm::Module> m = llvm::CloneModule(mptr_);
+#else
+      std::unique_ptr<llvm::Module> m = llvm::CloneModule(*mptr_);
+#endif
+      llvm::legacy::PassManager pass;
+      ICHECK(tm_);
+#if TVM_LLVM_VERSION <= 60
+      ICHECK(tm_->addPassesToEmitFile(pass, dest, llvm::TargetMachine::CGFT_AssemblyFile) == 0)
+          << "Cannot emit target CGFT_AssemblyFile";
+#elif TVM_LLVM_VERSION <= 90
+      ICHECK(tm_->addPassesToEmitFile(pass, dest, nullptr,
+                                      llvm::TargetMachine::CGFT_AssemblyFile) == 0)
+          << "Cannot emit target CGFT_AssemblyFile";
+#else
+      ICHECK(tm_->addPassesToEmitFile(pass, dest, nullptr, llvm::CGFT_AssemblyFile) == 0)
+          << "Cannot emit target CGFT_AssemblyFile";
+#endif
+      pass.run(*m);
+    } else if (fmt == "ll") {
+      mptr_->print(dest, nullptr);
+    } else if (fmt == "bc") {
+#if TVM_LLVM_VERSION <= 60
+      llvm::WriteBitcodeToFile(mptr_, dest);
+#else
+      llvm::WriteBitcodeToFile(*mptr_, dest);
+#endif
+    } else {
+      LOG(FATAL) << "Do not know how to save file " << file_name << " with format=\'" << format
+                 << "\'";
+    }
+    dest.close();
+  }
+
+  void SaveToBinary(dmlc::Stream* stream) final {
+    LOG(FATAL) << "LLVMModule: SaveToBinary not supported";
+  }
+
+  std::string GetSource(const std::string& format) final {
+    std::string fmt = runtime::GetFileFormat("", format);
+    std::string type_str;
+    llvm::SmallString<256> str;
+    llvm::raw_svector_ostream rso(str);
+
+    if (fmt == "s" || fmt == "asm") {
+#if TVM_LLVM_VERSION <= 60
+      std::unique_ptr<llvm::Module> m = llvm::CloneModule(mptr_);
+#else
+      std::unique_ptr<llvm::Module> m = llvm::CloneModule(*mptr_);
+#endif
+      llvm::legacy::PassManager pass;
+      ICHECK(tm_);
+#if TVM_LLVM_VERSION <= 60
+      ICHECK(tm_->addPassesToEmitFile(pass, rso, llvm::TargetMachine::CGFT_AssemblyFile) == 0)
+          << "Cannot emit target CGFT_AssemblyFile";
+#elif TVM_LLVM_VERSION <= 90
+      ICHECK(tm_->addPassesToEmitFile(pass, rso, nullptr, llvm::TargetMachine::CGFT_AssemblyFile) ==
+             0)
+          << "Cannot emit target CGFT_AssemblyFile";
+#else
+      ICHECK(tm_->addPassesToEmitFile(pass, rso, nullptr, llvm::CGFT_AssemblyFile) == 0)
+          << "Cannot emit target CGFT_AssemblyFile";
+#endif
+      pass.run(*m);
+      return rso.str().str();
+    } else if (fmt == "" || fmt == "ll") {
+      std::string type_str;
+      llvm::raw_string_ostream rso(type_str);
+      ICHECK(mptr_ != nullptr);
+      mptr_->print(rso, nullptr);
+      return rso.str();
+    } else {
+      LOG(FATAL) << "Do not know how to get source code with format: " << format << "\'";
+    }
+    return "";
+  }
+
+  void Init(const IRModule& mod, const Target& target) {
+    InitializeLLVM();
+    tm_ = GetLLVMTargetMachine(target);
+    ctx_ = std::make_shared<llvm::LLVMContext>();
+    std::unique_ptr<CodeGenLLVM> cg = CodeGenLLVM::Create(tm_.get());
+
+    std::vector<PrimFunc> funcs;
+    std::string entry_func;
+    Map<String, LinkedParam> linked_params;
+    bool found_linked_params = false;
+    bool could_have_linked_params = mod->ShouldLinkParameters();
+    relay::Runtime runtime =
+        mod->GetAttr<relay::Runtime>(tvm::attr::kRuntime).value_or(relay::Runtime::Create("cpp"));
+    bool system_lib = runtime->GetAttr<Bool>("system-lib").value_or(Bool(false));
+    bool target_c_runtime = runtime->name == "crt";
+
+    for (auto kv : mod->functions) {
+      if (could_have_linked_params &&
+          kv.first->name_hint == ::tvm::runtime::symbol::tvm_lookup_linked_param) {
+        Map<String, ObjectRef> attrs_dict =
+            Downcast<Map<String, ObjectRef>>(kv.second->attrs->dict);
+        CHECK(attrs_dict.find(::tvm::tir::attr::kLinkedParams) != attrs_dict.end())
+            << "no " << ::tvm::tir::attr::kLinkedParams << " attribute found!";
+        linked_params =
+            Downcast<Map<String, LinkedParam>>(attrs_dict[::tvm::tir::attr::kLinkedParams]);
+        found_linked_params = true;
+        continue;
+      }
+      if (!kv.second->IsInstance<PrimFuncNode>()) {
+        // (@jroesch): we relax constraints here, Relay functions will just be ignored.
+        DLOG(INFO) << "Can only lower IR Module with PrimFuncs, but got "
+                   << kv.second->GetTypeKey();
+        continue;
+      }
+      auto f = Downcast<PrimFunc>(kv.second);
+      auto global_symbol = f->GetAttr<String>(tvm::attr::kGlobalSymbol);
+      ICHECK(global_symbol.defined());
+      function_names_.push_back(global_symbol.value());
+      if (f->HasNonzeroAttr(tir::attr::kIsEntryFunc)) {
+        entry_func = global_symbol.value();
+      }
+      funcs.push_back(f);
+    }
+    // TODO(@jroesch): follow up on this condition.
+    // ICHECK(funcs.size() > 0 || (could_have_linked_params && found_linked_params));
+    // TODO(tqchen): remove the entry function behavior as it does not
+    // makes sense when we start to use multiple modules.
+    cg->Init("TVMMod", tm_.get(), ctx_.get(), system_lib, system_lib, target_c_runtime);
+
+    // See https://llvm.org/docs/LangRef.html#fast-math-flags for details
+    Bool fast_math_all = target->GetAttr<Bool>("fast-math").value_or(Bool(false));
+    Bool fast_math_nnan = target->GetAttr<Bool>("fast-math-nnan").value_or(Bool(false));
+    Bool fast_math_ninf = target->GetAttr<Bool>("fast-math-ninf").value_or(Bool(false));
+    Bool fast_math_nsz = target->GetAttr<Bool>("fast-math-nsz").value_or(Bool(false));
+    Bool fast_math_arcp = target->GetAttr<Bool>("fast-math-arcp").value_or(Bool(false));
+
+    llvm::FastMathFlags fmf;
+    if (fast_math_all) {
+#if TVM_LLVM_VERSION >= 60
+      fmf.setFast();
+#else
+      fmf.setUnsafeAlgebra();
+#endif
+    }
+
+    if (fast_math_nnan) {
+      fmf.setNoNaNs();
+    }
+    if (fast_math_ninf) {
+      fmf.setNoInfs();
+    }
+    if (fast_math_nsz) {
+      fmf.setNoSignedZeros();
+    }
+    if (fast_math_arcp) {
+      fmf.setAllowReciprocal();
+    }
+
+#if TVM_LLVM_VERSION >= 60
+    Bool fast_math_contract = target->GetAttr<Bool>("fast-math-contract").value_or(Bool(false));
+    Bool fast_math_afn = target->GetAttr<Bool>("fast-math-afn").value_or(Bool(false));
+    Bool fast_math_reassoc = target->GetAttr<Bool>("fast-math-reassoc").value_or(Bool(false));
+    if (fast_math_contract) {
+      fmf.setAllowContract(true);
+    }
+    if (fast_math_afn) {
+      fmf.setApproxFunc();
+    }
+    if (fast_math_reassoc) {
+      fmf.setAllowReassoc();
+    }
+#endif
+
+    cg->SetFastMathFlag(fmf);
+
+    cg->AddFunctionsOrdered(funcs.begin(), funcs.end());
+    if (entry_func.length() != 0) {
+      cg->AddMainFunction(entry_func);
+    }
+
+    if (found_linked_params) {
+      cg->LinkParameters(linked_params);
+    }
+    module_ = cg->Finish();
+    module_->addModuleFlag(llvm::Module::Warning, "tvm_target",
+                           llvm::MDString::get(*ctx_, LLVMTargetToString(target)));
+    module_->addModuleFlag(llvm::Module::Override, "Debug Info Version",
+                           llvm::DEBUG_METADATA_VERSION);
+
+    if (tm_->getTargetTriple().isOSDarwin()) {
+      module_->addModuleFlag(llvm::Module::Override, "Dwarf Version", 2);
+    }
+
+    std::string verify_errors_storage;
+    llvm::raw_string_ostream verify_errors(verify_errors_storage);
+    LOG_IF(FATAL, llvm::verifyModule(*module_, &verify_errors))
+        << "LLVM module verification failed with the following errors: \n"
+        << verify_errors.str();
+    target_ = target;
+    mptr_ = module_.get();
+  }
+
+  void Init(std::unique_ptr<llvm::Module> module, std::shared_ptr<llvm::LLVMContext> ctx) {
+    InitializeLLVM();
+    ctx_ = ctx;
+    llvm::SMDiagnostic err;
+    module_ = std::move(module);
+    if (module_ == nullptr) {
+      std::string msg = std::string(err.getMessage());
+      LOG(FATAL) << "Fail to load module: " << msg;
+    }
+    std::string target_metadata;
+    llvm::Metadata* tvm_target = module_->getModuleFlag("tvm_target");
+    if (tvm_target != nullptr) {
+      llvm::MDString* pstr = llvm::dyn_cast<llvm::MDString>(tvm_target);
+      ICHECK(pstr != nullptr);
+      target_metadata = pstr->getString().str();
+      if (!(target_metadata.length() >= 4 && target_metadata.substr(0, 4) == "llvm")) {
+        target_metadata = "llvm " + target_metadata;
+      }
+    } else {
+      std::ostringstream os;
+      os << "llvm -mtriple " << module_->getTargetTriple();
+      target_metadata = os.str();
+    }
+    mptr_ = module_.get();
+    tm_ = GetLLVMTargetMachine(Target(target_metadata));
+  }
+
+  void LoadIR(const std::string& file_name) {
+    auto ctx = std::make_shared<llvm::LLVMContext>();
+    llvm::SMDiagnostic err;
+    auto module = llvm::parseIRFile(file_name, err, *ctx);
+    if (module == nullptr) {
+      std::string msg = std::string(err.getMessage());
+      LOG(FATAL) << "Fail to load ir file " << file_name << "\n"
+                 << "line " << err.getLineNo() << ":" << msg;
+    }
+    Init(std::move(module), ctx);
+  }
+
+ private:
+  /*!
+   * \brief Emit the module to an in-memory object and read back per-symbol
+   *  sizes, keyed by symbol name (ELF/COFF/MachO symbol size field, defined
+   *  symbols only).
+   */
+  Map<String, Integer> GetFunctionSizes() {
+    llvm::SmallVector<char, 0> buffer;
+    {
+#if TVM_LLVM_VERSION <= 60
+      std::unique_ptr<llvm::Module> m = llvm::CloneModule(mptr_);
+#else
+      std::unique_ptr<llvm::Module> m = llvm::CloneModule(*mptr_);
+#endif
+      llvm::raw_svector_ostream dest(buffer);
+      llvm::legacy::PassManager pass;
+      ICHECK(tm_);
+#if TVM_LLVM_VERSION <= 60
+      ICHECK(tm_->addPassesToEmitFile(pass, dest, llvm::TargetMachine::CGFT_ObjectFile) == 0)
+          << "Cannot emit target CGFT_ObjectFile";
+#elif TVM_LLVM_VERSION <= 90
+      ICHECK(tm_->addPassesToEmitFile(pass, dest, nullptr, llvm::TargetMachine::CGFT_ObjectFile) ==
+             0)
+          << "Cannot emit target CGFT_ObjectFile";
+#else
+      ICHECK(tm_->addPassesToEmitFile(pass, dest, nullptr, llvm::CGFT_ObjectFile) == 0)
+          << "Cannot emit target CGFT_ObjectFile";
+#endif
+      pass.run(*m);
+    }
+    Map<String, Integer> sizes;
+    auto obj_or_err = llvm::object::ObjectFile::createObjectFile(
+        llvm::MemoryBufferRef(llvm::StringRef(buffer.data(), buffer.size()), "tvm_size_report"));
+    ICHECK(obj_or_err) << "Cannot parse the emitted object for size reporting";
+    // computeSymbolSizes is format-portable (ELF carries sizes directly;
+    // COFF/MachO are derived from symbol layout).
+    for (const auto& sym_size : llvm::object::computeSymbolSizes(**obj_or_err)) {
+      auto name_or_err = sym_size.first.getName();
+      if (!name_or_err || sym_size.second == 0) continue;
+      sizes.Set(String(name_or_err->str()), Integer(static_cast<int64_t>(sym_size.second)));
+    }
+    return sizes;
+  }
+
+  void LazyInitJIT() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ee_) {
+      return;
+    }
+    if (!target_.defined()) {
+      target_ = Target("llvm");
+    }
+    llvm::EngineBuilder builder(std::move(module_));
+    std::string triple, mcpu, mattr;
+    llvm::TargetOptions opt;
+    ParseLLVMTargetOptions(target_, &triple, &mcpu, &mattr, &opt);
+    builder.setEngineKind(llvm::EngineKind::JIT);
+    if (target_->GetAttr<Bool>("fast-compile").value_or(Bool(false))) {
+      builder.setOptLevel(llvm::CodeGenOpt::Less);
+    } else {
+      builder.setOptLevel(llvm::CodeGenOpt::Aggressive);
+    }
+    if (mcpu.length() != 0) {
+      builder.setMCPU(mcpu);
+    }
+    if (mattr.length() != 0) {
+      std::vector<std::string> mattrs{mattr};
+      builder.setMAttrs(mattrs);
+    }
+    builder.setTargetOptions(opt);
+    auto tm = std::unique_ptr<llvm::TargetMachine>(builder.selectTarget());
+    std::unique_ptr<llvm::TargetMachine> tm_sys = GetLLVMTargetMachine(Target("llvm"));
+    if (tm_sys->getTargetTriple().getArch() != tm->getTargetTriple().getArch()) {
+      LOG(FATAL) << "Cannot run module, architecture mismatch "
+                 << " module=" << tm->getTargetTriple().str()
+                 << " system=" << tm_sys->getTargetTriple().str();
+    }
+    llvm::DataLayout layout(tm->createDataLayout());
+    ICHECK(layout == mptr_->getDataLayout())
+        << "Data layout mismatch between module("
+        << mptr_->getDataLayout().getStringRepresentation() << ")"
+        << " and ExecutionEngine (" << layout.getStringRepresentation() << ")";
+    ee_ = builder.create(tm.release());
+    ICHECK(ee_ != nullptr) << "Failed to initialize jit engine for " << mptr_->getTargetTriple();
+    if (llvm::ObjectCache* cache = LLVMDiskObjectCache::Global()) {
+      // Repeat builds of identical IR load the cached object instead of
+      // running MCJIT codegen again.
+      ee_->setObjectCache(cache);
+    }
+    ee_->runStaticConstructorsDestructors(false);
+
+    if (void** ctx_addr =
+            reinterpret_cast<void**>(GetGlobalAddr(runtime::symbol::tvm_module_ctx))) {
+      *ctx_addr = this;
+    }
+    runtime::InitContextFunctions(
+        [this](const char* name) { return reinterpret_cast<void*>(GetGlobalAddr(name)); });
+  }
+  // Get global address from execution engine.
+  uint64_t GetGlobalAddr(const std::string& name) const {
+    // first verifies if GV exists.
+    if (mptr_->getGlobalVariable(name) != nullptr) {
+      return ee_->getGlobalValueAddress(name);
+    } else {
+      return 0;
+    }
+  }
+  uint64_t GetFunctionAddr(const std::string& name) const {
+    // first verifies if GV exists.
+    if (mptr_->getFunction(name) != nullptr) {
+      return ee_->getFunctionAddress(name);
+    } else {
+      return 0;
+    }
+  }
+
+  // The target configuration string
+  Target target_;
+  // JIT lock
+  std::mutex mutex_;
+  // execution engine
+  llvm::ExecutionEngine* ee_{nullptr};
+  // The raw pointer to the module.
+  llvm::Module* mptr_{nullptr};
+  // The target machine
+  std::unique_ptr<llvm::TargetMachine> tm_{nullptr};
+  // The module, can be moved to ee if JIT is enabled.
+  std::unique_ptr<llvm::Module> module_;
+  // the context.
+  std::shared_ptr<llvm::LLVMContext> ctx_;
+  /* \brief names of the functions declared in this module */
+  Array<String> function_names_;
+};
+
+TVM_REGISTER_GLOBAL("target.build.llvm")
+    .set_body_typed([](IRModule mod, Target target) -> runtime::Module {
+      // Optional sharded build (TVM_LLVM_NUM_SHARDS=N): partition the
+      // functions round-robin into N modules and run codegen plus the LLVM
+      // optimization pipeline for each shard on its own thread and context.
+      // The shards are imported into the first module, so ExportLibrary
+      // emits one object per shard and links them as usual.
+      const char* shards_env = getenv("TVM_LLVM_NUM_SHARDS");
+      int num_shards = shards_env ? atoi(shards_env) : 0;
+      if (num_shards > 1 && mod->functions.size() > 1) {
+        std::vector<IRModule> shards;
+        int num_funcs = static_cast<int>(mod->functions.size());
+        if (num_shards > num_funcs) num_shards = num_funcs;
+        for (int i = 0; i < num_shards; ++i) {
+          shards.push_back(
+              IRModule({}, mod->type_definitions, mod->Imports(), mod->source_map, mod->attrs));
+        }
+        int index = 0;
+        for (const auto& kv : mod->functions) {
+          shards[index % num_shards]->Add(kv.first, kv.second);
+          ++index;
+        }
+        std::vector<ObjectPtr<LLVMModuleNode>> nodes(num_shards);
+        std::vector<std::exception_ptr> errors(num_shards);
+        std::vector<std::thread> workers;
+        for (int i = 0; i < num_shards; ++i) {
+          workers.emplace_back([&, i]() {
+            try {
+              nodes[i] = make_object<LLVMModuleNode>();
+              nodes[i]->Init(shards[i], target);
+            } catch (...) {
+              errors[i] = std::current_exception();
+            }
+          });
+        }
+        for (std::thread& worker : workers) {
+          worker.join();
+        }
+        for (const std::exception_ptr& error : errors) {
+          if (error) std::rethrow_exception(error);
+        }
+        runtime::Module front(nodes[0]);
+        for (int i = 1; i < num_shards; ++i) {
+          front.Import(runtime::Module(nodes[i]));
+        }
+        return front;
+      }
+      auto n = make_object<LLVMModuleNode>();
+      n->Init(mod, target);
+      return runtime::Module(n);
+    });
+
+TVM_REGISTER_GLOBAL("codegen.LLVMModuleCreate")
+    .set_body_typed([](std::string target_str, std::string module_name) -> runtime::Module {
+      Target target = Target(target_str);
+      auto n = make_object<LLVMModuleNode>();
+      // Generate a LLVM module from an input target string
+      InitializeLLVM();
+      auto tm = GetLLVMTargetMachine(target);
+      auto ctx = std::make_shared<llvm::LLVMContext>();
+      std::unique_ptr<llvm::Module> module(new llvm::Module(module_name, *ctx));
+      // Use a default data layout and target triple
+      auto triple = tm->getTargetTriple();
+      module->setTargetTriple(triple.str());
+      module->setDataLayout(tm->createDataLayout());
+      n->Init(std::move(module), ctx);
+      return runtime::Module(n);
+    });
+
+TVM_REGISTER_GLOBAL("target.llvm_lookup_intrinsic_id")
+    .set_body_typed([](std::string name) -> int64_t {
+      return static_cast<int64_t>(llvm::Function::lookupIntrinsicID(name));
+    });
+
+TVM_REGISTER_GLOBAL("target.llvm_get_intrinsic_name").set_body_typed([](int64_t id) -> String {
+#if TVM_LLVM_VERSION >= 130
+  return std::string(llvm::Intrinsic::getBaseName(static_cast<llvm::Intrinsic::ID>(id)));
+#elif TVM_LLVM_VERSION >= 40
+  // This is the version of Intrinsic::getName that works for overloaded
+  // intrinsics. Helpfully, if we provide no types to this function, it
+  // will give us the overloaded name without the types appended. This
+  // should be enough information for most uses.
+  return std::string(llvm::Intrinsic::getName(static_cast<llvm::Intrinsic::ID>(id), {}));
+#else
+  // Nothing to do, just return the intrinsic id number
+  return std::to_string(id);
+#endif
+});
+
+TVM_REGISTER_GLOBAL("target.llvm_version_major").set_body_typed([]() -> int {
+  return TVM_LLVM_VERSION / 10;
+});
+
+TVM_REGISTER_GLOBAL("runtime.module.loadfile_ll")
+    .set_body_typed([](std::string filename, std::string fmt) -> runtime::Module {
+      auto n = make_object<LLVMModuleNode>();
+      n->LoadIR(filename);
+      return runtime::Module(n);
+    });
+
+TVM_REGISTER_GLOBAL("codegen.llvm_target_enabled")
+    .set_body_typed([](std::string target_str) -> bool {
+      InitializeLLVM();
+      Target target = Target(target_str);
+      return (GetLLVMTargetMachine(target, true) != nullptr);
+    });
+
+TVM_REGISTER_GLOBAL("codegen.codegen_blob")
+    .set_body_typed([](std::string data, bool system_lib,
+                       std::string target_triple) -> runtime::Module {
+      auto n = make_object<LLVMModuleNode>();
+      auto p = CodeGenBlob(data, system_lib, target_triple);
+      n->Init(std::move(p.first), p.second);
+      return runtime::Module(n);
+    });
+
+runtime::Module CreateLLVMCrtMetadataModule(const Array<runtime::Module>& modules, Target target,
+                                            tvm::relay::Runtime runtime) {
+  Array<String> func_names;
+  for (runtime::Module mod : modules) {
+    auto pf_funcs = mod.GetFunction("get_func_names");
+    if (pf_funcs != nullptr) {
+      Array<String> func_names_ = pf_funcs();
+      for (const auto& fname : func_names_) {
+        func_names.push_back(fname);
+      }
+    }
+  }
+
+  InitializeLLVM();
+  auto tm = GetLLVMTargetMachine(target);
+  bool system_lib = runtime->GetAttr<Bool>("system-lib").value_or(Bool(false));
+  bool target_c_runtime = runtime->name == "crt";
+  ICHECK(system_lib && target_c_runtime)
+      << "For LLVM C-runtime metadata module, must include --system-lib and --runtime=c; "
+      << "got target: " << target->str();
+  auto ctx = std::make_shared<llvm::LLVMContext>();
+  std::unique_ptr<CodeGenCPU> cg{new CodeGenCPU()};
+  cg->Init("TVMMetadataMod", tm.get(), ctx.get(), system_lib, system_lib, target_c_runtime);
+
+  cg->DefineFunctionRegistry(func_names);
+  auto mod = cg->Finish();
+  mod->addModuleFlag(llvm::Module::Warning, "tvm_target",
+                     llvm::MDString::get(*ctx, LLVMTargetToString(target)));
+  mod->addModuleFlag(llvm::Module::Override, "Debug Info Version", llvm::DEBUG_METADATA_VERSION);
+
+  if (tm->getTargetTriple().isOSDarwin()) {
+    mod->addModuleFlag(llvm::Module::Override, "Dwarf Version", 2);
+  }
+
+  std::string verify_errors_storage;
+  llvm::raw_string_ostream verify_errors(verify_errors_storage);
+  LOG_IF(FATAL, llvm::verifyModule(*mod, &verify_errors))
+      << "LLVM module verification failed with the following errors: \n"
+      << verify_errors.str();
+
+  auto n = make_object<LLVMModuleNode>();
+  n->Init(std::move(mod), ctx);
+  for (auto m : modules) {
+    n->Import(m);
+  }
+  return runtime::Module(n);
+}
+
+TVM_REGISTER_GLOBAL("runtime.CreateLLVMCrtMetadataModule")
+    .set_body_typed(CreateLLVMCrtMetadataModule);
+
+}  // namespace codegen
+}  // namespace tvm
+#endif  // TVM_LLVM_VERSION
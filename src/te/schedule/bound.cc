@@ -25,6 +25,8 @@
 #include <tvm/te/operation.h>
 #include <tvm/te/schedule_pass.h>
 
+#include <cstdlib>
+#include <functional>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -204,7 +206,73 @@ void InferRootBound(const Stage& stage, const GraphContext& ctx,
   stage->op->GatherBound(stage->op, tmap, rmap);
 }
 
+/*!
+ * \brief Cheap fingerprint of everything bound inference reads off a schedule.
+ *
+ *  Schedule primitives replace nodes - new relations, split iter vars,
+ *  attach specs, iter-var attrs - rather than mutating scalars in place, so
+ *  hashing the node pointers plus container sizes changes whenever any
+ *  primitive has run since the last inference. Interactive exploration and
+ *  search loops re-lower the same schedule object many times between edits;
+ *  when the fingerprint matches, the previous result is reused instead of
+ *  re-running the full inference.
+ */
+static size_t ScheduleFingerprint(const Schedule& sch) {
+  size_t hash = sch->stages.size();
+  auto mix = [&hash](size_t v) { hash = hash * 1000003U ^ v; };
+  auto mix_ptr = [&mix](const Object* ptr) { mix(std::hash<const Object*>()(ptr)); };
+  for (const Stage& stage : sch->stages) {
+    mix_ptr(stage->op.get());
+    mix_ptr(stage->attach_stage.get());
+    mix_ptr(stage->attach_ivar.get());
+    mix(static_cast<size_t>(stage->attach_type));
+    mix_ptr(stage->store_predicate.get());
+    mix(stage->relations.size());
+    for (const IterVarRelation& rel : stage->relations) {
+      mix_ptr(rel.get());
+    }
+    mix(stage->leaf_iter_vars.size());
+    for (const IterVar& iv : stage->leaf_iter_vars) {
+      mix_ptr(iv.get());
+    }
+    for (const IterVar& iv : stage->env_threads) {
+      mix_ptr(iv.get());
+    }
+    // Map order is stable while the map object is untouched, and any attr
+    // update replaces the attr node.
+    mix(stage->iter_var_attrs.size());
+    size_t attr_hash = 0;
+    for (const auto& kv : stage->iter_var_attrs) {
+      attr_hash ^= std::hash<const Object*>()(kv.first.get()) * 31 +
+                   std::hash<const Object*>()(kv.second.get());
+    }
+    mix(attr_hash);
+  }
+  return hash;
+}
+
 Map<IterVar, Range> InferBound(const Schedule& sch) {
+  // Opt-in memo for unchanged schedules (TVM_TE_BOUND_CACHE=1): notebooks
+  // and search loops lower the same schedule repeatedly, and InferBound
+  // dominates that path.
+  static const bool use_cache = [] {
+    const char* env = std::getenv("TVM_TE_BOUND_CACHE");
+    return env != nullptr && std::atoi(env) != 0;
+  }();
+  struct BoundCacheEntry {
+    const Object* sch_ptr{nullptr};
+    size_t fingerprint{0};
+    Map<IterVar, Range> result;
+  };
+  static thread_local BoundCacheEntry cache;
+  size_t fingerprint = 0;
+  if (use_cache) {
+    fingerprint = ScheduleFingerprint(sch);
+    if (cache.sch_ptr == sch.get() && cache.fingerprint == fingerprint) {
+      return cache.result;
+    }
+  }
+
   // Prepare context
   GraphContext ctx;
   Array<Operation> roots;
@@ -250,7 +318,11 @@ Map<IterVar, Range> InferBound(const Schedule& sch) {
     ret[p.first] =
         Range::FromMinExtent(analyzer.Simplify(p.second->min), analyzer.Simplify(p.second->extent));
   }
-  return Map<IterVar, Range>(ret.begin(), ret.end());
+  Map<IterVar, Range> result(ret.begin(), ret.end());
+  if (use_cache) {
+    cache = {sch.get(), fingerprint, result};
+  }
+  return result;
 }
 
 TVM_REGISTER_GLOBAL("schedule.InferBound").set_body_typed(InferBound);
@@ -423,6 +423,15 @@ Stage& Stage::double_buffer() {
   return *this;
 }
 
+Stage& Stage::software_pipeline(int num_stages) {
+  StageNode* self = operator->();
+  ICHECK(!self->is_output) << "Cannot software-pipeline an output stage";
+  ICHECK_GE(num_stages, 2) << "A software pipeline needs at least two stages";
+  self->double_buffer = true;
+  self->double_buffer_stages = num_stages;
+  return *this;
+}
+
 Stage& Stage::rolling_buffer() {
   StageNode* self = operator->();
   ICHECK(!self->is_output) << "Cannot apply rolling buffer on output";
@@ -893,6 +902,8 @@ TVM_REGISTER_GLOBAL("te.StageStorageAlign").set_body_method(&Stage::storage_alig
 
 TVM_REGISTER_GLOBAL("te.StageDoubleBuffer").set_body_method(&Stage::double_buffer);
 
+TVM_REGISTER_GLOBAL("te.StageSoftwarePipeline").set_body_method(&Stage::software_pipeline);
+
 TVM_REGISTER_GLOBAL("te.StageRollingBuffer").set_body_method(&Stage::rolling_buffer);
 
 TVM_REGISTER_GLOBAL("te.ScheduleNormalize").set_body_method(&Schedule::normalize);
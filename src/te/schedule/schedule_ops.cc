@@ -44,7 +44,10 @@ Stmt MakePipeline(const Stage& s, const std::unordered_map<IterVar, Range>& dom_
                   bool debug_keep_trivial_loop) {
   Stmt producer = s->op->BuildProvide(s, dom_map, debug_keep_trivial_loop);
   if (s->double_buffer) {
-    producer = AttrStmt(s->op, tir::attr::double_buffer_scope, 1, producer);
+    // The annotation value carries the stage count; 1 keeps the classic
+    // two-slot double buffer for schedules that never set it.
+    int value = s->double_buffer_stages > 2 ? s->double_buffer_stages : 1;
+    producer = AttrStmt(s->op, tir::attr::double_buffer_scope, value, producer);
   }
   Stmt pipeline = producer;
 
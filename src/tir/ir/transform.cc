@@ -23,12 +23,17 @@
  */
 #include <tvm/node/repr_printer.h>
 #include <tvm/runtime/registry.h>
+#include <tvm/support/parallel_for.h>
 #include <tvm/tir/transform.h>
 
+#include <mutex>
+
 namespace tvm {
 namespace tir {
 namespace transform {
 
+TVM_REGISTER_PASS_CONFIG_OPTION("tir.experimental_parallel_passes", Bool);
+
 /*!
  * \brief Function level pass that applies transformations to all
  *        TIR functions within the module.
@@ -91,6 +96,40 @@ IRModule PrimFuncPassNode::operator()(IRModule mod, const PassContext& pass_ctx)
   std::vector<ObjectRef> deleted_list;
   IRModuleNode* mod_ptr = mod.CopyOnWrite();
   auto* func_dict = mod_ptr->functions.CopyOnWrite();
+  // TIR functions are independent, so a pass that declared itself
+  // side-effect free (PassInfo::parallel) maps over them with a thread pool;
+  // the dict slots are only written back from distinct indices. Like the
+  // relay function-pass executor, concurrent pipelines fall back to the
+  // serial loop when the process-wide parallel_for is already taken.
+  // Parallel mapping is opt-in (tir.experimental_parallel_passes): the
+  // flagged passes are believed thread-safe per function, but stay serial
+  // by default until CI exercises multi-function modules under TSan.
+  bool parallel_enabled =
+      pass_ctx->GetConfig<Bool>("tir.experimental_parallel_passes", Bool(false)).value();
+  std::unique_lock<std::mutex> parallel_lock(support::ParallelForMutex(), std::try_to_lock);
+  if (parallel_enabled && Info()->parallel && parallel_lock.owns_lock() && func_dict->size() > 1) {
+    std::vector<BaseFunc*> slots;
+    for (auto& kv : *func_dict) {
+      if (kv.second->IsInstance<PrimFuncNode>()) {
+        slots.push_back(&kv.second);
+      }
+    }
+    if (slots.size() > 1) {
+      support::parallel_for(0, static_cast<int>(slots.size()), [&](int i) {
+        PrimFunc func = Downcast<PrimFunc>(std::move(*slots[i]));
+        *slots[i] = pass_func(std::move(func), mod, pass_ctx);
+      });
+      for (auto& kv : *func_dict) {
+        if (!kv.second.defined()) {
+          deleted_list.push_back(kv.first);
+        }
+      }
+      for (const auto& gv : deleted_list) {
+        func_dict->erase(gv);
+      }
+      return mod;
+    }
+  }
   // directly loop over the underlying dict
   for (auto& kv : *func_dict) {
     // only picks up tir::PrimFunc
@@ -115,8 +154,8 @@ IRModule PrimFuncPassNode::operator()(IRModule mod, const PassContext& pass_ctx)
 
 Pass CreatePrimFuncPass(
     const runtime::TypedPackedFunc<PrimFunc(PrimFunc, IRModule, PassContext)>& pass_func,
-    int opt_level, String name, tvm::Array<String> required) {
-  PassInfo pass_info = PassInfo(opt_level, name, required);
+    int opt_level, String name, tvm::Array<String> required, bool parallel) {
+  PassInfo pass_info = PassInfo(opt_level, name, required, parallel);
   return PrimFuncPass(pass_func, pass_info);
 }
 
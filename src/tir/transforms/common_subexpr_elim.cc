@@ -30,6 +30,7 @@
 #include "common_subexpr_elim.h"
 
 #include <tvm/ir/transform.h>  // For the class Pass and the class PassContext
+#include <tvm/node/structural_hash.h>  // For the pass-scoped hash memo
 #include <tvm/runtime/container/array.h>
 #include <tvm/runtime/container/string.h>
 #include <tvm/tir/analysis.h>  // For the analysis which gives the size of an expr
@@ -602,7 +603,14 @@ Pass CommonSubexprElimTIR(bool enable_cse_tir) {
       }
 
       // Do the Common Subexpression Elimination on the body of the function, with the initial
-      // context that we have prepared
+      // context that we have prepared.
+      // The computation tables hash the same immutable subexpression objects
+      // over and over while being built, unioned, and intersected; without a
+      // memo each StructuralHash walk is linear in the subtree and the pass
+      // goes quadratic on large fused bodies. The scope caches whole-node
+      // hashes by pointer for the duration of the pass, making repeated
+      // lookups O(1) (IR nodes are immutable, so entries cannot go stale).
+      StructuralHashMemoScope hash_memo_scope;
       n->body = CommonSubexpressionEliminator::PerformCSE(std::move(f->body), context_init);
     }
 
@@ -0,0 +1,217 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file hoist_div_mod.cc
+ * \brief Hoist loop-invariant integer division and modulo out of loops.
+ *
+ *  Buffer flattening leaves floordiv/floormod chains in indices; when their
+ *  operands do not depend on a loop variable the divisions still execute on
+ *  every iteration, and integer division is expensive on little cores. This
+ *  pass lets each loop bind such subexpressions once: every maximal div/mod
+ *  whose operands are pure arithmetic over variables defined outside the
+ *  loop is computed in a let binding above the loop and reused inside.
+ */
+#include <tvm/node/structural_equal.h>
+#include <tvm/node/structural_hash.h>
+#include <tvm/tir/analysis.h>
+#include <tvm/tir/expr.h>
+#include <tvm/tir/stmt_functor.h>
+#include <tvm/tir/transform.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace tvm {
+namespace tir {
+
+namespace {
+
+/*! \brief Whether the expression is pure arithmetic over variables. */
+bool IsPureArith(const PrimExpr& expr) {
+  bool pure = true;
+  PostOrderVisit(expr, [&pure](const ObjectRef& node) {
+    if (node->IsInstance<LoadNode>() || node->IsInstance<CallNode>() ||
+        node->IsInstance<LetNode>() || node->IsInstance<BufferLoadNode>()) {
+      pure = false;
+    }
+  });
+  return pure;
+}
+
+/*!
+ * \brief Collect maximal div/mod subexpressions of a loop body that do not
+ * use the loop variable or any variable bound inside the body.
+ */
+class InvariantDivModCollector : public StmtExprVisitor {
+ public:
+  explicit InvariantDivModCollector(const Var& loop_var) { inner_vars_.insert(loop_var.get()); }
+
+  std::vector<PrimExpr> Collect(const Stmt& body) {
+    // First learn every var bound inside the body, then gather candidates,
+    // so a div/mod ahead of an inner binding cannot capture it.
+    BoundVarFinder finder(&inner_vars_);
+    finder(body);
+    this->VisitStmt(body);
+    return std::move(candidates_);
+  }
+
+  void VisitExpr_(const FloorDivNode* op) final { VisitDivMod(GetRef<PrimExpr>(op), op->b); }
+  void VisitExpr_(const FloorModNode* op) final { VisitDivMod(GetRef<PrimExpr>(op), op->b); }
+  void VisitExpr_(const DivNode* op) final { VisitDivMod(GetRef<PrimExpr>(op), op->b); }
+  void VisitExpr_(const ModNode* op) final { VisitDivMod(GetRef<PrimExpr>(op), op->b); }
+
+ private:
+  /*! \brief Record the vars bound by inner loops, lets, and allocates. */
+  class BoundVarFinder : public StmtExprVisitor {
+   public:
+    explicit BoundVarFinder(std::unordered_set<const VarNode*>* vars) : vars_(vars) {}
+    void VisitStmt_(const ForNode* op) final {
+      vars_->insert(op->loop_var.get());
+      StmtExprVisitor::VisitStmt_(op);
+    }
+    void VisitStmt_(const LetStmtNode* op) final {
+      vars_->insert(op->var.get());
+      StmtExprVisitor::VisitStmt_(op);
+    }
+    void VisitExpr_(const LetNode* op) final {
+      vars_->insert(op->var.get());
+      StmtExprVisitor::VisitExpr_(op);
+    }
+    void VisitStmt_(const AllocateNode* op) final {
+      vars_->insert(op->buffer_var.get());
+      StmtExprVisitor::VisitStmt_(op);
+    }
+
+   private:
+    std::unordered_set<const VarNode*>* vars_;
+  };
+
+  void VisitDivMod(const PrimExpr& expr, const PrimExpr& divisor) {
+    // Only divisions by a positive constant are hoisted: the original
+    // occurrence may sit under a guard, and moving a possibly-trapping
+    // division above the loop must not introduce a fault. Flattened index
+    // chains divide by constant strides, so this covers the motivating case.
+    const auto* divisor_imm = divisor.as<IntImmNode>();
+    if (divisor_imm != nullptr && divisor_imm->value > 0 && expr.dtype().is_int() &&
+        IsPureArith(expr) && UsesOnlyOuterVars(expr)) {
+      candidates_.push_back(expr);
+      // Maximal expressions only: the operands are covered by this binding.
+      return;
+    }
+    StmtExprVisitor::VisitExpr(expr);
+  }
+
+  bool UsesOnlyOuterVars(const PrimExpr& expr) const {
+    bool uses_var = false;
+    bool ok = true;
+    PostOrderVisit(expr, [this, &uses_var, &ok](const ObjectRef& node) {
+      if (const auto* var = node.as<VarNode>()) {
+        uses_var = true;
+        if (inner_vars_.count(var)) ok = false;
+      }
+    });
+    // Pure constants are left for the simplifier to fold.
+    return ok && uses_var;
+  }
+
+  std::unordered_set<const VarNode*> inner_vars_;
+  std::vector<PrimExpr> candidates_;
+};
+
+/*! \brief Replace collected expressions with their bound variables. */
+class DivModReplacer : public StmtExprMutator {
+ public:
+  using ReplaceMap =
+      std::unordered_map<PrimExpr, Var, StructuralHash, StructuralEqual>;
+
+  explicit DivModReplacer(const ReplaceMap* replacements) : replacements_(replacements) {}
+
+  PrimExpr VisitExpr_(const FloorDivNode* op) final { return Replace(GetRef<PrimExpr>(op)); }
+  PrimExpr VisitExpr_(const FloorModNode* op) final { return Replace(GetRef<PrimExpr>(op)); }
+  PrimExpr VisitExpr_(const DivNode* op) final { return Replace(GetRef<PrimExpr>(op)); }
+  PrimExpr VisitExpr_(const ModNode* op) final { return Replace(GetRef<PrimExpr>(op)); }
+
+ private:
+  PrimExpr Replace(const PrimExpr& expr) {
+    auto it = replacements_->find(expr);
+    if (it != replacements_->end()) {
+      return it->second;
+    }
+    return StmtExprMutator::VisitExpr(expr);
+  }
+
+  const ReplaceMap* replacements_;
+};
+
+/*! \brief Hoist invariant div/mod above each loop, innermost first. */
+class DivModHoister : public StmtExprMutator {
+ public:
+  Stmt VisitStmt_(const ForNode* op) final {
+    Stmt stmt = StmtExprMutator::VisitStmt_(op);
+    op = stmt.as<ForNode>();
+    ICHECK(op != nullptr);
+    InvariantDivModCollector collector(op->loop_var);
+    std::vector<PrimExpr> candidates = collector.Collect(op->body);
+    if (candidates.empty()) {
+      return stmt;
+    }
+    DivModReplacer::ReplaceMap replacements;
+    std::vector<std::pair<Var, PrimExpr>> bindings;
+    for (const PrimExpr& expr : candidates) {
+      if (replacements.count(expr)) continue;
+      Var var("div_mod_hoisted_" + std::to_string(name_index_++), expr.dtype());
+      replacements.emplace(expr, var);
+      bindings.emplace_back(var, expr);
+    }
+    Stmt body = DivModReplacer(&replacements)(op->body);
+    Stmt result = For(op->loop_var, op->min, op->extent, op->kind, body, op->thread_binding,
+                      op->annotations, op->span);
+    // The outermost binding comes first, so later bindings may refer to it.
+    for (auto it = bindings.rbegin(); it != bindings.rend(); ++it) {
+      result = LetStmt(it->first, it->second, result);
+    }
+    return result;
+  }
+
+ private:
+  int name_index_{0};
+};
+
+}  // namespace
+
+namespace transform {
+
+Pass HoistDivMod() {
+  auto pass_func = [](PrimFunc f, IRModule m, PassContext ctx) {
+    auto* n = f.CopyOnWrite();
+    n->body = DivModHoister()(std::move(n->body));
+    return f;
+  };
+  return CreatePrimFuncPass(pass_func, 0, "tir.HoistDivMod", {}, /*parallel=*/true);
+}
+
+TVM_REGISTER_GLOBAL("tir.transform.HoistDivMod").set_body_typed(HoistDivMod);
+
+}  // namespace transform
+
+}  // namespace tir
+}  // namespace tvm
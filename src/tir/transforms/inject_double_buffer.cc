@@ -26,6 +26,8 @@
 #include <tvm/tir/stmt_functor.h>
 #include <tvm/tir/transform.h>
 
+#include <algorithm>
+
 #include "ir_utils.h"
 
 namespace tvm {
@@ -112,7 +114,7 @@ class DoubleBufferInjector : public StmtExprMutator {
                           op->dtype.lanes();
       Stmt stmt = StmtExprMutator::VisitStmt_(op);
       op = stmt.as<AllocateNode>();
-      Array<PrimExpr> new_extents{make_const(op->extents[0].dtype(), 2)};
+      Array<PrimExpr> new_extents{make_const(op->extents[0].dtype(), it->second.num_stages)};
       for (PrimExpr e : op->extents) {
         new_extents.push_back(e);
       }
@@ -138,7 +140,13 @@ class DoubleBufferInjector : public StmtExprMutator {
             << "It is better to split with multiple of 2";
         ICHECK(is_zero(old_loop->min));
         PrimExpr zero = old_loop->min;
-        PrimExpr new_ext = old_loop->extent - make_const(old_loop->loop_var.dtype(), 1);
+        // The last max-shift iterations are guarded; peel them into the tail.
+        int shift = 1;
+        auto shift_it = loop_max_shift_.find(op);
+        if (shift_it != loop_max_shift_.end()) {
+          shift = shift_it->second;
+        }
+        PrimExpr new_ext = old_loop->extent - make_const(old_loop->loop_var.dtype(), shift);
         PrimExpr factor = make_const(new_ext.dtype(), split_loop_);
         PrimExpr outer_ext = new_ext / factor;
         PrimExpr tail_base = outer_ext * factor;
@@ -150,10 +158,11 @@ class DoubleBufferInjector : public StmtExprMutator {
           loop_seq.emplace_back(Substitute(old_loop->body, vmap));
         }
         Stmt loop = For(outer_var, zero, outer_ext, old_loop->kind, SeqStmt::Flatten(loop_seq));
-        // tail
+        // tail: with a shift of d the remainder spans up to
+        // split_loop_ + d - 1 guarded iterations.
         std::vector<Stmt> tail_seq;
         Stmt tail_body = StripDoubleBufferWrite()(old_loop->body);
-        for (int32_t i = 0; i < split_loop_; ++i) {
+        for (int32_t i = 0; i < split_loop_ + shift - 1; ++i) {
           PrimExpr idx = tail_base + make_const(tail_base.dtype(), i);
           vmap[old_loop->loop_var.get()] = idx;
           tail_seq.emplace_back(IfThenElse(idx < old_loop->extent, Substitute(tail_body, vmap)));
@@ -216,24 +225,42 @@ class DoubleBufferInjector : public StmtExprMutator {
     }
     StorageEntry& e = it->second;
     e.loop = loop_nest_.back();
+    // An integer annotation value >= 2 requests that many pipeline stages:
+    // the producer runs num_stages - 1 iterations ahead of the consumer and
+    // the storage rotates over num_stages slots, which is what async-copy
+    // style multi-stage mainloops need. The legacy value 1 keeps the classic
+    // two-slot double buffer.
+    if (const auto* stages = op->value.as<IntImmNode>()) {
+      if (stages->value >= 2) {
+        e.num_stages = static_cast<int>(stages->value);
+      }
+    }
+    const int shift_distance = e.num_stages - 1;
     PrimExpr zero = make_const(e.loop->loop_var.dtype(), 0);
-    PrimExpr one = make_const(e.loop->loop_var.dtype(), 1);
-    PrimExpr two = make_const(e.loop->loop_var.dtype(), 2);
-    PrimExpr loop_shift = e.loop->loop_var + one;
+    PrimExpr stages = make_const(e.loop->loop_var.dtype(), e.num_stages);
+    PrimExpr loop_shift =
+        e.loop->loop_var + make_const(e.loop->loop_var.dtype(), shift_distance);
     e.switch_write_var = Var(e.loop->loop_var->name_hint + ".db", e.loop->loop_var.dtype());
-    e.switch_read_var = indexmod(e.loop->loop_var, two);
+    e.switch_read_var = indexmod(e.loop->loop_var, stages);
     in_double_buffer_scope_ = true;
     Stmt body = this->VisitStmt(op->body);
     in_double_buffer_scope_ = false;
     std::unordered_map<const VarNode*, PrimExpr> vmap;
-    vmap[e.switch_write_var.get()] = zero;
-    vmap[e.loop->loop_var.get()] = zero;
-    loop_pre_[e.loop].emplace_back(Substitute(body, vmap));
+    // Prologue: fill the first shift_distance slots before the main loop.
+    for (int k = 0; k < shift_distance; ++k) {
+      PrimExpr iter = make_const(e.loop->loop_var.dtype(), k);
+      vmap[e.switch_write_var.get()] = indexmod(iter, stages);
+      vmap[e.loop->loop_var.get()] = iter;
+      loop_pre_[e.loop].emplace_back(
+          IfThenElse(iter < e.loop->extent, Substitute(body, vmap)));
+    }
     vmap[e.loop->loop_var.get()] = loop_shift;
-    vmap[e.switch_write_var.get()] = indexmod(loop_shift, two);
+    vmap[e.switch_write_var.get()] = indexmod(loop_shift, stages);
     body = Substitute(body, vmap);
     body = AttrStmt(buffer, attr::double_buffer_write, 1, body);
     body = IfThenElse(loop_shift < e.loop->extent, body);
+    int& max_shift = loop_max_shift_[e.loop];
+    max_shift = std::max(max_shift, shift_distance);
     return body;
   }
   // Storage entry for those who need double buffering.
@@ -248,6 +275,8 @@ class DoubleBufferInjector : public StmtExprMutator {
     PrimExpr switch_read_var;
     // The storage scope.
     std::string scope;
+    // Number of rotating buffer slots (2 = classic double buffering).
+    int num_stages{2};
   };
   // Whether split loop
   int32_t split_loop_;
@@ -259,6 +288,8 @@ class DoubleBufferInjector : public StmtExprMutator {
   std::unordered_map<const ForNode*, std::vector<Stmt> > loop_allocs_;
   // The stmt to be appended before the loop
   std::unordered_map<const ForNode*, std::vector<Stmt> > loop_pre_;
+  // The largest producer shift distance injected per loop
+  std::unordered_map<const ForNode*, int> loop_max_shift_;
   // The allocation size of the buffer
   std::unordered_map<const VarNode*, StorageEntry> dbuffer_info_;
 };
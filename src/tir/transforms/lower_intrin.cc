@@ -27,7 +27,11 @@
 #include <tvm/tir/op.h>
 #include <tvm/tir/transform.h>
 
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "../../arith/ir_mutator_with_analyzer.h"
 #include "../../arith/pattern_match.h"
@@ -65,17 +69,29 @@ class IntrinInjecter : public tvm::arith::IRMutatorWithAnalyzer {
 
   PrimExpr VisitExpr_(const CallNode* op) final {
     if (auto* ptr_op = op->op.as<OpNode>()) {
-      for (const auto& f_attr_map : attr_maps_) {
-        FLowerGeneral f = f_attr_map.get(GetRef<Op>(ptr_op), nullptr);
-        if (f != nullptr) {
-          PrimExpr e = GetRef<PrimExpr>(op);
-          PrimExpr r = f(e);
-          ICHECK(r.defined()) << "intrinsic rule must always return valid Expr";
-          if (!r.same_as(e)) {
-            r = this->VisitExpr(r);
-            if (r.defined()) {
-              return r;
-            }
+      // Resolve each op's lowering rule once per pass: kernels with
+      // thousands of occurrences of one intrinsic otherwise probe the whole
+      // pattern chain (up to six attr maps) per call site. A cached null
+      // also short-circuits ops that have no rule at all.
+      auto memo_it = rule_memo_.find(ptr_op);
+      if (memo_it == rule_memo_.end()) {
+        std::vector<FLowerGeneral> resolved;
+        for (const auto& f_attr_map : attr_maps_) {
+          FLowerGeneral f = f_attr_map.get(GetRef<Op>(ptr_op), nullptr);
+          if (f != nullptr) resolved.push_back(f);
+        }
+        memo_it = rule_memo_.emplace(ptr_op, std::move(resolved)).first;
+      }
+      // A rule that hands back the same expression declined; later patterns
+      // still get their chance, exactly as with the unmemoized chain.
+      for (const FLowerGeneral& f : memo_it->second) {
+        PrimExpr e = GetRef<PrimExpr>(op);
+        PrimExpr r = f(e);
+        ICHECK(r.defined()) << "intrinsic rule must always return valid Expr";
+        if (!r.same_as(e)) {
+          r = this->VisitExpr(r);
+          if (r.defined()) {
+            return r;
           }
         }
       }
@@ -283,6 +299,9 @@ class IntrinInjecter : public tvm::arith::IRMutatorWithAnalyzer {
 
   // attribute maps, shared only when FLegalize == FLowerIntrinsic
   std::vector<OpAttrMap<FLowerGeneral>> attr_maps_;
+  // Per-op resolved rule chain (non-null candidates in pattern order),
+  // filled lazily during the pass; see VisitExpr_(CallNode).
+  std::unordered_map<const Object*, std::vector<FLowerGeneral>> rule_memo_;
   FLowerGeneral fma_{nullptr};
   bool support_bitwise_op_{true};
 };
@@ -19,6 +19,16 @@
 
 /*!
  * \file make_unpacked_api.cc Lower PrimFunc to a standard C function API.
+ *
+ *  Buffer parameters become typed data pointers and scalar parameters pass
+ *  by value, so intra-module calls need no TVMValue boxing or type-code
+ *  re-checking per call - the marshalling that costs double-digit percent on
+ *  microcontroller-class inference. Selected through the AOT executor's
+ *  unpacked-api=1 option (aot_executor_codegen then emits plain call_extern
+ *  calls between the main function and the operators), while
+ *  interface-api chooses independently whether the module boundary itself
+ *  stays packed for the C runtime's generic entry points or exposes the same
+ *  unpacked C signatures.
  */
 #include <tvm/runtime/device_api.h>
 #include <tvm/runtime/registry.h>
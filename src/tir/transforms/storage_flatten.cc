@@ -1483,22 +1483,55 @@ class AssertSimplifier : public StmtMutator {
 //
 // We do support a few relaxed case, such as binding a
 // region with shape [1, 1, n, m] to buffer with shape [n, m]
+
+/*! \brief One cheap scan that decides which of the flattening stages can be
+ *  skipped for this function, so the common all-global no-bind kernel pays
+ *  for one traversal instead of several full mutator passes. */
+class FlattenPrescan : public StmtExprVisitor {
+ public:
+  static FlattenPrescan Scan(const PrimFunc& func) {
+    FlattenPrescan prescan;
+    prescan(func->body);
+    return prescan;
+  }
+
+  void VisitStmt_(const AttrStmtNode* op) final {
+    if (op->attr_key == attr::thread_extent) {
+      has_thread_scope = true;
+    } else if (op->attr_key == attr::buffer_bind_scope) {
+      has_buffer_bind = true;
+    }
+    StmtExprVisitor::VisitStmt_(op);
+  }
+
+  bool has_thread_scope{false};
+  bool has_buffer_bind{false};
+};
+
 PrimFunc StorageFlatten(PrimFunc func, int cache_line_size, bool create_bound_attributes) {
   // Only apply this pass to TIR from TE schedules.  Because this is a
   // per-function attribute, we can't just check it once for the
   // entire module and apply the Sequential transform.
   Optional<Bool> from_legacy_te_schedule = func->GetAttr("from_legacy_te_schedule", Bool(false));
   if (from_legacy_te_schedule.value()) {
-    auto seq = transform::Sequential(
-        {
-            BufferShapeLegalize::Pass(),
-            BufferStrideLegalize::Pass(),
-            ThreadScopePropagate::Pass(),
-            BufferBindUnwrapper::Pass(),
-            StorageFlattener::Pass(cache_line_size, create_bound_attributes),
-            AssertSimplifier::Pass(),
-        },
-        "tir.StorageFlatten_impl");
+    FlattenPrescan prescan = FlattenPrescan::Scan(func);
+    Array<transform::Pass> passes;
+    passes.push_back(BufferShapeLegalize::Pass());
+    passes.push_back(BufferStrideLegalize::Pass());
+    if (prescan.has_thread_scope || prescan.has_buffer_bind) {
+      // Without thread scopes the propagation would only rewrite unscoped
+      // realize vars to an explicit "global" annotation, which every consumer
+      // already treats as equivalent to the unannotated default.
+      passes.push_back(ThreadScopePropagate::Pass());
+    }
+    if (prescan.has_buffer_bind) {
+      passes.push_back(BufferBindUnwrapper::Pass());
+    }
+    passes.push_back(StorageFlattener::Pass(cache_line_size, create_bound_attributes));
+    // Always runs: the legalize stages above may themselves insert binder
+    // asserts, so the prescan cannot predict this stage's input.
+    passes.push_back(AssertSimplifier::Pass());
+    auto seq = transform::Sequential(passes, "tir.StorageFlatten_impl");
     GlobalVar dummy_func_name("dummy_func");
     IRModule mod(Map<GlobalVar, BaseFunc>({{dummy_func_name, func}}));
     mod = seq(mod);
@@ -1446,7 +1446,7 @@ Pass StorageRewrite() {
     n->body = StoragePlanRewriter().Rewrite(std::move(n->body), true);
     return PointerValueTypeRewrite(std::move(f), true, false, false, true, false, true);
   };
-  return CreatePrimFuncPass(pass_func, 0, "tir.StorageRewrite", {});
+  return CreatePrimFuncPass(pass_func, 0, "tir.StorageRewrite", {}, /*parallel=*/true);
 }
 
 TVM_REGISTER_GLOBAL("tir.transform.StorageRewrite").set_body_typed(StorageRewrite);
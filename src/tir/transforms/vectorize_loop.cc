@@ -100,7 +100,8 @@ class Vectorizer : public StmtMutator, public ExprFunctor<PrimExpr(const PrimExp
   using ExprFunctor::VisitExpr;
   using StmtMutator::operator();
 
-  Vectorizer(Var var, int var_lanes) : var_(var), var_lanes_(var_lanes) {
+  Vectorizer(Var var, int var_lanes, bool predicate_enabled = false)
+      : var_(var), var_lanes_(var_lanes), predicate_enabled_(predicate_enabled) {
     ramp_ = Ramp(0, 1, var_lanes);
   }
 
@@ -388,6 +389,16 @@ class Vectorizer : public StmtMutator, public ExprFunctor<PrimExpr(const PrimExp
     ICHECK(!op->condition.dtype().is_vector());
     PrimExpr condition = this->VisitExpr(op->condition);
     if (condition.dtype().is_vector()) {
+      // Predicated vectorization (tir.vectorize_predicate=True): a tail guard
+      // whose then-branch is pure buffer traffic becomes a mask folded into
+      // the load/store predicates, which LLVM lowers to masked vector ops,
+      // instead of scalarizing the whole tail.
+      if (predicate_enabled_ && !op->else_case.defined()) {
+        Stmt then_case = this->VisitStmt(op->then_case);
+        if (Optional<Stmt> masked = TryPredicate(then_case, condition)) {
+          return masked.value();
+        }
+      }
       return Scalarize(GetRef<Stmt>(op));
     }
     Stmt then_case = this->VisitStmt(op->then_case);
@@ -452,6 +463,83 @@ class Vectorizer : public StmtMutator, public ExprFunctor<PrimExpr(const PrimExp
   }
 
   // scalarize the statment
+  /*!
+   * \brief Fold \p mask into every load/store predicate of \p stmt.
+   * \return The predicated statement, or NullOpt when the statement contains
+   *  anything but plain buffer loads/stores (side effects must scalarize).
+   */
+  Optional<Stmt> TryPredicate(Stmt stmt, const PrimExpr& mask) {
+    class PredicateInjector : public StmtExprMutator {
+     public:
+      explicit PredicateInjector(const PrimExpr& mask) : mask_(mask) {}
+
+      bool failed() const { return failed_; }
+
+      PrimExpr VisitExpr_(const LoadNode* op) final {
+        PrimExpr index = StmtExprMutator::VisitExpr(op->index);
+        PrimExpr pred = StmtExprMutator::VisitExpr(op->predicate);
+        if (!IsMaskableIndex(index)) {
+          // Anything but a unit-stride ramp at full mask width (scalar or
+          // loop-invariant addresses, gathers, partial widths) falls back to
+          // the caller's Scalarize path: the LLVM masked-op lowering only
+          // accepts contiguous accesses, and the opt-in flag must degrade
+          // rather than abort codegen.
+          failed_ = true;
+          return GetRef<PrimExpr>(op);
+        }
+        int lanes = mask_.dtype().lanes();
+        return Load(op->dtype.with_lanes(lanes), op->buffer_var, index,
+                    BroadcastTo(pred, lanes) && mask_);
+      }
+
+      Stmt VisitStmt_(const StoreNode* op) final {
+        PrimExpr value = StmtExprMutator::VisitExpr(op->value);
+        PrimExpr index = StmtExprMutator::VisitExpr(op->index);
+        PrimExpr pred = StmtExprMutator::VisitExpr(op->predicate);
+        if (!IsMaskableIndex(index)) {
+          failed_ = true;
+          return GetRef<Stmt>(op);
+        }
+        int lanes = mask_.dtype().lanes();
+        return Store(op->buffer_var, BroadcastTo(value, lanes), index,
+                     BroadcastTo(pred, lanes) && mask_);
+      }
+
+      PrimExpr VisitExpr_(const CallNode* op) final {
+        // Calls may have side effects or fault on masked-off lanes.
+        failed_ = true;
+        return GetRef<PrimExpr>(op);
+      }
+
+      Stmt VisitStmt_(const EvaluateNode* op) final {
+        failed_ = true;
+        return GetRef<Stmt>(op);
+      }
+
+      Stmt VisitStmt_(const IfThenElseNode* op) final {
+        failed_ = true;
+        return GetRef<Stmt>(op);
+      }
+
+     private:
+      // Only contiguous full-width accesses may carry the fold-in mask.
+      bool IsMaskableIndex(const PrimExpr& index) const {
+        if (index.dtype().lanes() != mask_.dtype().lanes()) return false;
+        const RampNode* ramp = index.as<RampNode>();
+        return ramp != nullptr && is_one(ramp->stride);
+      }
+
+      PrimExpr mask_;
+      bool failed_{false};
+    };
+    PredicateInjector injector(mask);
+    Stmt result = injector(std::move(stmt));
+    if (injector.failed()) {
+      return Optional<Stmt>(nullptr);
+    }
+    return result;
+  }
+
   Stmt Scalarize(Stmt stmt) {
     Var idx(var_->name_hint + ".s", var_->dtype);
     Map<Var, PrimExpr> values{{var_, idx}};
@@ -469,6 +557,8 @@ class Vectorizer : public StmtMutator, public ExprFunctor<PrimExpr(const PrimExp
   arith::Analyzer analyzer_;
   // deep equal
   ExprDeepEqual deep_equal_;
+  // whether tail guards may be folded into load/store predicates
+  bool predicate_enabled_{false};
   // variable to be replaced
   Var var_;
   // the lanes.
@@ -543,6 +633,10 @@ class Vectorizer : public StmtMutator, public ExprFunctor<PrimExpr(const PrimExp
 };
 
 class LoopVectorizer : public StmtMutator {
+ public:
+  explicit LoopVectorizer(bool predicate_enabled = false)
+      : predicate_enabled_(predicate_enabled) {}
+
  public:
   Stmt VisitStmt_(const ForNode* op) final {
     if (op->kind == ForKind::kVectorized) {
@@ -551,15 +645,20 @@ class LoopVectorizer : public StmtMutator {
       if (!extent_as_int || extent_as_int->value < 1) {
         LOG(FATAL) << "Failed to vectorize loop with extent " << op->extent;
       }
-      return Vectorizer(op->loop_var, static_cast<int>(extent_as_int->value))(op->body);
+      return Vectorizer(op->loop_var, static_cast<int>(extent_as_int->value),
+                        predicate_enabled_)(op->body);
     } else {
       return StmtMutator::VisitStmt_(op);
     }
   }
+ private:
+  bool predicate_enabled_{false};
 };
 
 Stmt VectorizeLoop(Stmt stmt) { return LoopVectorizer()(std::move(stmt)); }
 
+TVM_REGISTER_PASS_CONFIG_OPTION("tir.vectorize_predicate", Bool);
+
 class VectorizeSkipper : public StmtMutator {
  public:
   Stmt VisitStmt_(const ForNode* op) final {
@@ -582,7 +681,9 @@ Pass VectorizeLoop(bool enable_vectorize) {
   auto pass_func = [=](PrimFunc f, IRModule m, PassContext ctx) {
     auto* n = f.CopyOnWrite();
     if (enable_vectorize) {
-      n->body = LoopVectorizer()(std::move(n->body));
+      bool predicate_enabled =
+          ctx->GetConfig<Bool>("tir.vectorize_predicate", Bool(false)).value();
+      n->body = LoopVectorizer(predicate_enabled)(std::move(n->body));
     } else {
       n->body = VectorizeSkipper()(std::move(n->body));
     }
@@ -195,6 +195,85 @@ class GreedyConflicts : public GreedyBase {
   }
 };
 
+/*!
+ * \brief Best-fit interval placement: like GreedySize's ordering, but each
+ * buffer may fill a gap between already-placed conflicting buffers instead of
+ * only stacking above them. One pass over the sorted conflicts per buffer, so
+ * it scales to thousands of buffers where hill climbing takes minutes, and
+ * the gap filling recovers most of the packing quality hill climbing buys.
+ */
+class GreedyBestFit : public GreedyBase {
+ public:
+  GreedyBestFit() {}
+  Map<BufferInfo, PoolAllocation> PlanMemory(const Array<BufferInfo>& buffer_info_arr) {
+    std::vector<BufferInfo> buffer_info_vec;
+    for (const auto& buffer_info : buffer_info_arr) {
+      buffer_info_vec.push_back(std::move(buffer_info));
+    }
+    std::sort(buffer_info_vec.begin(), buffer_info_vec.end(),
+              [](const BufferInfo& a, const BufferInfo& b) {
+                if (a->size_bytes->value == b->size_bytes->value) {
+                  if (a->conflicts.size() == b->conflicts.size()) {
+                    return std::string(a->name_hint->data) > std::string(b->name_hint->data);
+                  } else {
+                    return a->conflicts.size() > b->conflicts.size();
+                  }
+                }
+                return a->size_bytes > b->size_bytes;
+              });
+
+    Map<BufferInfo, PoolAllocation> pool_allocations;
+    for (const auto& buf_info : buffer_info_vec) {
+      size_t size = buf_info->size_bytes->value;
+      size_t alignment = buf_info->alignment->value;
+      std::unordered_map<PoolInfo, size_t, ObjectPtrHash, ObjectPtrEqual> pool_offset_candidates;
+      for (const auto& pool_info : buf_info->pool_candidates) {
+        // Occupied intervals of already-placed conflicts within this pool.
+        std::vector<std::pair<size_t, size_t>> occupied;
+        for (const auto& conflict_obj : buf_info->conflicts) {
+          auto conflict = Downcast<BufferInfo>(conflict_obj);
+          auto it = pool_allocations.find(conflict);
+          if (it == pool_allocations.end()) continue;
+          PoolAllocation allocation = (*it).second;
+          if (!allocation->pool_info.same_as(pool_info)) continue;
+          size_t start = allocation->byte_offset->value;
+          occupied.emplace_back(start, start + conflict->size_bytes->value);
+        }
+        std::sort(occupied.begin(), occupied.end());
+        // Scan the gaps (and finally the tail) for the tightest fit.
+        bool found = false;
+        size_t best_offset = 0;
+        size_t best_leftover = std::numeric_limits<size_t>::max();
+        size_t cursor = 0;
+        for (const auto& interval : occupied) {
+          size_t aligned = round_up_to_byte_alignment(cursor, alignment);
+          if (interval.first > aligned && interval.first - aligned >= size) {
+            size_t leftover = interval.first - aligned - size;
+            if (leftover < best_leftover) {
+              best_leftover = leftover;
+              best_offset = aligned;
+              found = true;
+            }
+          }
+          cursor = std::max(cursor, interval.second);
+        }
+        size_t tail = round_up_to_byte_alignment(cursor, alignment);
+        if (!found && IsValidPlacement(pool_info, tail, size)) {
+          best_offset = tail;
+          found = true;
+        }
+        if (found && IsValidPlacement(pool_info, best_offset, size)) {
+          pool_offset_candidates[pool_info] = best_offset;
+        }
+      }
+      auto selected_pool = SelectPlacementPool(buf_info, pool_offset_candidates);
+      pool_allocations.Set(
+          buf_info, PoolAllocation(selected_pool, Integer(pool_offset_candidates[selected_pool])));
+    }
+    return pool_allocations;
+  }
+};
+
 Map<BufferInfo, PoolAllocation> GreedyBySize(const Array<BufferInfo>& buffer_info_arr,
                                              const Integer& memory_pressure) {
   return GreedySize().PlanMemory(buffer_info_arr);
@@ -215,6 +294,16 @@ TVM_REGISTER_GLOBAL("tir.usmp.algo.greedy_by_conflicts")
       return GreedyByConflicts(buffer_info_arr, memory_pressure);
     });
 
+Map<BufferInfo, PoolAllocation> BestFit(const Array<BufferInfo>& buffer_info_arr,
+                                        const Integer& memory_pressure) {
+  return GreedyBestFit().PlanMemory(buffer_info_arr);
+}
+
+TVM_REGISTER_GLOBAL("tir.usmp.algo.best_fit")
+    .set_body_typed([](Array<BufferInfo> buffer_info_arr, Integer memory_pressure) {
+      return BestFit(buffer_info_arr, memory_pressure);
+    });
+
 }  // namespace algo
 }  // namespace usmp
 }  // namespace tir
@@ -26,6 +26,7 @@
  * conflicts between other tir.allocate nodes.
  */
 #include <tvm/arith/analyzer.h>
+#include <tvm/ir/transform.h>
 #include <tvm/relay/executor.h>
 #include <tvm/runtime/device_api.h>
 #include <tvm/tir/builtin.h>
@@ -259,6 +260,24 @@ void BufferInfoExtractor::VisitStmt_(const AllocateNode* op) {
   const auto& type = Downcast<PointerType>(op->buffer_var->type_annotation);
   const auto& storage_scope = type->storage_scope;
 
+  // Tiny function-local intermediates are cheaper on the stack than in the
+  // SRAM pools: leaving them unrecorded keeps them as tir.allocate nodes,
+  // which codegen lowers to stack storage, and shrinks the pool
+  // requirement. Allocates reaching USMP never escape their PrimFunc by
+  // construction, so the only escape-analysis question is the size bound.
+  int64_t stack_max = transform::PassContext::Current()
+                          ->GetConfig<Integer>(kUSMPStackAllocaMaxBytesOption, Integer(0))
+                          .value()
+                          ->value;
+  if (stack_max > 0) {
+    Integer size_bytes = CalculateExtentsSize(op);
+    if (size_bytes.defined() && size_bytes->value <= stack_max) {
+      StmtExprVisitor::VisitStmt(op->body);
+      current_scope_info.allocate_nodes.erase(GetRef<Allocate>(op));
+      return;
+    }
+  }
+
   // If the allocate is in a for loop, USMP currently only looks at serial for loops.
   // If its not a serial for loop, then memory planner will omit them in the current memory planning
   // process leaving them to as tir.allocate nodes for codegen. Additionally, the USMP can only work
@@ -36,6 +36,10 @@ TVM_REGISTER_GLOBAL("topi.sum").set_body([](TVMArgs args, TVMRetValue* rv) {
   *rv = topi::sum(args[0], ArrayOrInt(args[1]), args[2]);
 });
 
+TVM_REGISTER_GLOBAL("topi.tree_sum").set_body([](TVMArgs args, TVMRetValue* rv) {
+  *rv = topi::tree_sum(args[0], ArrayOrInt(args[1]), args[2], args[3]);
+});
+
 TVM_REGISTER_GLOBAL("topi.min").set_body([](TVMArgs args, TVMRetValue* rv) {
   *rv = topi::min(args[0], ArrayOrInt(args[1]), args[2]);
 });
@@ -0,0 +1,154 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file compile_bench.cc
+ * \brief Compile-time benchmarks over a fixed corpus of schedules.
+ *
+ *  Runtime perf has a regression gate; compile time did not, and slowdowns
+ *  in the lowering pipeline (rewrite_simplify growth being the recurring
+ *  offender) used to land silently. Each benchmark lowers a representative
+ *  workload through the production driver pipeline. Run
+ *  `tvm_compile_bench --benchmark_format=json` and diff against the stored
+ *  baseline in CI; pass `--report-passes` as the first argument to print the
+ *  per-pass timing profile of one corpus sweep for drilling into a caught
+ *  regression.
+ */
+#include <benchmark/benchmark.h>
+#include <tvm/driver/driver_api.h>
+#include <tvm/ir/instrument.h>
+#include <tvm/ir/transform.h>
+#include <tvm/runtime/registry.h>
+#include <tvm/te/operation.h>
+#include <tvm/te/schedule.h>
+#include <tvm/tir/op.h>
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+using tvm::te::Tensor;
+
+// A blocked 512x512 matmul: exercises bound inference, loop partition, and
+// the vectorizer.
+void LowerMatmul() {
+  int n = 512;
+  auto a = tvm::te::placeholder({n, n}, tvm::DataType::Float(32), "A");
+  auto b = tvm::te::placeholder({n, n}, tvm::DataType::Float(32), "B");
+  auto k = tvm::te::reduce_axis(tvm::Range(0, n), "k");
+  auto c = tvm::te::compute(
+      {n, n},
+      [&](tvm::tir::Var i, tvm::tir::Var j) {
+        return tvm::sum(a(i, k) * b(k, j), {k});
+      },
+      "C");
+  auto sch = tvm::te::create_schedule({c->op});
+  tvm::te::IterVar xo, xi;
+  sch[c].split(c->op.as<tvm::te::ComputeOpNode>()->axis[0], 32, &xo, &xi);
+  tvm::LowerSchedule(sch, tvm::Array<Tensor>({a, b, c}), "matmul",
+                     std::unordered_map<Tensor, tvm::tir::Buffer>());
+}
+
+// A deep injective chain: stresses the simplifier and flattening, which is
+// where past compile-time regressions concentrated.
+void LowerElemwiseChain() {
+  int n = 1024;
+  auto x = tvm::te::placeholder({n}, tvm::DataType::Float(32), "x");
+  Tensor cur = x;
+  for (int stage = 0; stage < 48; ++stage) {
+    Tensor prev = cur;
+    cur = tvm::te::compute(
+        {n}, [&, stage](tvm::tir::Var i) { return prev(i) * 2.0f + static_cast<float>(stage); },
+        "stage" + std::to_string(stage));
+  }
+  auto sch = tvm::te::create_schedule({cur->op});
+  tvm::LowerSchedule(sch, tvm::Array<Tensor>({x, cur}), "chain",
+                     std::unordered_map<Tensor, tvm::tir::Buffer>());
+}
+
+// A 2-D stencil with boundary conditions: heavy on loop partitioning.
+void LowerStencil() {
+  int n = 256;
+  auto x = tvm::te::placeholder({n, n}, tvm::DataType::Float(32), "x");
+  auto y = tvm::te::compute(
+      {n, n},
+      [&](tvm::tir::Var i, tvm::tir::Var j) {
+        auto zero = tvm::tir::make_const(tvm::DataType::Float(32), 0.0f);
+        auto up = tvm::tir::Select(i > 0, x(tvm::max(i - 1, 0), j), zero);
+        auto left = tvm::tir::Select(j > 0, x(i, tvm::max(j - 1, 0)), zero);
+        return x(i, j) + up + left;
+      },
+      "y");
+  auto sch = tvm::te::create_schedule({y->op});
+  tvm::LowerSchedule(sch, tvm::Array<Tensor>({x, y}), "stencil",
+                     std::unordered_map<Tensor, tvm::tir::Buffer>());
+}
+
+void BM_LowerMatmul(benchmark::State& state) {
+  for (auto _ : state) LowerMatmul();
+}
+BENCHMARK(BM_LowerMatmul)->Unit(benchmark::kMillisecond);
+
+void BM_LowerElemwiseChain(benchmark::State& state) {
+  for (auto _ : state) LowerElemwiseChain();
+}
+BENCHMARK(BM_LowerElemwiseChain)->Unit(benchmark::kMillisecond);
+
+void BM_LowerStencil(benchmark::State& state) {
+  for (auto _ : state) LowerStencil();
+}
+BENCHMARK(BM_LowerStencil)->Unit(benchmark::kMillisecond);
+
+// One sweep of the corpus under the pass-timing instrument; prints the
+// per-pass profile so a regression caught by the benchmarks above can be
+// attributed to a pass without re-running under a profiler.
+void ReportPassProfiles() {
+  const auto* make_instrument = tvm::runtime::Registry::Get("instrument.MakePassTimingInstrument");
+  const auto* render = tvm::runtime::Registry::Get("instrument.RenderTimePassProfiles");
+  if (make_instrument == nullptr || render == nullptr) {
+    std::cerr << "pass timing instrument not available in this build\n";
+    return;
+  }
+  tvm::instrument::PassInstrument timing = (*make_instrument)();
+  tvm::transform::PassContext ctx = tvm::transform::PassContext::Create();
+  ctx->instruments = {timing};
+  {
+    tvm::With<tvm::transform::PassContext> scope(ctx);
+    LowerMatmul();
+    LowerElemwiseChain();
+    LowerStencil();
+  }
+  std::string profile = (*render)();
+  std::cout << profile << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc > 1 && std::strcmp(argv[1], "--report-passes") == 0) {
+    ReportPassProfiles();
+    return 0;
+  }
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
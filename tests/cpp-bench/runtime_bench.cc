@@ -0,0 +1,127 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+/*!
+ * \file runtime_bench.cc
+ * \brief Microbenchmarks for hot runtime primitives.
+ *
+ *  Tracks the paths whose regressions only used to show up in production:
+ *  object allocation, NDArray creation and copies, PackedFunc call and
+ *  TVMArgs marshalling overhead, Registry lookup, and thread pool dispatch.
+ *  Run `tvm_runtime_bench --benchmark_format=json` and diff the output in CI.
+ */
+#include <benchmark/benchmark.h>
+#include <tvm/runtime/c_backend_api.h>
+#include <tvm/runtime/container/array.h>
+#include <tvm/runtime/ndarray.h>
+#include <tvm/runtime/packed_func.h>
+#include <tvm/runtime/registry.h>
+
+#include <vector>
+
+namespace {
+
+using namespace tvm::runtime;
+
+void BM_ObjectAllocation(benchmark::State& state) {
+  for (auto _ : state) {
+    ObjectRef ref(make_object<Object>());
+    benchmark::DoNotOptimize(ref);
+  }
+}
+BENCHMARK(BM_ObjectAllocation);
+
+void BM_NDArrayEmpty(benchmark::State& state) {
+  Device cpu{kDLCPU, 0};
+  for (auto _ : state) {
+    NDArray array = NDArray::Empty({16, 16}, {kDLFloat, 32, 1}, cpu);
+    benchmark::DoNotOptimize(array);
+  }
+}
+BENCHMARK(BM_NDArrayEmpty);
+
+void BM_NDArrayCopyFromTo(benchmark::State& state) {
+  Device cpu{kDLCPU, 0};
+  int64_t elems = state.range(0);
+  NDArray src = NDArray::Empty({elems}, {kDLFloat, 32, 1}, cpu);
+  NDArray dst = NDArray::Empty({elems}, {kDLFloat, 32, 1}, cpu);
+  for (auto _ : state) {
+    src.CopyTo(dst);
+  }
+  state.SetBytesProcessed(state.iterations() * elems * 4);
+}
+BENCHMARK(BM_NDArrayCopyFromTo)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+void BM_PackedFuncCall(benchmark::State& state) {
+  PackedFunc add([](TVMArgs args, TVMRetValue* rv) {
+    *rv = args[0].operator int64_t() + args[1].operator int64_t();
+  });
+  for (auto _ : state) {
+    int64_t result = add(1, 2);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_PackedFuncCall);
+
+void BM_TVMArgsMarshalling(benchmark::State& state) {
+  PackedFunc sink([](TVMArgs args, TVMRetValue* rv) { *rv = args.num_args; });
+  NDArray array = NDArray::Empty({4}, {kDLFloat, 32, 1}, Device{kDLCPU, 0});
+  std::string str = "a_string_argument";
+  for (auto _ : state) {
+    int result = sink(1, 2.0, str, array);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_TVMArgsMarshalling);
+
+void BM_RegistryGet(benchmark::State& state) {
+  // Registered once; lookup cost is what serving paths pay per request.
+  static TVM_ATTRIBUTE_UNUSED auto reg =
+      Registry::Register("runtime_bench.nop").set_body([](TVMArgs, TVMRetValue*) {});
+  for (auto _ : state) {
+    const PackedFunc* func = Registry::Get("runtime_bench.nop");
+    benchmark::DoNotOptimize(func);
+  }
+}
+BENCHMARK(BM_RegistryGet);
+
+struct ParallelLambdaState {
+  std::vector<int> touched;
+};
+
+int ParallelNop(int task_id, TVMParallelGroupEnv* penv, void* cdata) {
+  auto* state = static_cast<ParallelLambdaState*>(cdata);
+  state->touched[task_id] = task_id;
+  return 0;
+}
+
+void BM_ThreadPoolDispatch(benchmark::State& state) {
+  // Round-trips one task per worker through the SpscTaskQueues and the
+  // WaitForJobs barrier: the fixed cost every parallel kernel launch pays.
+  ParallelLambdaState cdata;
+  cdata.touched.resize(1024);  // comfortably above any worker count
+  for (auto _ : state) {
+    TVMBackendParallelLaunch(ParallelNop, &cdata, 0);
+  }
+}
+BENCHMARK(BM_ThreadPoolDispatch);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -21,6 +21,7 @@
 #include <tvm/runtime/c_backend_api.h>
 
 #include <atomic>
+#include <cstdlib>
 #include <memory>
 #include <thread>
 
@@ -63,3 +64,23 @@ TEST(ThreadingBackend, TVMBackendParallelLaunchMultipleThreads) {
     }
   }
 }
+
+TEST(ThreadingBackend, TVMBackendParallelLaunchWorkStealing) {
+  // The stealing flag is read when a launching thread's pool is constructed,
+  // so set it before the launching thread first uses the pool.
+  setenv("TVM_THREAD_POOL_WORK_STEALING", "1", 1);
+  std::thread launcher([]() {
+    // Back-to-back launches with distinct closure data: a worker that
+    // lingers past its final finish-signal and claims into the next launch
+    // would run the new task ids against the previous launch's cdata and
+    // corrupt one of the sums.
+    constexpr int kLaunches = 200;
+    for (int i = 0; i < kLaunches; ++i) {
+      std::atomic<size_t> acc(0);
+      TVMBackendParallelLaunch(atomic_add_task_id, &acc, 0);
+      EXPECT_EQ(acc.load(std::memory_order_relaxed), N * (N - 1) / 2);
+    }
+  });
+  launcher.join();
+  unsetenv("TVM_THREAD_POOL_WORK_STEALING");
+}
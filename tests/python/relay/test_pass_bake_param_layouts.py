@@ -0,0 +1,89 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Tests for relay.transform.bake_param_layouts."""
+import numpy as np
+
+import tvm
+import tvm.testing
+from tvm import relay
+from tvm.relay.transform import bake_param_layouts
+
+
+def _run(mod, params, inputs):
+    with tvm.transform.PassContext(opt_level=0):
+        result = relay.create_executor(
+            "graph", mod=mod, device=tvm.cpu(0), target="llvm"
+        ).evaluate()(*inputs, **params)
+    return result.numpy()
+
+
+@tvm.testing.requires_llvm
+def test_bake_single_transform():
+    x = relay.var("x", shape=(1, 8, 4, 4))
+    w = relay.var("w", shape=(1, 8, 4, 4))
+    wt = relay.layout_transform(w, "NCHW", "NHWC")
+    xt = relay.layout_transform(x, "NCHW", "NHWC")
+    body = relay.add(xt, wt)
+    mod = tvm.IRModule.from_expr(relay.Function([x, w], body))
+    params = {"w": tvm.nd.array(np.random.uniform(size=(1, 8, 4, 4)).astype("float32"))}
+    x_np = np.random.uniform(size=(1, 8, 4, 4)).astype("float32")
+
+    expected = _run(mod, params, [x_np])
+    baked_mod, baked_params = bake_param_layouts(mod, params)
+
+    # The transform on the parameter is gone and its bytes were rewritten.
+    assert "layout_transform(%w" not in str(baked_mod["main"]).replace(" ", "")
+    assert baked_params["w"].shape == (1, 4, 4, 8)
+    got = _run(baked_mod, baked_params, [x_np])
+    tvm.testing.assert_allclose(got, expected, rtol=1e-6)
+
+
+@tvm.testing.requires_llvm
+def test_non_call_use_blocks_baking():
+    # The parameter also escapes through a Tuple (concatenate) in its
+    # original layout; baking would leave a dangling reference, so the
+    # utility must leave the module and params untouched.
+    x = relay.var("x", shape=(1, 8, 4, 4))
+    w = relay.var("w", shape=(1, 8, 4, 4))
+    wt = relay.layout_transform(w, "NCHW", "NHWC")
+    keep = relay.concatenate([w, x], axis=0)
+    body = relay.Tuple([wt, keep])
+    mod = tvm.IRModule.from_expr(relay.Function([x, w], body))
+    params = {"w": tvm.nd.array(np.random.uniform(size=(1, 8, 4, 4)).astype("float32"))}
+
+    baked_mod, baked_params = bake_param_layouts(mod, params)
+    assert baked_params["w"].shape == (1, 8, 4, 4)
+    assert "layout_transform" in str(baked_mod["main"])
+
+
+@tvm.testing.requires_llvm
+def test_direct_tuple_use_blocks_baking():
+    # Param consumed by a Tuple directly (non-call use) plus a transform.
+    w = relay.var("w", shape=(4, 4))
+    wt = relay.layout_transform(relay.reshape(w, (1, 4, 4, 1)), "NHWC", "NCHW")
+    body = relay.Tuple([wt, w])
+    mod = tvm.IRModule.from_expr(relay.Function([w], body))
+    params = {"w": tvm.nd.array(np.random.uniform(size=(4, 4)).astype("float32"))}
+    baked_mod, baked_params = bake_param_layouts(mod, params)
+    # w feeds reshape (a non-transform call) and a tuple: nothing baked.
+    assert baked_params["w"].shape == (4, 4)
+
+
+if __name__ == "__main__":
+    test_bake_single_transform()
+    test_non_call_use_blocks_baking()
+    test_direct_tuple_use_blocks_baking()
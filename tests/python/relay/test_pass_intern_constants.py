@@ -0,0 +1,79 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Tests for relay.transform.InternConstants."""
+import numpy as np
+
+import tvm
+import tvm.testing
+from tvm import relay
+
+
+def _collect_constants(expr):
+    consts = []
+    relay.analysis.post_order_visit(expr, lambda e: consts.append(e) if isinstance(e, relay.Constant) else None)
+    return consts
+
+
+def test_intern_deduplicates_identical_small_constants():
+    x = relay.var("x", shape=(4,))
+    zero_a = relay.const(np.zeros(4, dtype="float32"))
+    zero_b = relay.const(np.zeros(4, dtype="float32"))
+    one = relay.const(np.ones(4, dtype="float32"))
+    body = relay.add(relay.add(x, zero_a), relay.add(zero_b, one))
+    mod = tvm.IRModule.from_expr(relay.Function([x], body))
+
+    interned = relay.transform.InternConstants()(mod)
+    consts = _collect_constants(interned["main"].body)
+    zeros = [c for c in consts if c.data.numpy().sum() == 0]
+    assert len(zeros) == 2
+    # Identity, not just equality: the duplicates now share one node.
+    assert zeros[0].same_as(zeros[1])
+    # Semantics unchanged.
+    assert tvm.ir.structural_equal(mod["main"], interned["main"], map_free_vars=True)
+
+
+def test_intern_distinguishes_values_and_shapes():
+    x = relay.var("x", shape=(4,))
+    zero_f32 = relay.const(np.zeros(4, dtype="float32"))
+    zero_i32 = relay.const(np.zeros(4, dtype="int32"))
+    zero_2d = relay.const(np.zeros((2, 2), dtype="float32"))
+    body = relay.Tuple(
+        [relay.add(x, zero_f32), relay.cast(zero_i32, "float32"), relay.reshape(zero_2d, (4,))]
+    )
+    mod = tvm.IRModule.from_expr(relay.Function([x], body))
+    interned = relay.transform.InternConstants()(mod)
+    consts = _collect_constants(interned["main"].body)
+    # Different dtype or shape must never be conflated.
+    assert len({id(c) for c in consts}) == 3
+
+
+def test_intern_skips_large_constants():
+    x = relay.var("x", shape=(1024,))
+    big_a = relay.const(np.zeros(1024, dtype="float32"))  # 4KB > default 1KB cap
+    big_b = relay.const(np.zeros(1024, dtype="float32"))
+    body = relay.add(relay.add(x, big_a), big_b)
+    mod = tvm.IRModule.from_expr(relay.Function([x], body))
+    interned = relay.transform.InternConstants()(mod)
+    consts = _collect_constants(interned["main"].body)
+    assert len(consts) == 2
+    assert not consts[0].same_as(consts[1])
+
+
+if __name__ == "__main__":
+    test_intern_deduplicates_identical_small_constants()
+    test_intern_distinguishes_values_and_shapes()
+    test_intern_skips_large_constants()
@@ -0,0 +1,87 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Tests for relay.transform.PruneDeadParameters."""
+import numpy as np
+
+import tvm
+import tvm.testing
+from tvm import relay
+
+
+def _make_module():
+    # helper(a, b) never reads b; main calls it with a constant in the dead
+    # position, so the parameter and the argument should both go away.
+    a = relay.var("a", shape=(4,))
+    b = relay.var("b", shape=(4,))
+    helper = relay.Function([a, b], relay.add(a, a))
+    helper_gv = relay.GlobalVar("helper")
+
+    x = relay.var("x", shape=(4,))
+    dead_arg = relay.const(np.zeros(4, dtype="float32"))
+    main = relay.Function([x], relay.Call(helper_gv, [x, dead_arg]))
+    mod = tvm.IRModule({helper_gv: helper, relay.GlobalVar("main"): main})
+    return relay.transform.InferType()(mod)
+
+
+def test_prune_dead_params_rewrites_signature():
+    mod = _make_module()
+    pruned = relay.transform.PruneDeadParameters()(mod)
+    helper = pruned["helper"]
+    assert len(helper.params) == 1
+    call = pruned["main"].body
+    assert len(call.args) == 1
+
+
+@tvm.testing.requires_llvm
+def test_prune_dead_params_preserves_results():
+    mod = _make_module()
+    x_np = np.random.uniform(size=(4,)).astype("float32")
+
+    def run(m):
+        with tvm.transform.PassContext(opt_level=0):
+            return (
+                relay.create_executor("vm", mod=m, device=tvm.cpu(0), target="llvm")
+                .evaluate()(x_np)
+                .numpy()
+            )
+
+    expected = run(mod)
+    got = run(relay.transform.PruneDeadParameters()(mod))
+    tvm.testing.assert_allclose(got, expected, rtol=1e-6)
+
+
+def test_prune_keeps_effectful_arguments():
+    # The dead position receives a computed expression at the call site;
+    # dropping it would drop the computation, so the parameter must stay.
+    a = relay.var("a", shape=(4,))
+    b = relay.var("b", shape=(4,))
+    helper = relay.Function([a, b], relay.add(a, a))
+    helper_gv = relay.GlobalVar("helper")
+    x = relay.var("x", shape=(4,))
+    computed = relay.add(x, x)
+    main = relay.Function([x], relay.Call(helper_gv, [x, computed]))
+    mod = relay.transform.InferType()(
+        tvm.IRModule({helper_gv: helper, relay.GlobalVar("main"): main})
+    )
+    pruned = relay.transform.PruneDeadParameters()(mod)
+    assert len(pruned["helper"].params) == 2
+
+
+if __name__ == "__main__":
+    test_prune_dead_params_rewrites_signature()
+    test_prune_dead_params_preserves_results()
+    test_prune_keeps_effectful_arguments()
@@ -584,5 +584,51 @@ def test_simplify_consecutive_add():
     assert tvm.ir.structural_equal(zzl, after)
 
 
+def test_sink_layout_transform_cancels_inverse():
+    """A layout_transform sunk through a unary elementwise op becomes
+    adjacent to its inverse and the pair folds away."""
+
+    def before():
+        x = relay.var("x", shape=(1, 8, 4, 4), dtype="float32")
+        y = relay.layout_transform(x, "NCHW", "NHWC")
+        y = relay.nn.relu(y)
+        y = relay.layout_transform(y, "NHWC", "NCHW")
+        return relay.Function([x], y)
+
+    def expected():
+        x = relay.var("x", shape=(1, 8, 4, 4), dtype="float32")
+        return relay.Function([x], relay.nn.relu(x))
+
+    after = run_opt_pass(before(), transform.SimplifyExpr())
+    assert tvm.ir.structural_equal(after, run_infer_type(expected())), after
+
+
+def test_sink_layout_transform_skips_multi_arg():
+    """Binary consumers are not layout oblivious argument-by-argument; the
+    transform must stay put."""
+
+    def before():
+        x = relay.var("x", shape=(1, 8, 4, 4), dtype="float32")
+        y = relay.var("y", shape=(1, 4, 4, 8), dtype="float32")
+        lhs = relay.layout_transform(x, "NCHW", "NHWC")
+        return relay.Function([x, y], relay.add(lhs, y))
+
+    after = run_opt_pass(before(), transform.SimplifyExpr())
+    assert tvm.ir.structural_equal(after, run_infer_type(before())), after
+
+
+def test_sink_layout_transform_skips_non_elementwise():
+    """Injective-but-not-elementwise consumers (reshape) must not have the
+    transform pushed past them."""
+
+    def before():
+        x = relay.var("x", shape=(1, 8, 4, 4), dtype="float32")
+        y = relay.layout_transform(x, "NCHW", "NHWC")
+        return relay.Function([x], relay.reshape(y, (1, 128)))
+
+    after = run_opt_pass(before(), transform.SimplifyExpr())
+    assert tvm.ir.structural_equal(after, run_infer_type(before())), after
+
+
 if __name__ == "__main__":
     pytest.main([__file__])
@@ -0,0 +1,76 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""The VM constant pool is permuted into first-access order at compile
+time; these tests pin that the remapping stays behaviorally invisible."""
+import numpy as np
+
+import tvm
+import tvm.testing
+from tvm import relay
+from tvm.runtime import vm as vm_rt
+
+
+def _build_and_run(mod, x_np):
+    target = "llvm"
+    executable = relay.vm.compile(mod, target=target)
+    machine = vm_rt.VirtualMachine(executable, tvm.cpu(0))
+    return machine.invoke("main", tvm.nd.array(x_np)).numpy(), executable
+
+
+@tvm.testing.requires_llvm
+def test_constant_pool_permutation_preserves_results():
+    # Many distinct constants used out of discovery order: every LoadConst
+    # index must be remapped consistently with the permuted pool.
+    x = relay.var("x", shape=(4,), dtype="float32")
+    consts = [relay.const(np.full(4, float(i + 1), "float32")) for i in range(8)]
+    # Use them in a scrambled order so discovery order != access order.
+    order = [5, 0, 7, 2, 6, 1, 4, 3]
+    body = x
+    for i in order:
+        body = relay.add(body, consts[i])
+    mod = tvm.IRModule.from_expr(relay.Function([x], body))
+
+    x_np = np.random.uniform(size=(4,)).astype("float32")
+    got, executable = _build_and_run(mod, x_np)
+    expected = x_np + sum(np.full(4, float(i + 1), "float32") for i in order)
+    tvm.testing.assert_allclose(got, expected, rtol=1e-6)
+
+    # The permuted executable must survive serialization round-trips with
+    # consistent pool indices.
+    code, lib = executable.save()
+    loaded = vm_rt.Executable.load_exec(code, lib)
+    machine = vm_rt.VirtualMachine(loaded, tvm.cpu(0))
+    tvm.testing.assert_allclose(
+        machine.invoke("main", tvm.nd.array(x_np)).numpy(), expected, rtol=1e-6
+    )
+
+
+@tvm.testing.requires_llvm
+def test_constant_pool_shared_constants():
+    # One constant reused at several sites must keep a single pool slot.
+    x = relay.var("x", shape=(4,), dtype="float32")
+    c = relay.const(np.full(4, 2.0, "float32"))
+    body = relay.add(relay.multiply(x, c), c)
+    mod = tvm.IRModule.from_expr(relay.Function([x], body))
+    x_np = np.random.uniform(size=(4,)).astype("float32")
+    got, _ = _build_and_run(mod, x_np)
+    tvm.testing.assert_allclose(got, x_np * 2.0 + 2.0, rtol=1e-6)
+
+
+if __name__ == "__main__":
+    test_constant_pool_permutation_preserves_results()
+    test_constant_pool_shared_constants()
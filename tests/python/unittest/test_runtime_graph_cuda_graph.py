@@ -95,6 +95,31 @@ def test_graph_simple():
 
     check_verify()
 
+    def check_zero_copy_rebinding():
+        """Rebinding an input or output after capture must invalidate the
+        captured graph; a stale capture keeps using the old addresses and
+        silently produces wrong or missing results."""
+        mlib = tvm.build(s, [A, B], "cuda", name="myadd")
+        dev = tvm.cuda(0)
+        try:
+            mod = cuda_graph_executor.create(graph, mlib, dev)
+        except ValueError:
+            return
+
+        a = np.random.uniform(size=(n,)).astype(A.dtype)
+        mod.run(x=a)  # The first run captures a CUDA graph
+        np.testing.assert_equal(mod.get_output(0, tvm.nd.empty((n,))).numpy(), a + 1)
+
+        a2 = np.random.uniform(size=(n,)).astype(A.dtype)
+        new_in = tvm.nd.array(a2, dev)
+        new_out = tvm.nd.empty((n,), device=dev)
+        mod.module["set_input_zero_copy"](0, new_in)
+        mod.module["set_output_zero_copy"](0, new_out)
+        mod.run()
+        np.testing.assert_equal(new_out.numpy(), a2 + 1)
+
+    check_zero_copy_rebinding()
+
 
 if __name__ == "__main__":
     test_graph_simple()
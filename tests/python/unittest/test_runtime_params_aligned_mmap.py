@@ -0,0 +1,84 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Round-trip tests for the aligned parameter format and the mmap loader."""
+import numpy as np
+
+import tvm
+import tvm.testing
+from tvm.contrib import utils
+
+
+def _save_aligned(path, params):
+    tvm.get_global_func("runtime.SaveParamsAligned")(path, params)
+
+
+def _load_mmap(path):
+    return tvm.get_global_func("runtime.LoadParamsMmap")(path)
+
+
+def test_aligned_mmap_roundtrip():
+    temp = utils.tempdir()
+    path = temp.relpath("params.aligned")
+    params = {
+        "w0": tvm.nd.array(np.random.uniform(size=(7, 13)).astype("float32")),
+        "w1": tvm.nd.array(np.random.randint(-100, 100, size=(3,)).astype("int32")),
+        "scalar": tvm.nd.array(np.array(3.5, dtype="float32")),
+    }
+    _save_aligned(path, params)
+    loaded = _load_mmap(path)
+    assert set(loaded.keys()) == set(params.keys())
+    for name, value in params.items():
+        np.testing.assert_array_equal(loaded[name].numpy(), value.numpy())
+
+
+def test_aligned_dedup_shares_payload():
+    # Identical tensor contents are stored once; both entries must still
+    # load back with the right values, and writing through one loaded copy
+    # must not corrupt the other (the mapping is copy-on-write).
+    temp = utils.tempdir()
+    path = temp.relpath("params.dedup")
+    base = np.random.uniform(size=(64,)).astype("float32")
+    params = {
+        "a": tvm.nd.array(base),
+        "b": tvm.nd.array(base.copy()),
+        "c": tvm.nd.array(base + 1.0),
+    }
+    _save_aligned(path, params)
+    loaded = _load_mmap(path)
+    np.testing.assert_array_equal(loaded["a"].numpy(), base)
+    np.testing.assert_array_equal(loaded["b"].numpy(), base)
+    np.testing.assert_array_equal(loaded["c"].numpy(), base + 1.0)
+    # Mutate one mapped tensor; its duplicate must keep the stored value.
+    loaded["a"].copyfrom(np.zeros(64, dtype="float32"))
+    np.testing.assert_array_equal(loaded["b"].numpy(), base)
+
+
+def test_mmap_load_survives_reload():
+    temp = utils.tempdir()
+    path = temp.relpath("params.reload")
+    value = np.random.uniform(size=(32, 2)).astype("float32")
+    _save_aligned(path, {"w": tvm.nd.array(value)})
+    first = _load_mmap(path)
+    second = _load_mmap(path)
+    np.testing.assert_array_equal(first["w"].numpy(), value)
+    np.testing.assert_array_equal(second["w"].numpy(), value)
+
+
+if __name__ == "__main__":
+    test_aligned_mmap_roundtrip()
+    test_aligned_dedup_shares_payload()
+    test_mmap_load_survives_reload()
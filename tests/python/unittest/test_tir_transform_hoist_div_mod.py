@@ -0,0 +1,98 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+"""Tests for tir.transform.HoistDivMod."""
+import tvm
+from tvm.script import tir as T
+
+
+def _apply(func):
+    mod = tvm.IRModule.from_expr(func)
+    return tvm.tir.transform.HoistDivMod()(mod)["main"]
+
+
+def _collect(stmt, node_types):
+    found = []
+    tvm.tir.stmt_functor.post_order_visit(
+        stmt, lambda n: found.append(n) if isinstance(n, node_types) else None
+    )
+    return found
+
+
+def test_invariant_div_mod_hoisted():
+    @T.prim_func
+    def before(a: T.handle, n: T.int32):
+        A = T.match_buffer(a, (16,), "int32")
+        for i in T.serial(16):
+            A[i] = n // 7 + n % 7
+
+    after = _apply(before)
+    # The loop body must contain no div/mod anymore; the bindings sit in
+    # LetStmts above the loop.
+    loops = _collect(after.body, tvm.tir.For)
+    assert len(loops) == 1
+    assert not _collect(loops[0].body, (tvm.tir.FloorDiv, tvm.tir.FloorMod, tvm.tir.Div, tvm.tir.Mod))
+    lets = _collect(after.body, tvm.tir.LetStmt)
+    assert len(lets) == 2
+    for let in lets:
+        assert len(_collect(let.value, (tvm.tir.FloorDiv, tvm.tir.FloorMod))) == 1
+
+
+def test_loop_dependent_division_left_alone():
+    @T.prim_func
+    def before(a: T.handle, n: T.int32):
+        A = T.match_buffer(a, (16,), "int32")
+        for i in T.serial(16):
+            A[i] = i // 4 + i % 4
+
+    after = _apply(before)
+    assert not _collect(after.body, tvm.tir.LetStmt)
+    loops = _collect(after.body, tvm.tir.For)
+    assert len(_collect(loops[0].body, (tvm.tir.FloorDiv,))) == 1
+    assert len(_collect(loops[0].body, (tvm.tir.FloorMod,))) == 1
+
+
+def test_non_constant_divisor_rejected():
+    @T.prim_func
+    def before(a: T.handle, n: T.int32, m: T.int32):
+        A = T.match_buffer(a, (16,), "int32")
+        for i in T.serial(16):
+            A[i] = n // m
+
+    after = _apply(before)
+    # A variable divisor may be zero under the loop's guards; hoisting the
+    # division above the loop could introduce a fault, so nothing moves.
+    assert not _collect(after.body, tvm.tir.LetStmt)
+    loops = _collect(after.body, tvm.tir.For)
+    assert len(_collect(loops[0].body, (tvm.tir.FloorDiv,))) == 1
+
+
+def test_non_positive_divisor_rejected():
+    @T.prim_func
+    def before(a: T.handle, n: T.int32):
+        A = T.match_buffer(a, (16,), "int32")
+        for i in T.serial(16):
+            A[i] = n // (-7)
+
+    after = _apply(before)
+    assert not _collect(after.body, tvm.tir.LetStmt)
+
+
+if __name__ == "__main__":
+    test_invariant_div_mod_hoisted()
+    test_loop_dependent_division_left_alone()
+    test_non_constant_divisor_rejected()
+    test_non_positive_divisor_rejected()
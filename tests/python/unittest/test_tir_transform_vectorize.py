@@ -14,7 +14,10 @@
 # KIND, either express or implied.  See the License for the
 # specific language governing permissions and limitations
 # under the License.
+import numpy as np
+
 import tvm
+import tvm.testing
 from tvm import te
 
 
@@ -205,6 +208,47 @@ def test_vectorize_while_fail():
         assert expected in error_msg
 
 
+def test_vectorize_predicate_tail():
+    """tir.vectorize_predicate folds tail guards into masked accesses and
+    must stay numerically identical to the scalarized tail."""
+    n = 18
+    A = te.placeholder((n,), name="A")
+    B = te.compute((n,), lambda i: A[i] + 1.0, name="B")
+    s = te.create_schedule(B.op)
+    xo, xi = s[B].split(B.op.axis[0], factor=8)
+    s[B].vectorize(xi)
+    if not tvm.testing.device_enabled("llvm"):
+        return
+    with tvm.transform.PassContext(config={"tir.vectorize_predicate": True}):
+        f = tvm.build(s, [A, B], "llvm")
+    a = tvm.nd.array(np.random.uniform(size=n).astype("float32"))
+    b = tvm.nd.array(np.zeros(n, dtype="float32"))
+    f(a, b)
+    tvm.testing.assert_allclose(b.numpy(), a.numpy() + 1.0)
+
+
+def test_vectorize_predicate_gather_falls_back():
+    """Non-contiguous (gather) accesses cannot carry the fold-in mask; the
+    opt-in flag must degrade to the scalarized tail instead of aborting in
+    the LLVM masked-op lowering."""
+    n = 18
+    idx = te.placeholder((n,), name="idx", dtype="int32")
+    A = te.placeholder((n,), name="A")
+    B = te.compute((n,), lambda i: A[idx[i]], name="B")
+    s = te.create_schedule(B.op)
+    xo, xi = s[B].split(B.op.axis[0], factor=8)
+    s[B].vectorize(xi)
+    if not tvm.testing.device_enabled("llvm"):
+        return
+    with tvm.transform.PassContext(config={"tir.vectorize_predicate": True}):
+        f = tvm.build(s, [idx, A, B], "llvm")
+    idx_np = np.random.randint(0, n, size=n).astype("int32")
+    a_np = np.random.uniform(size=n).astype("float32")
+    b = tvm.nd.array(np.zeros(n, dtype="float32"))
+    f(tvm.nd.array(idx_np), tvm.nd.array(a_np), b)
+    tvm.testing.assert_allclose(b.numpy(), a_np[idx_np])
+
+
 if __name__ == "__main__":
     test_vectorize_vector()
     test_vectorize_with_if()
@@ -214,3 +258,5 @@ if __name__ == "__main__":
     test_vectorize_with_ge_cond()
     test_vectorize_let()
     test_vectorize_while_fail()
+    test_vectorize_predicate_tail()
+    test_vectorize_predicate_gather_falls_back()
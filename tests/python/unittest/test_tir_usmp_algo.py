@@ -123,7 +123,9 @@ def test_no_pool_error():
         buffer_pool_allocations = fusmp_algo(buffer_info_arr, 0)
 
 
-@pytest.mark.parametrize("algorithm", ["greedy_by_size", "greedy_by_conflicts", "hill_climb"])
+@pytest.mark.parametrize(
+    "algorithm", ["greedy_by_size", "greedy_by_conflicts", "hill_climb", "best_fit"]
+)
 def test_name_based_ordering(algorithm):
     """ This checks when the size and conlicts are same a stable result is generated"""
 
@@ -158,6 +160,91 @@ def test_name_based_ordering(algorithm):
         _test()
 
 
+def _make_linear_fixture(pool):
+    sizes = {"bi_a": 10, "bi_b": 20, "bi_c": 100, "bi_d": 40, "bi_e": 50, "bi_f": 50}
+    infos = {
+        name: usmp_utils.BufferInfo(name_hint=name, size_bytes=size, pool_candidates=[pool])
+        for name, size in sizes.items()
+    }
+    chain = ["bi_a", "bi_b", "bi_c", "bi_d", "bi_e", "bi_f"]
+    for i, name in enumerate(chain):
+        conflicts = []
+        if i > 0:
+            conflicts.append(infos[chain[i - 1]])
+        if i + 1 < len(chain):
+            conflicts.append(infos[chain[i + 1]])
+        infos[name].set_conflicts(conflicts)
+    return [infos[name] for name in chain]
+
+
+def _make_fanout_fixture(pool):
+    sizes = {
+        "bi_a": 10,
+        "bi_b": 20,
+        "bi_c": 100,
+        "bi_d": 40,
+        "bi_e": 50,
+        "bi_f": 60,
+        "bi_g": 70,
+    }
+    infos = {
+        name: usmp_utils.BufferInfo(name_hint=name, size_bytes=size, pool_candidates=[pool])
+        for name, size in sizes.items()
+    }
+    infos["bi_a"].set_conflicts([infos["bi_b"]])
+    infos["bi_b"].set_conflicts([infos["bi_a"], infos["bi_c"], infos["bi_d"]])
+    infos["bi_c"].set_conflicts([infos["bi_b"], infos["bi_d"], infos["bi_e"]])
+    infos["bi_d"].set_conflicts([infos["bi_b"], infos["bi_c"], infos["bi_e"], infos["bi_f"]])
+    infos["bi_e"].set_conflicts([infos["bi_c"], infos["bi_d"], infos["bi_f"], infos["bi_g"]])
+    infos["bi_f"].set_conflicts([infos["bi_d"], infos["bi_e"], infos["bi_g"]])
+    infos["bi_g"].set_conflicts([infos["bi_e"], infos["bi_f"]])
+    return list(infos.values())
+
+
+def _assert_no_conflicting_overlap(buffer_pool_allocations):
+    ranges = {
+        buf_info: (alloc.byte_offset, alloc.byte_offset + buf_info.size_bytes)
+        for buf_info, alloc in buffer_pool_allocations.items()
+    }
+    for buf_info, (begin, end) in ranges.items():
+        for conflict in buf_info.conflicts:
+            if conflict not in ranges:
+                continue
+            cbegin, cend = ranges[conflict]
+            assert end <= cbegin or cend <= begin, (
+                f"{buf_info.name_hint} [{begin},{end}) overlaps "
+                f"{conflict.name_hint} [{cbegin},{cend})"
+            )
+
+
+def _footprint(buffer_pool_allocations):
+    return max(
+        alloc.byte_offset + buf_info.size_bytes
+        for buf_info, alloc in buffer_pool_allocations.items()
+    )
+
+
+@pytest.mark.parametrize("fixture", [_make_linear_fixture, _make_fanout_fixture])
+def test_best_fit_valid_and_no_worse_than_greedy_by_size(fixture):
+    """best_fit reuses gaps, so all that is pinned is the contract: every
+    pair of conflicting buffers gets disjoint ranges, and the pool footprint
+    never exceeds greedy_by_size on the same fixture."""
+    target = Target("c")
+    pool = usmp_utils.PoolInfo(
+        pool_name="global_workspace",
+        target_access={target: usmp_utils.PoolInfo.READ_WRITE_ACCESS},
+    )
+    best_fit = tvm.get_global_func("tir.usmp.algo.best_fit")(fixture(pool), 0)
+    _assert_no_conflicting_overlap(best_fit)
+
+    pool2 = usmp_utils.PoolInfo(
+        pool_name="global_workspace",
+        target_access={target: usmp_utils.PoolInfo.READ_WRITE_ACCESS},
+    )
+    greedy = tvm.get_global_func("tir.usmp.algo.greedy_by_size")(fixture(pool2), 0)
+    assert _footprint(best_fit) <= _footprint(greedy)
+
+
 @pytest.mark.parametrize(
     ["algorithm", "workspace_size"],
     [("greedy_by_size", 140), ("greedy_by_conflicts", 140), ("hill_climb", 140)],